@@ -0,0 +1,100 @@
+// Measures the scaling of the parallel alpha wrapping with the number of threads.
+//
+// Usage: parallel_benchmark -i input -a relative_alpha -d relative_offset [-t max_threads]
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/alpha_wrap_3.h>
+
+#include <CGAL/IO/polygon_soup_io.h>
+#include <CGAL/Real_timer.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/global_control.h>
+#endif
+
+#include <array>
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using K = CGAL::Exact_predicates_inexact_constructions_kernel;
+using Point_3 = K::Point_3;
+
+using Mesh = CGAL::Surface_mesh<Point_3>;
+
+int main(int argc, char** argv)
+{
+  const int argc_check = argc - 1;
+  const char* entry_name_ptr = nullptr;
+  double relative_alpha_ratio = 20., relative_offset_ratio = 600.;
+  int max_threads = static_cast<int>(std::thread::hardware_concurrency());
+
+  for(int i=1; i<argc; ++i)
+  {
+    if(!strcmp("-i", argv[i]) && i < argc_check)
+      entry_name_ptr = argv[++i];
+    else if(!strcmp("-a", argv[i]) && i < argc_check)
+      relative_alpha_ratio = std::stod(argv[++i]);
+    else if(!strcmp("-d", argv[i]) && i < argc_check)
+      relative_offset_ratio = std::stod(argv[++i]);
+    else if(!strcmp("-t", argv[i]) && i < argc_check)
+      max_threads = std::stoi(argv[++i]);
+  }
+
+  if(argc < 3 || relative_alpha_ratio <= 0.)
+  {
+    std::cerr << "Error: bad input parameters." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<Point_3> points;
+  std::vector<std::array<std::size_t, 3> > faces;
+  if(!CGAL::IO::read_polygon_soup(entry_name_ptr, points, faces) || faces.empty())
+  {
+    std::cerr << "Error: Invalid input data." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  CGAL::Bbox_3 bbox;
+  for(const Point_3& p : points)
+    bbox += p.bbox();
+
+  const double diag_length = std::sqrt(CGAL::square(bbox.xmax() - bbox.xmin()) +
+                                       CGAL::square(bbox.ymax() - bbox.ymin()) +
+                                       CGAL::square(bbox.zmax() - bbox.zmin()));
+  const double alpha = diag_length / relative_alpha_ratio;
+  const double offset = diag_length / relative_offset_ratio;
+
+  CGAL::Real_timer timer;
+  timer.start();
+  Mesh wrap;
+  CGAL::alpha_wrap_3(points, faces, alpha, offset, wrap);
+  timer.stop();
+  const double sequential_time = timer.time();
+  std::cout << "Sequential: " << sequential_time << " s (" << num_vertices(wrap) << " vertices)" << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  for(int n=1; n<=(std::max)(1, max_threads); n*=2)
+  {
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, n);
+
+    timer.reset();
+    timer.start();
+    Mesh parallel_wrap;
+    CGAL::alpha_wrap_3(points, faces, alpha, offset, parallel_wrap,
+                       CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()));
+    timer.stop();
+    std::cout << "Parallel, " << n << " thread(s): " << timer.time() << " s ("
+              << num_vertices(parallel_wrap) << " vertices), speedup: "
+              << sequential_time / timer.time() << std::endl;
+  }
+#else
+  std::cout << "TBB is not available, the parallel wrapping is not benchmarked." << std::endl;
+#endif
+
+  return EXIT_SUCCESS;
+}
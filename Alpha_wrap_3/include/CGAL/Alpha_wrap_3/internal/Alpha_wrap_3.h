@@ -42,12 +42,19 @@
 #include <CGAL/Delaunay_triangulation_cell_base_with_circumcenter_3.h>
 #include <CGAL/Robust_weighted_circumcenter_filtered_traits_3.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+ #include <CGAL/Spatial_lock_grid_3.h>
+ #include <tbb/blocked_range.h>
+ #include <tbb/parallel_for.h>
+#endif
+
 #include <CGAL/Cartesian_converter.h>
 #include <CGAL/Simple_cartesian.h>
 
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/Default.h>
+#include <CGAL/tags.h>
 #include <CGAL/Named_function_parameters.h>
 #ifdef CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
  #include <CGAL/Modifiable_priority_queue.h>
@@ -304,6 +311,19 @@ public:
     //   on the offset surface corresponding to that corresponding to the latter offset value.
     const bool refining = choose_parameter(get_parameter(in_np, internal_np::refine_triangulation), false);
 
+    // Whether the Steiner points of spatially independent gates should be computed concurrently.
+    // The parallel flood fill requires the unsorted queue; it is otherwise sequential.
+    using Concurrency_tag = typename internal_np::Lookup_named_param_def<
+                              internal_np::concurrency_tag_t,
+                              InputNamedParameters,
+                              Sequential_tag // default
+                            >::type;
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!std::is_same<Concurrency_tag, Parallel_tag>::value,
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
 #ifdef CGAL_AW3_TIMER
     CGAL::Real_timer t;
     t.start();
@@ -325,7 +345,12 @@ public:
     dump_triangulation_faces("starting_wrap.off", true /*only_boundary_faces*/);
 #endif
 
-    alpha_flood_fill(visitor);
+#if defined(CGAL_LINKED_WITH_TBB) && !defined(CGAL_AW3_USE_SORTED_PRIORITY_QUEUE)
+    if constexpr(!std::is_same<Concurrency_tag, Sequential_tag>::value)
+      alpha_flood_fill_parallel(visitor);
+    else
+#endif
+      alpha_flood_fill(visitor);
 
 #ifdef CGAL_AW3_DEBUG_DUMP_INTERMEDIATE_WRAPS
     dump_triangulation_faces("flood_filled_wrap.off", true /*only_boundary_faces*/);
@@ -899,22 +924,33 @@ private:
   bool compute_steiner_point(const Cell_handle ch,
                              const Cell_handle neighbor,
                              Point_3& steiner_point) const
+  {
+    return compute_steiner_point(ch, neighbor, circumcenter(ch), circumcenter(neighbor), steiner_point);
+  }
+
+  // This overload does not modify the triangulation (the circumcenters are computed beforehand),
+  // and can thus be called concurrently for different gates
+  bool compute_steiner_point(const Cell_handle ch,
+                             const Cell_handle neighbor,
+                             const Point_3& ch_cc,
+                             const Point_3& neighbor_cc,
+                             Point_3& steiner_point) const
   {
     CGAL_precondition(!m_tr.is_infinite(neighbor));
+    CGAL_USE(ch);
 
     typename Geom_traits::Construct_ball_3 ball = geom_traits().construct_ball_3_object();
     typename Geom_traits::Construct_vector_3 vector = geom_traits().construct_vector_3_object();
     typename Geom_traits::Construct_translated_point_3 translate = geom_traits().construct_translated_point_3_object();
     typename Geom_traits::Construct_scaled_vector_3 scale = geom_traits().construct_scaled_vector_3_object();
 
-    const Point_3& neighbor_cc = circumcenter(neighbor);
     const Ball_3 neighbor_cc_offset_ball = ball(neighbor_cc, m_sq_offset);
     const bool is_neighbor_cc_in_offset = m_oracle.do_intersect(neighbor_cc_offset_ball);
 
 #ifdef CGAL_AW3_DEBUG_STEINER_COMPUTATION
     std::cout << "Compute_steiner_point(" << &*ch << ", " << &*neighbor << ")" << std::endl;
 
-    const Point_3& chc = circumcenter(ch);
+    const Point_3& chc = ch_cc;
     std::cout << "CH" << std::endl;
     std::cout << "\t" << ch->vertex(0)->point() << std::endl;
     std::cout << "\t" << ch->vertex(1)->point() << std::endl;
@@ -936,14 +972,11 @@ private:
 #endif
 
     // ch's circumcenter should not be within the offset volume
-    CGAL_assertion_code(const Point_3& ch_cc = circumcenter(ch);)
     CGAL_assertion_code(const Ball_3 ch_cc_offset_ball = ball(ch_cc, m_sq_offset);)
     CGAL_assertion(!m_oracle.do_intersect(ch_cc_offset_ball));
 
     if(is_neighbor_cc_in_offset)
     {
-      const Point_3& ch_cc = circumcenter(ch);
-
       // If the voronoi edge intersects the offset, the steiner point is the first intersection
       if(m_oracle.first_intersection(ch_cc, neighbor_cc, steiner_point, m_offset))
       {
@@ -1210,6 +1243,124 @@ private:
     }
   }
 
+  // The cell `nh` is infinite: no Steiner point is needed, it simply becomes "outside"
+  void carve_infinite_cell(const Cell_handle nh)
+  {
+    nh->set_label(Cell_label::OUTSIDE);
+#ifndef CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
+    nh->increment_erase_counter();
+#endif
+  }
+
+  // Traverse the gate `(ch, s)` without inserting a Steiner point
+  void carve(const Cell_handle ch, const int s, const Cell_handle nh)
+  {
+    nh->set_label(Cell_label::OUTSIDE);
+#ifndef CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
+    nh->increment_erase_counter();
+#endif
+
+    // for each finite facet of neighbor, push it to the queue
+    const int mi = m_tr.mirror_index(ch, s);
+    for(int i=1; i<4; ++i)
+    {
+      const Facet neighbor_f = std::make_pair(nh, (mi+i)&3);
+      push_facet(neighbor_f);
+    }
+  }
+
+  // Insert the Steiner point computed for a gate whose "inside" cell is `nh`,
+  // and push the new gates to the queue
+  template <typename Visitor>
+  void insert_steiner_point(const Point_3& steiner_point,
+                            const Cell_handle nh,
+                            Visitor& visitor)
+  {
+//    std::cout << CGAL::abs(CGAL::approximate_sqrt(m_oracle.squared_distance(steiner_point)) - m_offset)
+//              << " vs " << 1e-2 * m_offset << std::endl;
+    CGAL_assertion(CGAL::abs(CGAL::approximate_sqrt(m_oracle.squared_distance(steiner_point)) - m_offset) <= 1e-2 * m_offset);
+
+    // locate cells that are going to be destroyed and remove their facet from the queue
+    int li, lj = 0;
+    Locate_type lt;
+    const Cell_handle conflict_cell = m_tr.locate(steiner_point, lt, li, lj, nh);
+    CGAL_assertion(lt != Triangulation::VERTEX);
+
+    // Using small vectors like in Triangulation_3 does not bring any runtime improvement
+    std::vector<Facet> boundary_facets;
+    std::vector<Cell_handle> conflict_zone;
+    boundary_facets.reserve(32);
+    conflict_zone.reserve(32);
+
+    m_tr.find_conflicts(steiner_point, conflict_cell,
+                        std::back_inserter(boundary_facets),
+                        std::back_inserter(conflict_zone));
+
+#ifdef CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
+    // Purge the queue of facets that will be deleted/modified by the Steiner point insertion,
+    // and which might have been gates
+    for(const Cell_handle& cch : conflict_zone)
+    {
+      for(int i=0; i<4; ++i)
+      {
+        const Facet cf = std::make_pair(cch, i);
+        if(m_queue.contains_with_bounds_check(Gate(cf)))
+          m_queue.erase(Gate(cf));
+      }
+    }
+
+    for(const Facet& f : boundary_facets)
+    {
+      const Facet mf = m_tr.mirror_facet(f); // boundary facets have incident cells in the CZ
+      if(m_queue.contains_with_bounds_check(Gate(mf)))
+        m_queue.erase(Gate(mf));
+    }
+#endif
+
+    visitor.before_Steiner_point_insertion(*this, steiner_point);
+
+    // Actual insertion of the Steiner point
+    // We could use TDS functions to avoid recomputing the conflict zone, but in practice
+    // it does not bring any runtime improvements
+    Vertex_handle vh = m_tr.insert(steiner_point, lt, conflict_cell, li, lj);
+    vh->type() = AW3i::Vertex_type:: DEFAULT;
+
+    visitor.after_Steiner_point_insertion(*this, vh);
+
+    std::vector<Cell_handle> new_cells;
+    new_cells.reserve(32);
+    m_tr.incident_cells(vh, std::back_inserter(new_cells));
+    for(const Cell_handle& new_ch : new_cells)
+    {
+      // std::cout << "new cell has time stamp " << new_ch->time_stamp() << std::endl;
+      new_ch->set_label(m_tr.is_infinite(new_ch) ? Cell_label::OUTSIDE : Cell_label::INSIDE);
+    }
+
+    // Push all new boundary facets to the queue.
+    // It is not performed by looking at the facets on the boundary of the conflict zones
+    // because we need to handle internal facets, infinite facets, and also more subtle changes
+    // such as a new cell being marked inside which now creates a boundary
+    // with its incident "outside" flagged cell.
+    for(Cell_handle new_ch : new_cells)
+    {
+      for(int i=0; i<4; ++i)
+      {
+        if(m_tr.is_infinite(new_ch, i))
+          continue;
+
+        const Cell_handle new_nh = new_ch->neighbor(i);
+        if(new_nh->label() == new_ch->label()) // not on a boundary
+          continue;
+
+        const Facet boundary_f = std::make_pair(new_ch, i);
+        if(new_ch->is_outside())
+          push_facet(boundary_f);
+        else
+          push_facet(m_tr.mirror_facet(boundary_f));
+      }
+    }
+  }
+
   template <typename Visitor>
   bool alpha_flood_fill(Visitor& visitor)
   {
@@ -1283,120 +1434,212 @@ private:
 
       if(m_tr.is_infinite(nh))
       {
-        nh->set_label(Cell_label::OUTSIDE);
-#ifndef CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
-        nh->increment_erase_counter();
-#endif
+        carve_infinite_cell(nh);
         continue;
       }
 
       Point_3 steiner_point;
       if(compute_steiner_point(ch, nh, steiner_point))
+        insert_steiner_point(steiner_point, nh, visitor);
+      else // no need for a Steiner point, carve through and continue
+        carve(ch, s, nh);
+    } // while(!queue.empty())
+
+    visitor.on_flood_fill_end(*this);
+
+    // Check that no useful facet has been ignored
+    CGAL_postcondition_code(for(auto fit=m_tr.finite_facets_begin(), fend=m_tr.finite_facets_end(); fit!=fend; ++fit) {)
+    CGAL_postcondition_code(  Cell_handle ch = fit->first; Cell_handle nh = fit->first->neighbor(fit->second); )
+    CGAL_postcondition_code(  if(ch->label() == nh->label()) continue;)
+    CGAL_postcondition_code(  Facet f = *fit;)
+    CGAL_postcondition_code(  if(ch->is_inside()) f = m_tr.mirror_facet(f);)
+    CGAL_postcondition(       facet_status(f) == Facet_status::IRRELEVANT);
+    CGAL_postcondition_code(})
+
+    return true;
+  }
+
+#if defined(CGAL_LINKED_WITH_TBB) && !defined(CGAL_AW3_USE_SORTED_PRIORITY_QUEUE)
+  // Maximum number of gates that are popped from the queue at each step of the parallel flood fill.
+  // It does not depend on the number of threads, so that the result of the parallel flood fill
+  // does not either.
+  static constexpr std::size_t parallel_batch_size = 512;
+
+  // Concurrent version of alpha_flood_fill().
+  //
+  // At each step, gates whose "inside" cells are spatially independent (i.e., whose vertices lie
+  // in distinct cells of a spatial lock grid) are popped from the queue. The Steiner points of these
+  // gates, which are the expensive part as they require queries to the oracle, are computed
+  // concurrently. The gates are then traversed sequentially, in the order in which they were popped,
+  // which keeps the result deterministic. The Steiner point of a gate whose neighborhood has been
+  // modified by the traversal of a previous gate of the same step is recomputed.
+  //
+  // Only the order in which the gates are traversed differs from the sequential flood fill.
+  template <typename Visitor>
+  bool alpha_flood_fill_parallel(Visitor& visitor)
+  {
+#ifdef CGAL_AW3_DEBUG
+    std::cout << "> Flood fill (parallel)..." << std::endl;
+#endif
+
+    visitor.on_flood_fill_begin(*this);
+
+    struct Batch_gate
+    {
+      Batch_gate(const Gate& gate) : gate(gate) { }
+
+      Gate gate;
+      bool is_infinite = false;
+      Point_3 ch_cc, nh_cc;
+      std::array<Cell_handle, 4> nh_neighbors;
+      std::array<unsigned int, 4> nh_neighbor_erase_counters;
+      bool has_steiner_point = false;
+      Point_3 steiner_point;
+    };
+
+    // The grid cells are larger than the elements of the wrap, such that the conflict zones
+    // of the Steiner points of a step rarely overlap
+    using Lock_grid = Spatial_lock_grid_3<Tag_non_blocking>;
+    const double max_extent = (std::max)({ m_bbox.xmax() - m_bbox.xmin(),
+                                           m_bbox.ymax() - m_bbox.ymin(),
+                                           m_bbox.zmax() - m_bbox.zmin() });
+    const double grid_size = std::ceil(max_extent / (2. * CGAL::to_double(m_alpha)));
+    Lock_grid lock_grid(m_bbox.bbox(), static_cast<int>((std::min)(grid_size, 128.)));
+
+    auto try_lock = [&](const Cell_handle nh) -> bool
+    {
+      for(int i=0; i<4; ++i)
+        if(!m_tr.is_infinite(nh->vertex(i)) && lock_grid.is_locked(m_tr.point(nh, i)))
+          return false;
+
+      for(int i=0; i<4; ++i)
+        if(!m_tr.is_infinite(nh->vertex(i)))
+          lock_grid.try_lock(m_tr.point(nh, i));
+
+      return true;
+    };
+
+    std::vector<Batch_gate> batch;
+    std::vector<Gate> deferred_gates;
+    batch.reserve(parallel_batch_size);
+
+    while(!m_queue.empty())
+    {
+      // Gather spatially independent gates
+      for(std::size_t i=0; i<parallel_batch_size && !m_queue.empty(); ++i)
       {
-//        std::cout << CGAL::abs(CGAL::approximate_sqrt(m_oracle.squared_distance(steiner_point)) - m_offset)
-//                  << " vs " << 1e-2 * m_offset << std::endl;
-        CGAL_assertion(CGAL::abs(CGAL::approximate_sqrt(m_oracle.squared_distance(steiner_point)) - m_offset) <= 1e-2 * m_offset);
+        const Gate gate = m_queue.top();
+        m_queue.pop();
 
-        // locate cells that are going to be destroyed and remove their facet from the queue
-        int li, lj = 0;
-        Locate_type lt;
-        const Cell_handle conflict_cell = m_tr.locate(steiner_point, lt, li, lj, nh);
-        CGAL_assertion(lt != Triangulation::VERTEX);
+        if(gate.is_zombie())
+          continue;
 
-        // Using small vectors like in Triangulation_3 does not bring any runtime improvement
-        std::vector<Facet> boundary_facets;
-        std::vector<Cell_handle> conflict_zone;
-        boundary_facets.reserve(32);
-        conflict_zone.reserve(32);
+        const Facet& f = gate.facet();
+        CGAL_precondition(!m_tr.is_infinite(f));
 
-        m_tr.find_conflicts(steiner_point, conflict_cell,
-                            std::back_inserter(boundary_facets),
-                            std::back_inserter(conflict_zone));
+        const Cell_handle ch = f.first;
+        const Cell_handle nh = ch->neighbor(f.second);
+        CGAL_precondition(ch->is_outside());
+        CGAL_precondition(nh->label() == Cell_label::INSIDE || nh->label() == Cell_label::OUTSIDE);
 
-#ifdef CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
-        // Purge the queue of facets that will be deleted/modified by the Steiner point insertion,
-        // and which might have been gates
-        for(const Cell_handle& cch : conflict_zone)
+        if(m_tr.is_infinite(nh))
         {
-          for(int i=0; i<4; ++i)
-          {
-            const Facet cf = std::make_pair(cch, i);
-            if(m_queue.contains_with_bounds_check(Gate(cf)))
-              m_queue.erase(Gate(cf));
-          }
+          batch.emplace_back(gate);
+          batch.back().is_infinite = true;
+          continue;
         }
 
-        for(const Facet& f : boundary_facets)
+        if(!try_lock(nh))
         {
-          const Facet mf = m_tr.mirror_facet(f); // boundary facets have incident cells in the CZ
-          if(m_queue.contains_with_bounds_check(Gate(mf)))
-            m_queue.erase(Gate(mf));
+          deferred_gates.push_back(gate);
+          continue;
         }
-#endif
 
-        visitor.before_Steiner_point_insertion(*this, steiner_point);
+        // Circumcenters are cached in the cells, so they are computed before the concurrent part
+        batch.emplace_back(gate);
+        Batch_gate& bg = batch.back();
+        bg.ch_cc = circumcenter(ch);
+        bg.nh_cc = circumcenter(nh);
+        for(int i=0; i<4; ++i)
+        {
+          bg.nh_neighbors[i] = nh->neighbor(i);
+          bg.nh_neighbor_erase_counters[i] = nh->neighbor(i)->erase_counter();
+        }
+      }
 
-        // Actual insertion of the Steiner point
-        // We could use TDS functions to avoid recomputing the conflict zone, but in practice
-        // it does not bring any runtime improvements
-        Vertex_handle vh = m_tr.insert(steiner_point, lt, conflict_cell, li, lj);
-        vh->type() = AW3i::Vertex_type:: DEFAULT;
+      lock_grid.unlock_all_points_locked_by_this_thread();
 
-        visitor.after_Steiner_point_insertion(*this, vh);
+      // Deferred gates are put back in the order in which they were popped
+      for(auto it=deferred_gates.rbegin(); it!=deferred_gates.rend(); ++it)
+        m_queue.push(*it);
+      deferred_gates.clear();
 
-        std::vector<Cell_handle> new_cells;
-        new_cells.reserve(32);
-        m_tr.incident_cells(vh, std::back_inserter(new_cells));
-        for(const Cell_handle& new_ch : new_cells)
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, batch.size()),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+      {
+        for(std::size_t i=r.begin(); i!=r.end(); ++i)
         {
-          // std::cout << "new cell has time stamp " << new_ch->time_stamp() << std::endl;
-          new_ch->set_label(m_tr.is_infinite(new_ch) ? Cell_label::OUTSIDE : Cell_label::INSIDE);
+          Batch_gate& bg = batch[i];
+          if(bg.is_infinite)
+            continue;
+
+          const Facet& f = bg.gate.facet();
+          bg.has_steiner_point = compute_steiner_point(f.first, f.first->neighbor(f.second),
+                                                       bg.ch_cc, bg.nh_cc, bg.steiner_point);
         }
+      });
+
+      for(std::size_t i=0; i<batch.size(); ++i)
+      {
+        Batch_gate& bg = batch[i];
+        if(bg.gate.is_zombie())
+          continue;
 
-        // Push all new boundary facets to the queue.
-        // It is not performed by looking at the facets on the boundary of the conflict zones
-        // because we need to handle internal facets, infinite facets, and also more subtle changes
-        // such as a new cell being marked inside which now creates a boundary
-        // with its incident "outside" flagged cell.
-        for(Cell_handle new_ch : new_cells)
+        if(!visitor.go_further(*this))
         {
-          for(int i=0; i<4; ++i)
-          {
-            if(m_tr.is_infinite(new_ch, i))
-              continue;
-
-            const Cell_handle new_nh = new_ch->neighbor(i);
-            if(new_nh->label() == new_ch->label()) // not on a boundary
-              continue;
-
-            const Facet boundary_f = std::make_pair(new_ch, i);
-            if(new_ch->is_outside())
-              push_facet(boundary_f);
-            else
-              push_facet(m_tr.mirror_facet(boundary_f));
-          }
+          // Put back the gates that have not been treated, so that the wrapping can be resumed
+          for(std::size_t j=batch.size(); j>i; --j)
+            if(!batch[j-1].gate.is_zombie())
+              m_queue.push(batch[j-1].gate);
+
+          return false;
         }
-      }
-      else // no need for a Steiner point, carve through and continue
-      {
-        nh->set_label(Cell_label::OUTSIDE);
-#ifndef CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
-        nh->increment_erase_counter();
-#endif
 
-        // for each finite facet of neighbor, push it to the queue
-        const int mi = m_tr.mirror_index(ch, s);
-        for(int i=1; i<4; ++i)
+        visitor.before_facet_treatment(*this, bg.gate);
+
+        const Cell_handle ch = bg.gate.facet().first;
+        const int s = bg.gate.facet().second;
+        const Cell_handle nh = ch->neighbor(s);
+
+        if(bg.is_infinite)
         {
-          const Facet neighbor_f = std::make_pair(nh, (mi+i)&3);
-          push_facet(neighbor_f);
+          carve_infinite_cell(nh);
+          continue;
         }
+
+        // The gate is not a zombie, so `ch` and `nh` have not changed, but the Steiner point
+        // also depends on the labels of the neighbors of `nh`
+        for(int j=0; j<4; ++j)
+        {
+          if(nh->neighbor(j) != bg.nh_neighbors[j] ||
+             nh->neighbor(j)->erase_counter() != bg.nh_neighbor_erase_counters[j])
+          {
+            bg.has_steiner_point = compute_steiner_point(ch, nh, bg.steiner_point);
+            break;
+          }
+        }
+
+        if(bg.has_steiner_point)
+          insert_steiner_point(bg.steiner_point, nh, visitor);
+        else
+          carve(ch, s, nh);
       }
+
+      batch.clear();
     } // while(!queue.empty())
 
     visitor.on_flood_fill_end(*this);
 
-    // Check that no useful facet has been ignored
     CGAL_postcondition_code(for(auto fit=m_tr.finite_facets_begin(), fend=m_tr.finite_facets_end(); fit!=fend; ++fit) {)
     CGAL_postcondition_code(  Cell_handle ch = fit->first; Cell_handle nh = fit->first->neighbor(fit->second); )
     CGAL_postcondition_code(  if(ch->label() == nh->label()) continue;)
@@ -1407,6 +1650,7 @@ private:
 
     return true;
   }
+#endif // CGAL_LINKED_WITH_TBB && !CGAL_AW3_USE_SORTED_PRIORITY_QUEUE
 
   // Any outside cell that isn't reachable from infinity is a cavity that can be discarded.
   std::size_t purge_inner_connected_components()
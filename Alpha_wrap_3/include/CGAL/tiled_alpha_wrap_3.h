@@ -0,0 +1,564 @@
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+#ifndef CGAL_TILED_ALPHA_WRAP_3_H
+#define CGAL_TILED_ALPHA_WRAP_3_H
+
+#include <CGAL/license/Alpha_wrap_3.h>
+
+#include <CGAL/alpha_wrap_3.h>
+
+#include <CGAL/Polygon_mesh_processing/autorefinement.h>
+#include <CGAL/Polygon_mesh_processing/clip.h>
+#include <CGAL/Polygon_mesh_processing/orient_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+#include <CGAL/Polygon_mesh_processing/repair_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/union_of_triangle_meshes.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/for_each.h>
+#include <CGAL/iterator.h>
+#include <CGAL/tags.h>
+
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <type_traits>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+#include <iostream>
+#include <fstream>
+
+namespace CGAL {
+namespace Alpha_wraps_3 {
+namespace internal {
+
+// Appends to `out` the triangulation of the part of `tr` that is inside `box`.
+// Clips successively with the six planes bounding `box` (Sutherland-Hodgman)
+template <typename Triangle_3, typename Iso_cuboid_3, typename GeomTraits>
+void clip_triangle_to_box(const Triangle_3& tr,
+                          const Iso_cuboid_3& box,
+                          std::vector<Triangle_3>& out,
+                          const GeomTraits& gt)
+{
+  using FT = typename GeomTraits::FT;
+  using Point_3 = typename GeomTraits::Point_3;
+
+  typename GeomTraits::Compute_x_3 x = gt.compute_x_3_object();
+  typename GeomTraits::Compute_y_3 y = gt.compute_y_3_object();
+  typename GeomTraits::Compute_z_3 z = gt.compute_z_3_object();
+  typename GeomTraits::Construct_point_3 point = gt.construct_point_3_object();
+  typename GeomTraits::Construct_triangle_3 triangle = gt.construct_triangle_3_object();
+
+  auto coord = [&](const Point_3& p, const int axis) -> FT
+  {
+    return (axis == 0) ? x(p) : (axis == 1) ? y(p) : z(p);
+  };
+
+  const Point_3& p0 = tr.vertex(0), p1 = tr.vertex(1), p2 = tr.vertex(2);
+
+  bool is_inside = true;
+  for(int axis=0; axis<3 && is_inside; ++axis)
+  {
+    const FT lo = coord((box.min)(), axis), hi = coord((box.max)(), axis);
+    for(const Point_3* p : { &p0, &p1, &p2 })
+    {
+      const FT c = coord(*p, axis);
+      if(c < lo || c > hi)
+      {
+        is_inside = false;
+        break;
+      }
+    }
+  }
+
+  if(is_inside)
+  {
+    out.push_back(tr);
+    return;
+  }
+
+  std::vector<Point_3> polygon { p0, p1, p2 }, clipped;
+  for(int axis=0; axis<3; ++axis)
+  {
+    for(int side=0; side<2; ++side)
+    {
+      const FT c = coord(side == 0 ? (box.min)() : (box.max)(), axis);
+      auto is_in = [&](const Point_3& p) { return (side == 0) ? (coord(p, axis) >= c) : (coord(p, axis) <= c); };
+
+      clipped.clear();
+      for(std::size_t i=0, n=polygon.size(); i<n; ++i)
+      {
+        const Point_3& a = polygon[i];
+        const Point_3& b = polygon[(i+1) % n];
+        const bool a_in = is_in(a), b_in = is_in(b);
+        if(a_in)
+          clipped.push_back(a);
+        if(a_in != b_in)
+        {
+          const FT t = (c - coord(a, axis)) / (coord(b, axis) - coord(a, axis));
+          clipped.push_back(point(x(a) + t * (x(b) - x(a)),
+                                  y(a) + t * (y(b) - y(a)),
+                                  z(a) + t * (z(b) - z(a))));
+        }
+      }
+
+      polygon.swap(clipped);
+      if(polygon.size() < 3) // the remaining part, if any, is covered by the wraps of the neighboring tiles
+        return;
+    }
+  }
+
+  // the clipped polygon is convex
+  for(std::size_t i=2; i<polygon.size(); ++i)
+    out.push_back(triangle(polygon[0], polygon[i-1], polygon[i]));
+}
+
+} // namespace internal
+} // namespace Alpha_wraps_3
+
+/*!
+* \ingroup AW3_free_functions_grp
+*
+* \brief computes a watertight, 2-manifold, and intersection-free triangulated surface mesh
+* that strictly contains an input triangle soup, by wrapping independently overlapping tiles of the scene.
+*
+* The bounding box of the input is split into a regular grid of cubic tiles. For each tile,
+* the input triangles are clipped to the tile, enlarged by a margin of `2 * alpha + offset`,
+* and wrapped with a triangle soup oracle that only contains these triangles. The volume enclosed
+* by the wrap of each tile is then clipped to the tile, and the output is the boundary of the union
+* of these volumes. As the volumes only touch along the faces shared by the tiles, this union is
+* computed locally: the triangles that do not touch these faces are kept as they are, and only the
+* triangles that do are refined with `Polygon_mesh_processing::autorefine_triangle_soup()`, the parts
+* of the sections of two neighboring tiles that overlap being discarded. If the clipping of a tile fails,
+* or if the rounding of the intersection points prevents the refined triangles from forming a mesh,
+* the wraps of the tiles are wrapped again with the offset `offset / 2`.
+*
+* The memory and the time needed to wrap a tile depend on the size of the tile, and not on the size
+* of the whole input. The result is similar to the result of `alpha_wrap_3()`,
+* but not identical, and it is more expensive to compute for inputs that fit in a single tile.
+*
+* \tparam PointRange a model of `RandomAccessContainer` whose value type is the point type
+* \tparam FaceRange a model of `RandomAccessContainer` whose value type is a model of `RandomAccessContainer` whose value type is an integral type
+* \tparam OutputMesh model of `MutableFaceGraph`.
+* \tparam InputNamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+* \tparam OutputNamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+*
+* \param points the input points
+* \param faces the input faces, with each element of the range being a range of indices corresponding to points in `points`
+* \param alpha the value of the parameter `alpha`
+* \param offset the value of the parameter `offset`
+* \param alpha_wrap the output surface mesh
+* \param in_np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+*
+* \cgalNamedParamsBegin
+*   \cgalParamNBegin{point_map}
+*     \cgalParamDescription{a property map associating points to the elements of the point set `points`}
+*     \cgalParamType{a model of `ReadablePropertyMap` whose key type is the value type
+*                    of the iterator of `PointRange` and whose value type is `geom_traits::Point_3`}
+*     \cgalParamDefault{`CGAL::Identity_property_map<geom_traits::Point_3>`}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{geom_traits}
+*     \cgalParamDescription{an instance of a geometric traits class}
+*     \cgalParamType{a class model of `Kernel`}
+*     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+*     \cgalParamExtra{<ul><li>The geometric traits class must be compatible with the point type.</li>
+*                         <li>The geometric traits should use a floating point number type (see \ref aw3_interface).</li></ul>}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{tile_size}
+*     \cgalParamDescription{the length of the edges of the tiles}
+*     \cgalParamType{`double`}
+*     \cgalParamDefault{the maximum of `16 * alpha` and of a quarter of the longest edge of the bounding box of the input}
+*   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{With `CGAL::Parallel_tag`, the tiles are wrapped concurrently, and the memory
+*                     consumption grows with the number of threads.}
+*   \cgalParamNEnd
+* \cgalNamedParamsEnd
+*
+* \param out_np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+*
+* \cgalNamedParamsBegin
+*   \cgalParamNBegin{vertex_point_map}
+*     \cgalParamDescription{a property map associating points to the vertices of `alpha_wrap`}
+*     \cgalParamType{a class model of `ReadWritePropertyMap` with `boost::graph_traits<OutputMesh>::%vertex_descriptor`
+*                    as key type and `%Point_3` as value type}
+*     \cgalParamDefault{`boost::get(CGAL::vertex_point, alpha_wrap)`}
+*     \cgalParamExtra{If this parameter is omitted, an internal property map for `CGAL::vertex_point_t`
+*                     must be available in `OutputMesh`.}
+*   \cgalParamNEnd
+* \cgalNamedParamsEnd
+*
+* \pre The elements of `faces` are triangles.
+* \pre `alpha` and `offset` are strictly positive values.
+*
+* \sa `CGAL::alpha_wrap_3()`
+*/
+template <typename PointRange, typename FaceRange, typename OutputMesh,
+          typename InputNamedParameters, typename OutputNamedParameters>
+void tiled_alpha_wrap_3(const PointRange& points,
+                        const FaceRange& faces,
+                        const double alpha,
+                        const double offset,
+                        OutputMesh& alpha_wrap,
+                        const InputNamedParameters& in_np,
+                        const OutputNamedParameters& out_np)
+{
+  namespace PMP = Polygon_mesh_processing;
+
+  using parameters::get_parameter;
+  using parameters::choose_parameter;
+
+  using NP_helper = Point_set_processing_3_np_helper<PointRange, InputNamedParameters>;
+  using Geom_traits = typename NP_helper::Geom_traits;
+  using Point_map = typename NP_helper::Const_point_map;
+  using Point_3 = typename Geom_traits::Point_3;
+  using Triangle_3 = typename Geom_traits::Triangle_3;
+  using Iso_cuboid_3 = typename Geom_traits::Iso_cuboid_3;
+
+  using Oracle = Alpha_wraps_3::internal::Triangle_soup_oracle<Geom_traits>;
+  using AW3 = Alpha_wraps_3::internal::Alpha_wrapper_3<Oracle>;
+  using Tile_mesh = Surface_mesh<Point_3>;
+  using Soup_triangle = std::array<std::size_t, 3>;
+
+  using Face = typename boost::range_value<FaceRange>::type;
+
+  using Concurrency_tag = typename internal_np::Lookup_named_param_def<
+                            internal_np::concurrency_tag_t,
+                            InputNamedParameters,
+                            Sequential_tag
+                          >::type;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!std::is_same<Concurrency_tag, Parallel_tag>::value,
+                "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  CGAL_precondition(alpha > 0 && offset > 0);
+
+  Geom_traits gt = choose_parameter<Geom_traits>(get_parameter(in_np, internal_np::geom_traits));
+  Point_map pm = NP_helper::get_const_point_map(points, in_np);
+
+  typename Geom_traits::Construct_triangle_3 triangle = gt.construct_triangle_3_object();
+  typename Geom_traits::Construct_iso_cuboid_3 iso_cuboid = gt.construct_iso_cuboid_3_object();
+
+  clear(alpha_wrap);
+  if(faces.empty())
+    return;
+
+  Bbox_3 bbox;
+  for(const auto& p : points)
+    bbox += get(pm, p).bbox();
+
+  const double longest_extent = (std::max)({ bbox.xmax() - bbox.xmin(),
+                                             bbox.ymax() - bbox.ymin(),
+                                             bbox.zmax() - bbox.zmin() });
+  const double default_tile_size = (std::max)(16. * alpha, longest_extent / 4.);
+  const double tile_size = choose_parameter(get_parameter(in_np, internal_np::tile_size), default_tile_size);
+  CGAL_precondition(tile_size > 0);
+
+  const double margin = 2. * alpha + offset;
+
+  // Tiles are indexed along x, then y, then z
+  const std::array<double, 3> origin { bbox.xmin(), bbox.ymin(), bbox.zmin() };
+  std::array<std::size_t, 3> n;
+  for(int i=0; i<3; ++i)
+    n[i] = (std::max)(std::size_t(1), static_cast<std::size_t>(std::ceil((bbox.max(i) - bbox.min(i)) / tile_size)));
+
+  auto tile_range = [&](const double lo, const double hi, const int axis) -> std::pair<std::size_t, std::size_t>
+  {
+    const double f = std::floor((lo - origin[axis]) / tile_size);
+    const double l = std::floor((hi - origin[axis]) / tile_size);
+    return { static_cast<std::size_t>((std::max)(0., f)),
+             (std::min)(n[axis] - 1, static_cast<std::size_t>((std::max)(0., l))) };
+  };
+
+  // Distribute the faces to the tiles, enlarged by the margin, that they intersect
+  std::vector<std::vector<std::size_t> > tile_faces(n[0] * n[1] * n[2]);
+  std::size_t fi = 0;
+  for(const Face& f : faces)
+  {
+    CGAL_precondition(std::distance(std::cbegin(f), std::cend(f)) == 3);
+
+    auto vi = std::cbegin(f);
+    Bbox_3 fb = get(pm, points[*vi++]).bbox();
+    fb += get(pm, points[*vi++]).bbox();
+    fb += get(pm, points[*vi]).bbox();
+
+    const auto rx = tile_range(fb.xmin() - margin, fb.xmax() + margin, 0);
+    const auto ry = tile_range(fb.ymin() - margin, fb.ymax() + margin, 1);
+    const auto rz = tile_range(fb.zmin() - margin, fb.zmax() + margin, 2);
+    for(std::size_t k=rz.first; k<=rz.second; ++k)
+      for(std::size_t j=ry.first; j<=ry.second; ++j)
+        for(std::size_t i=rx.first; i<=rx.second; ++i)
+          tile_faces[(k * n[1] + j) * n[0] + i].push_back(fi);
+
+    ++fi;
+  }
+
+  // The faces of a tile that are shared with another tile cut its wrap. The other faces are
+  // pushed away from the input, so that they do not cut it
+  const double reach = margin + 2. * offset;
+  auto tile_bounds = [&](const std::size_t t, const int axis) -> std::array<double, 2>
+  {
+    const std::size_t i = (axis == 0) ? t % n[0] : (axis == 1) ? (t / n[0]) % n[1] : t / (n[0] * n[1]);
+    const double lo = origin[axis] + i * tile_size;
+    const double hi = origin[axis] + (i + 1) * tile_size; // computed as the `lo` of the next tile
+    return { (i == 0) ? lo - reach : lo,
+             (i + 1 == n[axis]) ? hi + reach : hi };
+  };
+
+  auto is_on_cut = [&](const std::size_t t, const Point_3& p) -> bool
+  {
+    for(int axis=0; axis<3; ++axis)
+    {
+      const std::array<double, 2> bounds = tile_bounds(t, axis);
+      const double c = CGAL::to_double(p[axis]);
+      if(c == bounds[0] || c == bounds[1])
+        return true;
+    }
+    return false;
+  };
+
+  // Clipping and refining round the points that they construct on the cuts: the points close to
+  // a cut are moved back onto it, so that the sections of neighboring tiles are exactly coplanar
+  const double snapping_tolerance = 1e-12 * tile_size;
+  auto snap_to_cuts = [&](const Point_3& p) -> Point_3
+  {
+    std::array<double, 3> c { CGAL::to_double(p.x()), CGAL::to_double(p.y()), CGAL::to_double(p.z()) };
+    bool is_snapped = false;
+    for(int axis=0; axis<3; ++axis)
+    {
+      const double i = std::round((c[axis] - origin[axis]) / tile_size);
+      if(i < 1. || i >= double(n[axis]))
+        continue;
+
+      const double cut = origin[axis] + static_cast<std::size_t>(i) * tile_size;
+      if(c[axis] != cut && std::abs(c[axis] - cut) < snapping_tolerance)
+      {
+        c[axis] = cut;
+        is_snapped = true;
+      }
+    }
+
+    return is_snapped ? Point_3(c[0], c[1], c[2]) : p;
+  };
+
+  // The volume enclosed by the wrap of each tile, restricted to the tile
+  std::vector<Tile_mesh> tile_wraps(tile_faces.size());
+  std::vector<char> is_clipped(tile_faces.size(), 1);
+
+  auto wrap_tile = [&](const std::size_t t)
+  {
+    if(tile_faces[t].empty())
+      return;
+
+    const std::array<double, 2> bx = tile_bounds(t, 0), by = tile_bounds(t, 1), bz = tile_bounds(t, 2);
+    const Iso_cuboid_3 clipping_box = iso_cuboid(Point_3(bx[0], by[0], bz[0]), Point_3(bx[1], by[1], bz[1]));
+
+    const std::size_t i = t % n[0], j = (t / n[0]) % n[1], k = t / (n[0] * n[1]);
+    const double xmin = origin[0] + i * tile_size, ymin = origin[1] + j * tile_size, zmin = origin[2] + k * tile_size;
+    const Iso_cuboid_3 enlarged_tile = iso_cuboid(Point_3(xmin - margin, ymin - margin, zmin - margin),
+                                                  Point_3(xmin + tile_size + margin,
+                                                          ymin + tile_size + margin,
+                                                          zmin + tile_size + margin));
+
+    Tile_mesh& tile_wrap = tile_wraps[t];
+    {
+      std::vector<Triangle_3> triangles;
+      for(const std::size_t tfi : tile_faces[t])
+      {
+        auto vi = std::cbegin(faces[tfi]);
+        const Point_3& p0 = get(pm, points[*vi++]);
+        const Point_3& p1 = get(pm, points[*vi++]);
+        const Point_3& p2 = get(pm, points[*vi]);
+        Alpha_wraps_3::internal::clip_triangle_to_box(triangle(p0, p1, p2), enlarged_tile, triangles, gt);
+      }
+
+      if(triangles.empty())
+        return;
+
+      Oracle oracle(alpha, gt);
+      oracle.add_triangle_soup(triangles);
+      AW3 alpha_wrap_builder(oracle);
+      alpha_wrap_builder(alpha, offset, tile_wrap);
+    }
+
+    // If clipping fails, the whole wrap is kept, and the tiles are merged by wrapping them again
+    Tile_mesh clipped_wrap = tile_wrap;
+    if(PMP::clip(clipped_wrap, clipping_box, CGAL::parameters::clip_volume(true)))
+      tile_wrap = std::move(clipped_wrap);
+    else
+      is_clipped[t] = 0;
+    tile_wrap.collect_garbage();
+
+    if(is_clipped[t])
+    {
+      for(auto v : vertices(tile_wrap))
+        tile_wrap.point(v) = snap_to_cuts(tile_wrap.point(v));
+    }
+  };
+
+  CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, tile_faces.size()),
+                                  [&](const std::size_t t) -> bool
+                                  {
+                                    wrap_tile(t);
+                                    return true;
+                                  });
+
+  tile_faces.clear();
+  tile_faces.shrink_to_fit();
+
+  // The output is the boundary of the union of the volumes of the tiles, which only touch
+  // along the cuts, so that the refinement stays local: the triangles that do not touch
+  // a cut are kept as they are, and the other ones are refined against each other
+  std::vector<Point_3> soup_points;
+  std::vector<Soup_triangle> soup_triangles, cut_triangles;
+  for(std::size_t t=0; t<tile_wraps.size(); ++t)
+  {
+    const Tile_mesh& tile_wrap = tile_wraps[t];
+    const std::size_t first_point = soup_points.size();
+    for(auto v : vertices(tile_wrap))
+      soup_points.push_back(tile_wrap.point(v));
+
+    for(auto f : CGAL::faces(tile_wrap))
+    {
+      auto h = halfedge(f, tile_wrap);
+      const Soup_triangle tr { first_point + std::size_t(source(h, tile_wrap)),
+                               first_point + std::size_t(target(h, tile_wrap)),
+                               first_point + std::size_t(target(next(h, tile_wrap), tile_wrap)) };
+      if(is_clipped[t] && (is_on_cut(t, soup_points[tr[0]]) ||
+                           is_on_cut(t, soup_points[tr[1]]) ||
+                           is_on_cut(t, soup_points[tr[2]])))
+        cut_triangles.push_back(tr);
+      else
+        soup_triangles.push_back(tr);
+    }
+  }
+  tile_wraps.clear();
+
+  const bool are_all_clipped = std::find(is_clipped.begin(), is_clipped.end(), 0) == is_clipped.end();
+  if(are_all_clipped)
+  {
+    const std::size_t first_refined_point = soup_points.size();
+    PMP::autorefine_triangle_soup(soup_points, cut_triangles,
+                                  CGAL::parameters::concurrency_tag(Concurrency_tag())
+                                                   .geom_traits(gt));
+
+    for(std::size_t pi=first_refined_point; pi<soup_points.size(); ++pi)
+      soup_points[pi] = snap_to_cuts(soup_points[pi]);
+
+    const std::size_t first_cut_triangle = soup_triangles.size();
+    soup_triangles.insert(soup_triangles.end(), cut_triangles.begin(), cut_triangles.end());
+    cut_triangles.clear();
+    PMP::merge_duplicate_points_in_polygon_soup(soup_points, soup_triangles);
+
+    // Where the sections of two tiles overlap on a cut, their caps are refined into identical
+    // triangles with opposite orientations, which are inside the union and are discarded.
+    // The triangles that snapping collapsed are discarded as well
+    std::unordered_map<Soup_triangle, std::size_t, boost::hash<Soup_triangle> > shared_triangles;
+    std::vector<char> is_on_boundary(soup_triangles.size(), 1);
+    for(std::size_t ti=first_cut_triangle; ti<soup_triangles.size(); ++ti)
+    {
+      Soup_triangle key = soup_triangles[ti];
+      std::sort(key.begin(), key.end());
+      if(key[0] == key[1] || key[1] == key[2])
+      {
+        is_on_boundary[ti] = 0;
+        continue;
+      }
+
+      auto inserted = shared_triangles.emplace(key, ti);
+      if(inserted.second)
+        continue;
+
+      is_on_boundary[ti] = 0;
+      const std::size_t other = inserted.first->second;
+      if(!PMP::internal::same_orientation(soup_triangles[ti], soup_triangles[other]))
+        is_on_boundary[other] = 0;
+    }
+
+    std::size_t nb_triangles = first_cut_triangle;
+    for(std::size_t ti=first_cut_triangle; ti<soup_triangles.size(); ++ti)
+      if(is_on_boundary[ti])
+        soup_triangles[nb_triangles++] = soup_triangles[ti];
+    soup_triangles.resize(nb_triangles);
+
+    PMP::remove_isolated_points_in_polygon_soup(soup_points, soup_triangles);
+    { std::ofstream dump("/tmp/merged.off"); dump.precision(17); dump << "OFF\n" << soup_points.size() << " " << soup_triangles.size() << " 0\n";
+      for(const auto& p : soup_points) dump << p << "\n";
+      for(const auto& tr : soup_triangles) dump << "3 " << tr[0] << " " << tr[1] << " " << tr[2] << "\n"; }
+
+    // Where the volumes of two tiles only touch along an edge or at a vertex, the boundary
+    // of their union is not a closed surface, and the tiles are merged by wrapping them again
+    if(PMP::orient_polygon_soup(soup_points, soup_triangles) &&
+       PMP::is_polygon_soup_a_polygon_mesh(soup_triangles))
+    {
+      PMP::polygon_soup_to_polygon_mesh(soup_points, soup_triangles, alpha_wrap,
+                                        CGAL::parameters::default_values(), out_np);
+      if(is_closed(alpha_wrap))
+        return;
+
+      clear(alpha_wrap);
+    }
+  }
+  else
+  {
+    soup_triangles.insert(soup_triangles.end(), cut_triangles.begin(), cut_triangles.end());
+  }
+
+  std::cerr << "DBG fallback" << std::endl;
+  // The tiles could not be merged: they are wrapped again
+  std::vector<Triangle_3> triangles;
+  triangles.reserve(soup_triangles.size());
+  for(const Soup_triangle& tr : soup_triangles)
+    triangles.push_back(triangle(soup_points[tr[0]], soup_points[tr[1]], soup_points[tr[2]]));
+
+  Oracle oracle(alpha, gt);
+  oracle.add_triangle_soup(triangles);
+  AW3 alpha_wrap_builder(oracle);
+  alpha_wrap_builder(alpha, offset / 2., alpha_wrap, in_np, out_np);
+}
+
+// Convenience overloads
+template <typename PointRange, typename FaceRange, typename OutputMesh,
+          typename CGAL_NP_TEMPLATE_PARAMETERS>
+void tiled_alpha_wrap_3(const PointRange& points,
+                        const FaceRange& faces,
+                        const double alpha,
+                        const double offset,
+                        OutputMesh& alpha_wrap,
+                        const CGAL_NP_CLASS& in_np)
+{
+  return tiled_alpha_wrap_3(points, faces, alpha, offset, alpha_wrap, in_np, CGAL::parameters::default_values());
+}
+
+template <typename PointRange, typename FaceRange, typename OutputMesh>
+void tiled_alpha_wrap_3(const PointRange& points,
+                        const FaceRange& faces,
+                        const double alpha,
+                        const double offset,
+                        OutputMesh& alpha_wrap)
+{
+  return tiled_alpha_wrap_3(points, faces, alpha, offset, alpha_wrap, CGAL::parameters::default_values());
+}
+
+} // namespace CGAL
+
+#endif // CGAL_TILED_ALPHA_WRAP_3_H
@@ -0,0 +1,167 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/alpha_wrap_3.h>
+#include <CGAL/Alpha_wrap_3/internal/validation.h>
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/IO/polygon_soup_io.h>
+#include <CGAL/Polygon_mesh_processing/orient_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+#include <CGAL/Polygon_mesh_processing/repair_polygon_soup.h>
+
+#include <algorithm>
+#include <iostream>
+#include <vector>
+
+namespace AW3 = CGAL::Alpha_wraps_3;
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+using Kernel = CGAL::Exact_predicates_inexact_constructions_kernel;
+using FT = Kernel::FT;
+using Point_3 = Kernel::Point_3;
+using Vector_3 = Kernel::Vector_3;
+
+using Points = std::vector<Point_3>;
+using Face = std::vector<std::size_t>;
+using Faces = std::vector<Face>;
+
+using Mesh = CGAL::Surface_mesh<Point_3>;
+
+using Oracle = AW3::internal::Triangle_soup_oracle<Kernel>;
+using Wrapper = AW3::internal::Alpha_wrapper_3<Oracle>;
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+// Interrupts the flood fill after a given number of treated gates
+struct Interrupter_visitor
+  : public AW3::internal::Wrapping_default_visitor
+{
+  std::size_t counter = 0;
+  std::size_t max_counter = 0;
+
+  template <typename Wrapper>
+  bool go_further(const Wrapper&)
+  {
+    return (counter++ < max_counter);
+  }
+};
+
+bool have_same_points(const Mesh& m1, const Mesh& m2)
+{
+  if(num_vertices(m1) != num_vertices(m2) || num_faces(m1) != num_faces(m2))
+    return false;
+
+  std::vector<Point_3> pts1(m1.points().begin(), m1.points().end());
+  std::vector<Point_3> pts2(m2.points().begin(), m2.points().end());
+  std::sort(pts1.begin(), pts1.end());
+  std::sort(pts2.begin(), pts2.end());
+
+  return (pts1 == pts2);
+}
+
+void check_wrap(const Mesh& wrap,
+                const Points& points, const Faces& faces,
+                const Mesh& input_mesh,
+                const double alpha, const double offset)
+{
+  assert(AW3::internal::is_valid_wrap(wrap, true /*manifoldness*/));
+  assert(AW3::internal::is_outer_wrap_of_triangle_soup(wrap, points, faces));
+  assert(AW3::internal::has_expected_Hausdorff_distance(wrap, input_mesh, alpha, offset));
+  assert(AW3::internal::check_edge_length(wrap, alpha));
+
+  CGAL_USE(wrap);
+  CGAL_USE(points);
+  CGAL_USE(faces);
+  CGAL_USE(input_mesh);
+  CGAL_USE(alpha);
+  CGAL_USE(offset);
+}
+
+void alpha_wrap_triangle_soup(const std::string& filename,
+                              const double alpha_rel,
+                              const double offset_rel)
+{
+  Points points;
+  Faces faces;
+  bool res = CGAL::IO::read_polygon_soup(filename, points, faces);
+  assert(res);
+  assert(!faces.empty());
+  CGAL_USE(res);
+
+  PMP::repair_polygon_soup(points, faces);
+
+  Mesh input_mesh; // only required for Hausdorff
+  PMP::orient_polygon_soup(points, faces);
+  assert(PMP::is_polygon_soup_a_polygon_mesh(faces));
+  PMP::polygon_soup_to_polygon_mesh(points, faces, input_mesh);
+
+  CGAL::Bbox_3 bbox;
+  for(const Point_3& p : points)
+    bbox += p.bbox();
+
+  const Vector_3 longest_diag = Point_3(bbox.xmax(), bbox.ymax(), bbox.zmax()) -
+                                Point_3(bbox.xmin(), bbox.ymin(), bbox.zmin());
+  const double longest_diag_length = CGAL::to_double(CGAL::approximate_sqrt(longest_diag.squared_length()));
+  const double alpha = longest_diag_length / alpha_rel;
+  const double offset = longest_diag_length / offset_rel;
+
+  std::cout << "===================================================" << std::endl;
+  std::cout << filename << " " << alpha << " " << offset << std::endl;
+
+  Oracle oracle(alpha);
+  oracle.add_triangle_soup(points, faces);
+
+  // Sequential
+  Mesh seq_wrap;
+  Wrapper seq_aw3(oracle);
+  seq_aw3(alpha, offset, seq_wrap);
+  std::cout << "Sequential: " << num_vertices(seq_wrap) << " vertices" << std::endl;
+  check_wrap(seq_wrap, points, faces, input_mesh, alpha, offset);
+
+  // Parallel
+  Mesh par_wrap;
+  Wrapper par_aw3(oracle);
+  par_aw3(alpha, offset, par_wrap, CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()));
+  std::cout << "Parallel: " << num_vertices(par_wrap) << " vertices" << std::endl;
+  check_wrap(par_wrap, points, faces, input_mesh, alpha, offset);
+
+  // The result of the parallel flood fill does not depend on the scheduling of the threads
+  Mesh par_wrap_2;
+  CGAL::alpha_wrap_3(points, faces, alpha, offset, par_wrap_2,
+                     CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()));
+  assert(have_same_points(par_wrap, par_wrap_2));
+
+  // Interrupt the parallel flood fill, and resume it
+  Interrupter_visitor interrupter;
+  interrupter.max_counter = 100;
+
+  Mesh resumed_wrap;
+  Wrapper res_aw3(oracle);
+  res_aw3(alpha, offset, resumed_wrap, CGAL::parameters::visitor(interrupter)
+                                                        .concurrency_tag(CGAL::Parallel_tag()));
+  res_aw3(alpha, offset, resumed_wrap, CGAL::parameters::refine_triangulation(true)
+                                                        .concurrency_tag(CGAL::Parallel_tag()));
+  std::cout << "Resumed: " << num_vertices(resumed_wrap) << " vertices" << std::endl;
+  check_wrap(resumed_wrap, points, faces, input_mesh, alpha, offset);
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+int main(int, char**)
+{
+  std::cout.precision(17);
+  std::cerr.precision(17);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  alpha_wrap_triangle_soup("data/tetrahedron.off", 10, 300);
+  alpha_wrap_triangle_soup("data/plane.off", 10, 100);
+  alpha_wrap_triangle_soup("data/sphere_one_hole.off", 30, 300);
+  alpha_wrap_triangle_soup("data/non_manifold.off", 20, 300);
+  alpha_wrap_triangle_soup("data/three_knives.off", 50, 600);
+#else
+  std::cout << "Warning: TBB is not available, the parallel wrapping is not tested" << std::endl;
+#endif
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,109 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/tiled_alpha_wrap_3.h>
+#include <CGAL/Alpha_wrap_3/internal/validation.h>
+
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/IO/polygon_soup_io.h>
+#include <CGAL/Polygon_mesh_processing/repair_polygon_soup.h>
+
+#include <iostream>
+#include <vector>
+
+namespace AW3 = CGAL::Alpha_wraps_3;
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+using Kernel = CGAL::Exact_predicates_inexact_constructions_kernel;
+using Point_3 = Kernel::Point_3;
+using Vector_3 = Kernel::Vector_3;
+
+using Points = std::vector<Point_3>;
+using Face = std::vector<std::size_t>;
+using Faces = std::vector<Face>;
+
+using Mesh = CGAL::Surface_mesh<Point_3>;
+
+void check_wrap(const Mesh& wrap,
+                const Points& points, const Faces& faces)
+{
+  assert(!is_empty(wrap));
+  assert(AW3::internal::is_valid_wrap(wrap, true /*manifoldness*/));
+  assert(AW3::internal::is_outer_wrap_of_triangle_soup(wrap, points, faces));
+
+  CGAL_USE(wrap);
+  CGAL_USE(points);
+  CGAL_USE(faces);
+}
+
+void tiled_alpha_wrap_triangle_soup(const std::string& filename,
+                                    const double alpha_rel,
+                                    const double offset_rel,
+                                    const double tile_size_rel)
+{
+  Points points;
+  Faces faces;
+  bool res = CGAL::IO::read_polygon_soup(filename, points, faces);
+  assert(res);
+  assert(!faces.empty());
+  CGAL_USE(res);
+
+  PMP::repair_polygon_soup(points, faces);
+
+  CGAL::Bbox_3 bbox;
+  for(const Point_3& p : points)
+    bbox += p.bbox();
+
+  const Vector_3 longest_diag = Point_3(bbox.xmax(), bbox.ymax(), bbox.zmax()) -
+                                Point_3(bbox.xmin(), bbox.ymin(), bbox.zmin());
+  const double longest_diag_length = CGAL::to_double(CGAL::approximate_sqrt(longest_diag.squared_length()));
+  const double alpha = longest_diag_length / alpha_rel;
+  const double offset = longest_diag_length / offset_rel;
+  const double tile_size = longest_diag_length / tile_size_rel;
+
+  std::cout << "===================================================" << std::endl;
+  std::cout << filename << " " << alpha << " " << offset << " " << tile_size << std::endl;
+
+  // Default tiles
+  Mesh wrap;
+  CGAL::tiled_alpha_wrap_3(points, faces, alpha, offset, wrap);
+  std::cout << "Default tiles: " << num_vertices(wrap) << " vertices" << std::endl;
+  check_wrap(wrap, points, faces);
+
+  // Small tiles
+  Mesh small_tiles_wrap;
+  CGAL::tiled_alpha_wrap_3(points, faces, alpha, offset, small_tiles_wrap,
+                           CGAL::parameters::tile_size(tile_size));
+  std::cout << "Small tiles: " << num_vertices(small_tiles_wrap) << " vertices" << std::endl;
+  check_wrap(small_tiles_wrap, points, faces);
+
+  // A single tile
+  Mesh single_tile_wrap;
+  CGAL::tiled_alpha_wrap_3(points, faces, alpha, offset, single_tile_wrap,
+                           CGAL::parameters::tile_size(2 * longest_diag_length));
+  std::cout << "Single tile: " << num_vertices(single_tile_wrap) << " vertices" << std::endl;
+  check_wrap(single_tile_wrap, points, faces);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  Mesh parallel_wrap;
+  CGAL::tiled_alpha_wrap_3(points, faces, alpha, offset, parallel_wrap,
+                           CGAL::parameters::tile_size(tile_size)
+                                            .concurrency_tag(CGAL::Parallel_tag()));
+  std::cout << "Parallel: " << num_vertices(parallel_wrap) << " vertices" << std::endl;
+  check_wrap(parallel_wrap, points, faces);
+#endif
+}
+
+int main(int, char**)
+{
+  std::cout.precision(17);
+  std::cerr.precision(17);
+
+  tiled_alpha_wrap_triangle_soup("data/tetrahedron.off", 10, 300, 3);
+  tiled_alpha_wrap_triangle_soup("data/plane.off", 10, 100, 3);
+  tiled_alpha_wrap_triangle_soup("data/sphere_one_hole.off", 30, 300, 4);
+  tiled_alpha_wrap_triangle_soup("data/non_manifold.off", 20, 300, 3);
+  tiled_alpha_wrap_triangle_soup("data/three_knives.off", 50, 600, 5);
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,110 @@
+// Compares the batched point-location strategies on an arrangement of random
+// segments:
+// - the sequential batched point location (a single surface sweep),
+// - the strip-partitioned parallel batched point location,
+// - individual queries with the walk-along-a-line and the landmarks strategies,
+//   issued sequentially and concurrently.
+//
+// Usage: batched_point_location [#segments] [#queries]
+
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_batched_point_location.h>
+#include <CGAL/Arr_landmarks_point_location.h>
+#include <CGAL/Arr_walk_along_line_point_location.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef CGAL::Arr_segment_traits_2<Kernel>                Traits_2;
+typedef Traits_2::Point_2                                 Point_2;
+typedef Traits_2::X_monotone_curve_2                      Segment_2;
+typedef CGAL::Arrangement_2<Traits_2>                     Arrangement_2;
+typedef CGAL::Arr_point_location_result<Arrangement_2>::Type
+                                                          Result_type;
+typedef std::pair<Point_2, Result_type>                   Query_result;
+typedef CGAL::Arr_landmarks_point_location<Arrangement_2> Landmarks_pl;
+typedef CGAL::Arr_walk_along_line_point_location<Arrangement_2>
+                                                          Walk_pl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag                                Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag                              Concurrency_tag;
+#endif
+
+template <typename Locate>
+void bench(const char* name, Locate locate)
+{
+  std::vector<Query_result> results;
+  CGAL::Real_timer timer;
+  timer.start();
+  locate(std::back_inserter(results));
+  timer.stop();
+  std::cout << name << ": " << timer.time() << " s (" << results.size()
+            << " results)" << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+  const int n_segments = (argc > 1) ? std::atoi(argv[1]) : 500;
+  const int n_queries = (argc > 2) ? std::atoi(argv[2]) : 100000;
+  const double size = 1000;
+
+  CGAL::Random rnd(0);
+  std::vector<Segment_2> segments;
+  for (int i = 0; i < n_segments; ++i) {
+    Point_2 p(rnd.get_double(0, size), rnd.get_double(0, size));
+    Point_2 q(p.x() + rnd.get_double(-size / 10, size / 10),
+              p.y() + rnd.get_double(-size / 10, size / 10));
+    segments.push_back(Segment_2(p, q));
+  }
+
+  CGAL::Real_timer timer;
+  timer.start();
+  Arrangement_2 arr;
+  CGAL::insert(arr, segments.begin(), segments.end());
+  timer.stop();
+  std::cout << "Arrangement: " << arr.number_of_vertices() << " vertices, "
+            << arr.number_of_edges() << " edges, " << arr.number_of_faces()
+            << " faces (" << timer.time() << " s)." << std::endl;
+
+  std::vector<Point_2> points;
+  for (int i = 0; i < n_queries; ++i)
+    points.push_back(Point_2(rnd.get_double(0, size),
+                             rnd.get_double(0, size)));
+  std::cout << points.size() << " queries" << std::endl;
+
+  bench("Sequential sweep", [&](auto oi)
+        { CGAL::locate(arr, points.begin(), points.end(), oi); });
+  bench("Parallel strip sweeps", [&](auto oi)
+        { CGAL::locate<Concurrency_tag>(arr, points.begin(), points.end(), oi); });
+
+  Walk_pl walk_pl(arr);
+  bench("Walk, sequential queries", [&](auto oi)
+        { CGAL::locate<CGAL::Sequential_tag>(walk_pl, points.begin(),
+                                              points.end(), oi); });
+  bench("Walk, concurrent queries", [&](auto oi)
+        { CGAL::locate<Concurrency_tag>(walk_pl, points.begin(),
+                                        points.end(), oi); });
+
+  timer.reset();
+  timer.start();
+  Landmarks_pl landmarks_pl(arr);
+  timer.stop();
+  std::cout << "Landmarks construction: " << timer.time() << " s" << std::endl;
+  bench("Landmarks, sequential queries", [&](auto oi)
+        { CGAL::locate<CGAL::Sequential_tag>(landmarks_pl, points.begin(),
+                                              points.end(), oi); });
+  bench("Landmarks, concurrent queries", [&](auto oi)
+        { CGAL::locate<Concurrency_tag>(landmarks_pl, points.begin(),
+                                        points.end(), oi); });
+
+  return EXIT_SUCCESS;
+}
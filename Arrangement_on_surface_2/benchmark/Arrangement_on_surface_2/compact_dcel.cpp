@@ -0,0 +1,108 @@
+// Compares the default DCEL with the compact DCEL on an arrangement of
+// random segments:
+// - the construction time,
+// - the time it takes to traverse the boundaries of all faces, before and
+//   after the compaction of the compact DCEL.
+//
+// Usage: compact_dcel [#segments] [#traversals]
+
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_compact_dcel.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef CGAL::Arr_segment_traits_2<Kernel>                Traits_2;
+typedef Traits_2::Point_2                                 Point_2;
+typedef Traits_2::X_monotone_curve_2                      Segment_2;
+typedef CGAL::Arrangement_2<Traits_2>                     Arrangement_2;
+typedef CGAL::Arrangement_2<Traits_2, CGAL::Arr_compact_dcel<Traits_2> >
+                                                          Compact_arrangement_2;
+
+// Traverse the boundaries of all faces, visiting the target vertices.
+template <typename Arrangement>
+std::size_t traverse(const Arrangement& arr, int n_traversals)
+{
+  std::size_t n = 0;
+  for (int i = 0; i < n_traversals; ++i) {
+    for (auto fit = arr.faces_begin(); fit != arr.faces_end(); ++fit) {
+      for (auto ccb = fit->outer_ccbs_begin(); ccb != fit->outer_ccbs_end();
+           ++ccb)
+      {
+        auto curr = *ccb;
+        do { n += curr->target()->degree(); } while (++curr != *ccb);
+      }
+      for (auto ccb = fit->inner_ccbs_begin(); ccb != fit->inner_ccbs_end();
+           ++ccb)
+      {
+        auto curr = *ccb;
+        do { n += curr->target()->degree(); } while (++curr != *ccb);
+      }
+    }
+  }
+  return n;
+}
+
+template <typename Arrangement>
+void bench_traversal(const char* name, const Arrangement& arr,
+                     int n_traversals)
+{
+  CGAL::Real_timer timer;
+  timer.start();
+  std::size_t n = traverse(arr, n_traversals);
+  timer.stop();
+  std::cout << name << ": " << timer.time() << " s (" << n << ")"
+            << std::endl;
+}
+
+int main(int argc, char* argv[])
+{
+  const int n_segments = (argc > 1) ? std::atoi(argv[1]) : 20000;
+  const int n_traversals = (argc > 2) ? std::atoi(argv[2]) : 20;
+  const double size = 1000;
+
+  CGAL::Random rnd(0);
+  std::vector<Segment_2> segments;
+  for (int i = 0; i < n_segments; ++i) {
+    Point_2 p(rnd.get_double(0, size), rnd.get_double(0, size));
+    Point_2 q(p.x() + rnd.get_double(-size / 50, size / 50),
+              p.y() + rnd.get_double(-size / 50, size / 50));
+    segments.push_back(Segment_2(p, q));
+  }
+
+  CGAL::Real_timer timer;
+  timer.start();
+  Arrangement_2 arr;
+  CGAL::insert(arr, segments.begin(), segments.end());
+  timer.stop();
+  std::cout << "Default DCEL construction: " << timer.time() << " s ("
+            << arr.number_of_vertices() << " vertices, "
+            << arr.number_of_edges() << " edges, " << arr.number_of_faces()
+            << " faces)" << std::endl;
+
+  timer.reset();
+  timer.start();
+  Compact_arrangement_2 c_arr;
+  CGAL::insert(c_arr, segments.begin(), segments.end());
+  timer.stop();
+  std::cout << "Compact DCEL construction: " << timer.time() << " s"
+            << std::endl;
+
+  bench_traversal("Default DCEL traversal", arr, n_traversals);
+  bench_traversal("Compact DCEL traversal", c_arr, n_traversals);
+
+  timer.reset();
+  timer.start();
+  CGAL::compact(c_arr);
+  timer.stop();
+  std::cout << "Compaction: " << timer.time() << " s" << std::endl;
+  bench_traversal("Compacted DCEL traversal", c_arr, n_traversals);
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,72 @@
+// Compares the sequential aggregated insertion of random segments into an
+// arrangement with the parallel insertion, which computes the subcurves
+// induced by the segments in vertical slabs concurrently.
+//
+// Usage: parallel_insertion [#segments] [#slabs]
+
+#include <iostream>
+#include <vector>
+#include <cstdlib>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_parallel_insertion.h>
+#include <CGAL/Random.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef CGAL::Arr_segment_traits_2<Kernel>                Traits_2;
+typedef Traits_2::Point_2                                 Point_2;
+typedef Traits_2::Curve_2                                 Segment_2;
+typedef CGAL::Arrangement_2<Traits_2>                     Arrangement_2;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag                                Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag                              Concurrency_tag;
+#endif
+
+int main(int argc, char* argv[])
+{
+  const int n_segments = (argc > 1) ? std::atoi(argv[1]) : 20000;
+  const std::size_t n_slabs = (argc > 2) ? std::atoi(argv[2]) : 0;
+  const double size = 1000;
+
+  // Short random segments, like road segments.
+  CGAL::Random rnd(0);
+  std::vector<Segment_2> segments;
+  for (int i = 0; i < n_segments; ++i) {
+    Point_2 p(rnd.get_double(0, size), rnd.get_double(0, size));
+    Point_2 q(p.x() + rnd.get_double(-size / 100, size / 100),
+              p.y() + rnd.get_double(-size / 100, size / 100));
+    segments.push_back(Segment_2(p, q));
+  }
+
+  CGAL::Real_timer timer;
+  {
+    timer.start();
+    Arrangement_2 arr;
+    CGAL::insert(arr, segments.begin(), segments.end());
+    timer.stop();
+    std::cout << "Sequential insertion: " << timer.time() << " s ("
+              << arr.number_of_vertices() << " vertices, "
+              << arr.number_of_edges() << " edges, "
+              << arr.number_of_faces() << " faces)" << std::endl;
+  }
+  {
+    timer.reset();
+    timer.start();
+    Arrangement_2 arr;
+    CGAL::insert<Concurrency_tag>(arr, segments.begin(), segments.end(),
+                                  n_slabs);
+    timer.stop();
+    std::cout << "Parallel insertion: " << timer.time() << " s ("
+              << arr.number_of_vertices() << " vertices, "
+              << arr.number_of_edges() << " edges, "
+              << arr.number_of_faces() << " faces)" << std::endl;
+  }
+
+  return EXIT_SUCCESS;
+}
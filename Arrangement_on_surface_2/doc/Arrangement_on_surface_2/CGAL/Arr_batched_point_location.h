@@ -35,4 +35,62 @@ OutputIterator locate (const Arrangement_2<Traits, Dcel>& arr,
                        InputIterator end,
                        OutputIterator oi);
 
+/*! \ingroup PkgArrangementOnSurface2PointLocation
+ *
+ * performs a batched point-location operation on a given arrangement, possibly
+ * in parallel. If `ConcurrencyTag` is `CGAL::Parallel_tag` and \ref thirdpartyTBB
+ * is available, the query points are sorted and split into vertical strips,
+ * and the strips are swept concurrently; each sweep only involves the
+ * arrangement features whose \f$x\f$-range overlaps its strip. Otherwise, this
+ * function is equivalent to the sequential `locate()` above. The output is
+ * the same as the output of the sequential `locate()`.
+ *
+ * \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *         Possible values are `Sequential_tag`, `Parallel_tag`, and
+ *         `Parallel_if_available_tag`.
+ *
+ * \param arr The arrangement.
+ * \param begin The begin iterator of the container of input points.
+ * \param end The past-the-end iterator of the container of input points.
+ * \param oi The output iterator that points at the output container.
+ * \param number_of_strips The number of strips; if 0, it is chosen according
+ *        to the number of available threads.
+ * \return The past-the-end iterator of the output container.
+ *
+ * \pre The query points lie in the interior of the parameter space.
+ * \pre The geometry traits of `arr` can be used concurrently by several threads.
+ */
+template <typename ConcurrencyTag, typename Traits, typename Dcel,
+typename InputIterator, typename OutputIterator>
+OutputIterator locate (const Arrangement_2<Traits, Dcel>& arr,
+                       InputIterator begin,
+                       InputIterator end,
+                       OutputIterator oi,
+                       std::size_t number_of_strips = 0);
+
+/*! \ingroup PkgArrangementOnSurface2PointLocation
+ *
+ * locates each point of a range using a given point-location object, possibly
+ * in parallel. If `ConcurrencyTag` is `CGAL::Parallel_tag` and \ref thirdpartyTBB
+ * is available, the queries are issued concurrently. Each query result is given
+ * as a pair of the query point and the result of `pl.locate()`; the pairs are
+ * inserted into the output container in the order of the input points.
+ *
+ * \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *         Possible values are `Sequential_tag`, `Parallel_tag`, and
+ *         `Parallel_if_available_tag`.
+ * \tparam PointLocation a model of `ArrangementPointLocation_2`.
+ *
+ * \pre If queries are issued concurrently, `pl.locate()` must be safe to call
+ * from several threads at once. This holds for `Arr_naive_point_location`,
+ * `Arr_walk_along_line_point_location`, and `Arr_landmarks_point_location`,
+ * but not for `Arr_trapezoid_ric_point_location`.
+ */
+template <typename ConcurrencyTag, typename PointLocation,
+typename InputIterator, typename OutputIterator>
+OutputIterator locate (const PointLocation& pl,
+                       InputIterator begin,
+                       InputIterator end,
+                       OutputIterator oi);
+
 } /* namespace CGAL */
@@ -0,0 +1,89 @@
+namespace CGAL {
+
+/*! \ingroup PkgArrangementOnSurface2DCEL
+ *
+ * The `Arr_compact_dcel_base` class is an alternative to `Arr_dcel_base`
+ * that stores the \dcel records in compact containers (see
+ * `Compact_container`), that is, in large blocks of contiguous memory,
+ * instead of allocating every record separately. This reduces the memory
+ * footprint of the \dcel and improves the locality of traversals.
+ *
+ * The records remain at fixed addresses, so handles to the arrangement
+ * features are stable, as long as the features are not removed and the
+ * \dcel is not compacted. Storage for the records can be reserved in advance
+ * with `reserve()`, and `compact()` relocates the records, such that the
+ * halfedges along the boundary of every face and their target vertices are
+ * stored close to each other.
+ *
+ * \cgalModels{ArrangementDcel}
+ *
+ * \sa `Arr_dcel_base<V, H, F>`
+ */
+template <typename V, typename H, typename F>
+class Arr_compact_dcel_base {
+public:
+  /*! reserves storage for `v` vertices, `h` halfedges, and `f` faces. */
+  void reserve(Size v, Size h, Size f);
+
+  /*! relocates all \dcel records into freshly allocated blocks, in the order
+   * of a traversal of the boundaries of the faces. All pointers to the \dcel
+   * records are invalidated.
+   */
+  void compact();
+};
+
+/*! \ingroup PkgArrangementOnSurface2DCEL
+ *
+ * The compact \dcel class, which can be used by the `Arrangement_2`,
+ * `Arr_bounded_planar_topology_traits_2`, `Arr_unb_planar_topology_traits_2`
+ * class templates and other templates instead of `Arr_dcel`. It is
+ * parameterized by a geometry traits type and optionally by a vertex,
+ * halfedge, or face types, exactly as `Arr_dcel`.
+ *
+ * \cgalModels{ArrangementDcelWithRebind}
+ *
+ * \tparam Traits a geometry traits type, which is a model of the
+ *                `ArrangementBasicTraits_2` concept.
+ * \tparam V the vertex type, which is a model of the `ArrangementDcelVertex`
+ *           concept.
+ * \tparam H the halfedge type, which is a model of the
+ *            `ArrangementDcelHalfedge` concept.
+ * \tparam F the face type, which is a model of the `ArrangementDcelFace`
+ *           concept.
+ *
+ * \sa `Arr_compact_dcel_base<V, H, F>`
+ * \sa `Arr_dcel<Traits, V, H, F>`
+ */
+template <typename Traits,
+          typename V = Arr_vertex_base<typename Traits::Point_2>,
+          typename H = Arr_halfedge_base<typename Traits::X_monotone_curve_2>,
+          typename F = Arr_face_base>
+class Arr_compact_dcel : public Arr_compact_dcel_base<V, H, F> {
+};
+
+/*! \ingroup PkgArrangementOnSurface2Funcs
+ *
+ * reserves storage in the \dcel of `arr` for the given numbers of vertices,
+ * edges, and faces.
+ *
+ * \pre The \dcel of `arr` is an instance of `Arr_compact_dcel`.
+ */
+template <typename GeometryTraits, typename TopologyTraits>
+void reserve(Arrangement_on_surface_2<GeometryTraits, TopologyTraits>& arr,
+             std::size_t number_of_vertices,
+             std::size_t number_of_edges,
+             std::size_t number_of_faces);
+
+/*! \ingroup PkgArrangementOnSurface2Funcs
+ *
+ * compacts the \dcel of `arr`, such that the records along the boundary of
+ * every face are stored close to each other. All handles and iterators of
+ * `arr` are invalidated. The observers attached to `arr` are notified as if
+ * `arr` were assigned, so point-location objects and index maps are rebuilt.
+ *
+ * \pre The \dcel of `arr` is an instance of `Arr_compact_dcel`.
+ */
+template <typename GeometryTraits, typename TopologyTraits>
+void compact(Arrangement_on_surface_2<GeometryTraits, TopologyTraits>& arr);
+
+} /* end namespace CGAL */
@@ -1081,6 +1081,44 @@ void insert(Arrangement_on_surface_2<GeometryTraits, TopologyTraits>& arr,
             InputIterator first,
             InputIterator last);
 
+/*! Aggregately inserts the curves or \f$ x\f$-monotone curves in the range
+ * `[first,last)` into the arrangement `arr`, possibly in parallel.
+ *
+ * If `ConcurrencyTag` is `Parallel_tag`, \ref thirdpartyTBB is available, and
+ * `arr` is empty, the plane is divided into `number_of_slabs` vertical slabs,
+ * each containing roughly the same number of left endpoints of the
+ * \f$ x\f$-monotone subcurves. The intersections of the subcurves within each
+ * slab are computed concurrently, and the resulting interior-disjoint
+ * subcurves are inserted into `arr` by a single sweep that does not compute
+ * intersections. Otherwise, this function is equivalent to the function
+ * above.
+ *
+ * This function is defined in the header file `CGAL/Arr_parallel_insertion.h`.
+ *
+ * \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+ *         Possible values are `Sequential_tag`, `Parallel_tag`, and
+ *         `Parallel_if_available_tag`.
+ * \param arr the target arrangement.
+ * \param first the iterator to the first element in the range of curves.
+ * \param last the past-the-end iterator of the range of curves.
+ * \param number_of_slabs the number of slabs; if 0, it is chosen according
+ *        to the number of available threads.
+ *
+ * \pre The geometry traits of `arr` can be used concurrently by several threads.
+ *
+ * \cgalHeading{Requirements}
+ *
+ * The instantiated `GeometryTraits` class must model the
+ * `ArrangementTraits_2` concept.
+ */
+template <typename ConcurrencyTag,
+          typename GeometryTraits, typename TopologyTraits,
+          typename InputIterator>
+void insert(Arrangement_on_surface_2<GeometryTraits, TopologyTraits>& arr,
+            InputIterator first,
+            InputIterator last,
+            std::size_t number_of_slabs = 0);
+
 /// @}
 
 /*! \ingroup PkgArrangementOnSurface2Funcs
@@ -86,6 +86,14 @@ public:
 
   /*! Notify that a global operation was completed. */
   void notify_after_global_change() { p_arr->_notify_after_global_change(); }
+
+  /*! Notify that the arrangement is about to be reassigned, e.g., when all
+   * its DCEL records are relocated.
+   */
+  void notify_before_assign() { p_arr->_notify_before_assign(*p_arr); }
+
+  /*! Notify that the arrangement has been reassigned. */
+  void notify_after_assign() { p_arr->_notify_after_assign(); }
   //@}
 
   /// \name Local operations and predicates for the arrangement.
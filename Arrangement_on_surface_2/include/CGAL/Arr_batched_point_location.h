@@ -20,18 +20,104 @@
 
 #include <CGAL/Arrangement_on_surface_2.h>
 #include <CGAL/No_intersection_surface_sweep_2.h>
+#include <CGAL/Arr_point_location_result.h>
 #include <CGAL/Arr_point_location/Arr_batched_point_location_traits_2.h>
 #include <CGAL/Surface_sweep_2/No_overlap_event.h>
 #include <CGAL/Surface_sweep_2/No_overlap_subcurve.h>
 #include <CGAL/Surface_sweep_2/Arr_batched_pl_ss_visitor.h>
 
+#include <CGAL/tags.h>
+
 #include <vector>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
 #include <boost/type_traits.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/task_arena.h>
+#endif
+
 namespace CGAL {
 
 namespace Ss2 = Surface_sweep_2;
 
+namespace internal {
+
+/*! Sweep a range of query points over a given set of arrangement curves and
+ * isolated points.
+ * \pre The curves are of type `Arr_batched_point_location_traits_2<Arr>::
+ *      X_monotone_curve_2` and each is associated with the halfedge directed
+ *      from right to left; the isolated points are of type
+ *      `Arr_batched_point_location_traits_2<Arr>::Point_2` and each is
+ *      associated with its vertex.
+ * \pre The curves and isolated points include all the features of `arr` that
+ *      may lie above or below any of the query points.
+ */
+template <typename GeometryTraits_2, typename TopologyTraits,
+          typename XCurvesIterator, typename IsoPointsIterator,
+          typename PointsIterator, typename OutputIterator>
+OutputIterator
+batched_point_location_sweep
+(const Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr,
+ XCurvesIterator xcurves_begin, XCurvesIterator xcurves_end,
+ IsoPointsIterator iso_points_begin, IsoPointsIterator iso_points_end,
+ PointsIterator points_begin, PointsIterator points_end,
+ OutputIterator oi)
+{
+  typedef GeometryTraits_2                              Gt2;
+  typedef TopologyTraits                                Tt;
+  typedef OutputIterator                                Output_iterator;
+
+  // Arrangement types:
+  typedef Arrangement_on_surface_2<Gt2, Tt>             Arr;
+  typedef typename Arr::Allocator                       Allocator;
+
+  // Surface sweep types
+  typedef Arr_batched_point_location_traits_2<Arr>      Bgt2;
+  typedef Ss2::No_overlap_event<Bgt2, Allocator>        Bpl_event;
+  typedef Ss2::No_overlap_subcurve<Bgt2, Bpl_event, Allocator>
+                                                        Bpl_curve;
+  typedef typename Tt::template Batched_point_location_helper<Bpl_event,
+                                                              Bpl_curve>
+                                                        Bpl_helper;
+  typedef Arr_batched_pl_ss_visitor<Bpl_helper, Output_iterator>
+                                                        Bpl_visitor;
+
+  // Obtain an extended traits-class object.
+  const Gt2* geom_traits = arr.geometry_traits();
+
+  /* We would like to avoid copy construction of the geometry traits class.
+   * Copy construction is undesired, because it may results with data
+   * duplication or even data loss.
+   *
+   * If the type Bgt2 is the same as the type Gt2, use a reference to Gt2
+   * to avoid constructing a new one.  Otherwise, instantiate a local variable
+   * of the former and provide the later as a single parameter to the
+   * constructor.
+   *
+   * Use the form 'A a(*b);' and not ''A a = b;' to handle the case where A has
+   * only an implicit constructor, (which takes *b as a parameter).
+   */
+  std::conditional_t<std::is_same_v<Gt2, Bgt2>, const Bgt2&, Bgt2>
+    ex_traits(*geom_traits);
+
+  // Define the sweep-line visitor and perform the sweep.
+  Bpl_visitor visitor(&arr, oi);
+  Ss2::No_intersection_surface_sweep_2<Bpl_visitor>
+    surface_sweep(&ex_traits, &visitor);
+  surface_sweep.sweep(xcurves_begin, xcurves_end,         // Curves.
+                      iso_points_begin, iso_points_end,   // Action points.
+                      points_begin, points_end);          // Query points.
+
+  return oi;
+}
+
+} // namespace internal
+
 /*! Issue a batched point-location query on an arrangement given an input
  * range of points.
  * \param arr The arrangement.
@@ -54,7 +140,6 @@ locate(const Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr,
 {
   typedef GeometryTraits_2                              Gt2;
   typedef TopologyTraits                                Tt;
-  typedef OutputIterator                                Output_iterator;
 
   // Arrangement types:
   typedef Arrangement_on_surface_2<Gt2, Tt>             Arr;
@@ -62,19 +147,9 @@ locate(const Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr,
   typedef typename Arr::Vertex_const_iterator           Vertex_const_iterator;
   typedef typename Arr::Edge_const_iterator             Edge_const_iterator;
   typedef typename Arr::Vertex_const_handle             Vertex_const_handle;
-  typedef typename Arr::Halfedge_const_handle           Halfedge_const_handle;
-  typedef typename Arr::Allocator                       Allocator;
 
   // Surface sweep types
   typedef Arr_batched_point_location_traits_2<Arr>      Bgt2;
-  typedef Ss2::No_overlap_event<Bgt2, Allocator>        Bpl_event;
-  typedef Ss2::No_overlap_subcurve<Bgt2, Bpl_event, Allocator>
-                                                        Bpl_curve;
-  typedef typename Tt::template Batched_point_location_helper<Bpl_event,
-                                                              Bpl_curve>
-                                                        Bpl_helper;
-  typedef Arr_batched_pl_ss_visitor<Bpl_helper, Output_iterator>
-                                                        Bpl_visitor;
   typedef typename Bgt2::X_monotone_curve_2             Bpl_x_monotone_curve_2;
   typedef typename Bgt2::Point_2                        Bpl_point_2;
 
@@ -104,32 +179,251 @@ locate(const Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr,
     }
   }
 
-  // Obtain an extended traits-class object.
-  const Gt2* geom_traits = arr.geometry_traits();
+  return internal::batched_point_location_sweep(arr,
+                                                xcurves_vec.begin(),
+                                                xcurves_vec.end(),
+                                                iso_pts_vec.begin(),
+                                                iso_pts_vec.end(),
+                                                points_begin, points_end, oi);
+}
 
-  /* We would like to avoid copy construction of the geometry traits class.
-   * Copy construction is undesired, because it may results with data
-   * duplication or even data loss.
-   *
-   * If the type Bgt2 is the same as the type Gt2, use a reference to Gt2
-   * to avoid constructing a new one.  Otherwise, instantiate a local variable
-   * of the former and provide the later as a single parameter to the
-   * constructor.
-   *
-   * Use the form 'A a(*b);' and not ''A a = b;' to handle the case where A has
-   * only an implicit constructor, (which takes *b as a parameter).
-   */
-  std::conditional_t<std::is_same_v<Gt2, Bgt2>, const Bgt2&, Bgt2>
-    ex_traits(*geom_traits);
+/*! Issue a batched point-location query on an arrangement given an input
+ * range of points, possibly in parallel.
+ *
+ * If `ConcurrencyTag` is `Parallel_tag` and TBB is available, the query
+ * points are sorted and split into vertical strips of roughly equal size.
+ * Each strip is swept independently and concurrently with the others, and
+ * only the arrangement edges and isolated vertices whose \f$x\f$-range
+ * overlaps the strip participate in its sweep. Otherwise, this function is
+ * equivalent to the sequential `locate()` above.
+ *
+ * \param arr The arrangement.
+ * \param points_begin An iterator for the range of query points.
+ * \param points_end A past-the-end iterator for the range of query points.
+ * \param oi Output: An output iterator for the query results.
+ * \param number_of_strips The number of strips to split the query points
+ *        into; if 0, it is chosen according to the number of threads.
+ * \pre The value-types of PointsIterator and OutputIterator are as in the
+ *      sequential `locate()` above. The query points lie in the interior of
+ *      the parameter space.
+ * \pre The geometric traits of `arr` can be copied and used concurrently by
+ *      several threads.
+ * The results are reported in increasing xy-lexicographic order of the query
+ * points, exactly as with the sequential `locate()`.
+ */
+template <typename ConcurrencyTag,
+          typename GeometryTraits_2, typename TopologyTraits,
+          typename PointsIterator, typename OutputIterator>
+OutputIterator
+locate(const Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr,
+       PointsIterator points_begin, PointsIterator points_end,
+       OutputIterator oi, std::size_t number_of_strips = 0)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                "Parallel_tag is enabled but TBB is unavailable.");
+  CGAL_USE(number_of_strips);
+#else
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+    typedef GeometryTraits_2                            Gt2;
+    typedef TopologyTraits                              Tt;
 
-  // Define the sweep-line visitor and perform the sweep.
-  Bpl_visitor visitor(&arr, oi);
-  Ss2::No_intersection_surface_sweep_2<Bpl_visitor>
-    surface_sweep(&ex_traits, &visitor);
-  surface_sweep.sweep(xcurves_vec.begin(), xcurves_vec.end(), // Curves.
-                      iso_pts_vec.begin(), iso_pts_vec.end(), // Action points.
-                      points_begin, points_end);              // Query points.
+    // Arrangement types:
+    typedef Arrangement_on_surface_2<Gt2, Tt>           Arr;
+    typedef typename Arr::Halfedge_const_handle         Halfedge_const_handle;
+    typedef typename Arr::Vertex_const_handle           Vertex_const_handle;
+    typedef typename Arr::Vertex_const_iterator         Vertex_const_iterator;
+    typedef typename Arr::Edge_const_iterator           Edge_const_iterator;
+    typedef typename Gt2::Point_2                       Point_2;
+    typedef typename Arr_point_location_result<Arr>::Type
+                                                        Result_type;
+    typedef std::pair<Point_2, Result_type>             Query_result;
+
+    // Surface sweep types
+    typedef Arr_batched_point_location_traits_2<Arr>    Bgt2;
+    typedef typename Bgt2::X_monotone_curve_2           Bpl_x_monotone_curve_2;
+    typedef typename Bgt2::Point_2                      Bpl_point_2;
 
+    // A strip smaller than this is not worth a sweep of its own.
+    const std::size_t min_points_per_strip = 256;
+
+    std::vector<Point_2> points(points_begin, points_end);
+    const std::size_t n = points.size();
+    if (number_of_strips == 0)
+      number_of_strips =
+        4 * static_cast<std::size_t>(tbb::this_task_arena::max_concurrency());
+    number_of_strips = (std::min)(number_of_strips, n / min_points_per_strip);
+    if (number_of_strips < 2)
+      return locate(arr, points.begin(), points.end(), oi);
+
+    const Gt2* geom_traits = arr.geometry_traits();
+    auto compare_xy = geom_traits->compare_xy_2_object();
+    auto compare_x = geom_traits->compare_x_2_object();
+
+    // Sort the query points and split them into vertical strips. Strip j
+    // consists of the points in [strip_begin[j], strip_begin[j+1]).
+    tbb::parallel_sort(points.begin(), points.end(),
+                       [&](const Point_2& p, const Point_2& q)
+                       { return compare_xy(p, q) == SMALLER; });
+    // The sweep reports coinciding query points once, so a strip never
+    // starts in the middle of a run of equal points; empty strips are
+    // dropped.
+    std::vector<std::size_t> strip_begin;
+    strip_begin.reserve(number_of_strips + 1);
+    strip_begin.push_back(0);
+    for (std::size_t j = 1; j < number_of_strips; ++j) {
+      std::size_t b = (std::max)(j * n / number_of_strips, strip_begin.back());
+      while ((b < n) && (b > 0) &&
+             (compare_xy(points[b-1], points[b]) == EQUAL))
+        ++b;
+      if ((b < n) && (b > strip_begin.back())) strip_begin.push_back(b);
+    }
+    strip_begin.push_back(n);
+    const std::size_t k = strip_begin.size() - 1;
+
+    // Return the range [lo, hi) of strips whose x-range overlaps the x-range
+    // bounded by the given vertices. A vertex that does not lie in the
+    // interior of the parameter space leaves the range unbounded.
+    auto overlapping_strips =
+      [&](Vertex_const_handle left, Vertex_const_handle right)
+    {
+      std::size_t lo = 0, hi = k;
+      if ((left->parameter_space_in_x() == ARR_INTERIOR) &&
+          (left->parameter_space_in_y() == ARR_INTERIOR))
+      {
+        // The first strip whose rightmost point is not to the left of `left`.
+        std::size_t a = 0, b = k;
+        while (a < b) {
+          std::size_t m = (a + b) / 2;
+          if (compare_x(points[strip_begin[m+1] - 1], left->point()) == SMALLER)
+            a = m + 1;
+          else b = m;
+        }
+        lo = a;
+      }
+      if ((right->parameter_space_in_x() == ARR_INTERIOR) &&
+          (right->parameter_space_in_y() == ARR_INTERIOR))
+      {
+        // The first strip whose leftmost point is to the right of `right`.
+        std::size_t a = 0, b = k;
+        while (a < b) {
+          std::size_t m = (a + b) / 2;
+          if (compare_x(points[strip_begin[m]], right->point()) != LARGER)
+            a = m + 1;
+          else b = m;
+        }
+        hi = a;
+      }
+      return std::make_pair(lo, hi);
+    };
+
+    // Distribute the arrangement edges among the strips they overlap. Each
+    // curve is associated with the halfedge directed from right to left, so
+    // its target is the left endpoint and its source is the right endpoint.
+    std::vector<std::vector<Bpl_x_monotone_curve_2> > strip_xcurves(k);
+    for (Edge_const_iterator eit = arr.edges_begin();
+         eit != arr.edges_end(); ++eit)
+    {
+      Halfedge_const_handle he =
+        (eit->direction() == ARR_RIGHT_TO_LEFT) ? eit : eit->twin();
+      auto range = overlapping_strips(he->target(), he->source());
+      for (std::size_t j = range.first; j < range.second; ++j)
+        strip_xcurves[j].push_back(Bpl_x_monotone_curve_2(eit->curve(), he));
+    }
+
+    // Distribute the isolated vertices in the same manner.
+    std::vector<std::vector<Bpl_point_2> > strip_iso_pts(k);
+    for (Vertex_const_iterator vit = arr.vertices_begin();
+         vit != arr.vertices_end(); ++vit)
+    {
+      if (! vit->is_isolated()) continue;
+      Vertex_const_handle iso_v = vit;
+      auto range = overlapping_strips(iso_v, iso_v);
+      for (std::size_t j = range.first; j < range.second; ++j)
+        strip_iso_pts[j].push_back(Bpl_point_2(vit->point(), iso_v));
+    }
+
+    // Sweep the strips concurrently, and report their results in order.
+    std::vector<std::vector<Query_result> > strip_results(k);
+    tbb::parallel_for(std::size_t(0), k, [&](std::size_t j)
+    {
+      strip_results[j].reserve(strip_begin[j+1] - strip_begin[j]);
+      internal::batched_point_location_sweep
+        (arr,
+         strip_xcurves[j].begin(), strip_xcurves[j].end(),
+         strip_iso_pts[j].begin(), strip_iso_pts[j].end(),
+         points.begin() + strip_begin[j], points.begin() + strip_begin[j+1],
+         std::back_inserter(strip_results[j]));
+    });
+
+    for (const auto& results : strip_results)
+      oi = std::copy(results.begin(), results.end(), oi);
+    return oi;
+  }
+#endif
+
+  return locate(arr, points_begin, points_end, oi);
+}
+
+/*! Locate each point of an input range using a given point-location object,
+ * possibly in parallel.
+ *
+ * If `ConcurrencyTag` is `Parallel_tag` and TBB is available, the queries are
+ * issued concurrently. Unlike the sweep-based `locate()`, which must process
+ * the entire arrangement, this is the method of choice when a point-location
+ * structure that answers each query in sub-linear time (e.g., landmarks) is
+ * already available.
+ *
+ * \param pl The point-location object.
+ * \param points_begin An iterator for the range of query points.
+ * \param points_end A past-the-end iterator for the range of query points.
+ * \param oi Output: An output iterator for the query results.
+ * \pre The value-type of PointsIterator is Arrangement::Point_2,
+ *      and the value-type of OutputIterator is is pair<Point_2, Result>,
+ *      where Result is `PointLocation::result_type`.
+ * \pre If `ConcurrencyTag` is `Parallel_tag`, `pl.locate()` may be called
+ *      concurrently by several threads. This holds for the naive, the
+ *      walk-along-a-line, and the landmarks strategies, but not for the
+ *      trapezoidal-map strategy, which updates internal state while it
+ *      answers queries.
+ * The results are reported in the order of the input points.
+ */
+template <typename ConcurrencyTag, typename PointLocation,
+          typename PointsIterator, typename OutputIterator>
+auto locate(const PointLocation& pl,
+            PointsIterator points_begin, PointsIterator points_end,
+            OutputIterator oi)
+  -> decltype(pl.locate(*points_begin), OutputIterator(oi))
+{
+  typedef typename std::iterator_traits<PointsIterator>::value_type
+                                                        Point_2;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                "Parallel_tag is enabled but TBB is unavailable.");
+#else
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+    typedef decltype(pl.locate(*points_begin))          Result_type;
+
+    std::vector<Point_2> points(points_begin, points_end);
+    std::vector<Result_type> results(points.size());
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, points.size()),
+                      [&](const tbb::blocked_range<std::size_t>& r)
+    {
+      for (std::size_t i = r.begin(); i != r.end(); ++i)
+        results[i] = pl.locate(points[i]);
+    });
+
+    for (std::size_t i = 0; i < points.size(); ++i)
+      *oi++ = std::make_pair(points[i], results[i]);
+    return oi;
+  }
+#endif
+
+  for (; points_begin != points_end; ++points_begin) {
+    const Point_2& p = *points_begin;
+    *oi++ = std::make_pair(p, pl.locate(p));
+  }
   return oi;
 }
 
@@ -0,0 +1,566 @@
+// Copyright (c) 2025 Tel-Aviv University (Israel).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_ARR_COMPACT_DCEL_H
+#define CGAL_ARR_COMPACT_DCEL_H
+
+#include <CGAL/license/Arrangement_on_surface_2.h>
+
+#include <CGAL/disable_warnings.h>
+
+/*! \file
+ * The definition of the Arr_compact_dcel<Traits> class, a DCEL that stores
+ * its records in contiguous blocks of memory.
+ */
+
+#include <CGAL/Arr_dcel_base.h>
+#include <CGAL/Arr_accessor.h>
+#include <CGAL/Arrangement_on_surface_2.h>
+#include <CGAL/Compact_container.h>
+
+#include <unordered_map>
+#include <utility>
+
+namespace CGAL {
+
+namespace internal {
+
+/*! The DCEL records are not linked into in-place lists when they are stored
+ * in a compact container, so the forward link is used to store the pointer
+ * (and the type bits) that the container squats on.
+ */
+template <typename T>
+struct Arr_compact_dcel_container_traits {
+  static void* pointer(const T& t) { return t.next_link; }
+  static void set_pointer(T& t, void* p) { t.next_link = static_cast<T*>(p); }
+};
+
+} // namespace internal
+
+template <class V, class H, class F>
+struct Compact_container_traits<Arr_vertex<V,H,F> > :
+    internal::Arr_compact_dcel_container_traits<Arr_vertex<V,H,F> > {};
+
+template <class V, class H, class F>
+struct Compact_container_traits<Arr_halfedge<V,H,F> > :
+    internal::Arr_compact_dcel_container_traits<Arr_halfedge<V,H,F> > {};
+
+template <class V, class H, class F>
+struct Compact_container_traits<Arr_face<V,H,F> > :
+    internal::Arr_compact_dcel_container_traits<Arr_face<V,H,F> > {};
+
+template <class V, class H, class F>
+struct Compact_container_traits<Arr_outer_ccb<V,H,F> > :
+    internal::Arr_compact_dcel_container_traits<Arr_outer_ccb<V,H,F> > {};
+
+template <class V, class H, class F>
+struct Compact_container_traits<Arr_inner_ccb<V,H,F> > :
+    internal::Arr_compact_dcel_container_traits<Arr_inner_ccb<V,H,F> > {};
+
+template <class V, class H, class F>
+struct Compact_container_traits<Arr_isolated_vertex<V,H,F> > :
+    internal::Arr_compact_dcel_container_traits<Arr_isolated_vertex<V,H,F> > {};
+
+/*! \class
+ * A DCEL class that stores its records in compact containers, namely in
+ * large blocks of contiguous memory, instead of allocating every record
+ * separately. The records are the ones of Arr_dcel_base, so pointers to
+ * them remain stable as long as they are not erased or the DCEL is compacted.
+ *
+ * The two twin halfedges of an edge are always allocated and freed together,
+ * and the blocks of the halfedge container have even sizes, so twin
+ * halfedges are consecutive in the halfedge container, as required by the
+ * edge iterators.
+ */
+template <class V, class H, class F,
+          class Allocator = CGAL_ALLOCATOR(int) >
+class Arr_compact_dcel_base {
+public:
+  // Define the vertex, halfedge and face types.
+  typedef Arr_compact_dcel_base<V,H,F,Allocator> Self;
+  typedef Arr_vertex<V,H,F>                      Vertex;
+  typedef Arr_halfedge<V,H,F>                    Halfedge;
+  typedef Arr_face<V,H,F>                        Face;
+  typedef Arr_outer_ccb<V,H,F>                   Outer_ccb;
+  typedef Arr_inner_ccb<V,H,F>                   Inner_ccb;
+  typedef Arr_isolated_vertex<V,H,F>             Isolated_vertex;
+
+  typedef Inner_ccb                              Hole;
+
+protected:
+  typedef std::allocator_traits<Allocator>       Allocator_traits;
+
+  // The DCEL records are stored in six compact containers.
+  typedef Compact_container<Vertex,
+    typename Allocator_traits::template rebind_alloc<Vertex> >
+                                                 Vertex_container;
+  typedef Compact_container<Halfedge,
+    typename Allocator_traits::template rebind_alloc<Halfedge> >
+                                                 Halfedge_container;
+  typedef Compact_container<Face,
+    typename Allocator_traits::template rebind_alloc<Face> >
+                                                 Face_container;
+  typedef Compact_container<Outer_ccb,
+    typename Allocator_traits::template rebind_alloc<Outer_ccb> >
+                                                 Outer_ccb_container;
+  typedef Compact_container<Inner_ccb,
+    typename Allocator_traits::template rebind_alloc<Inner_ccb> >
+                                                 Inner_ccb_container;
+  typedef Compact_container<Isolated_vertex,
+    typename Allocator_traits::template rebind_alloc<Isolated_vertex> >
+                                                 Iso_vert_container;
+
+public:
+  typedef typename Halfedge_container::size_type         Size;
+  typedef typename Halfedge_container::size_type         size_type;
+  typedef typename Halfedge_container::difference_type   difference_type;
+  typedef typename Halfedge_container::difference_type   Difference;
+  typedef std::bidirectional_iterator_tag                iterator_category;
+
+protected:
+  Vertex_container    vertices;             // The vertices container.
+  Halfedge_container  halfedges;            // The halfedges container.
+  Face_container      faces;                // The faces container.
+  Outer_ccb_container out_ccbs;             // The outer CCBs.
+  Inner_ccb_container in_ccbs;              // The inner CCBs.
+  Iso_vert_container  iso_verts;            // The isolated vertices.
+
+public:
+  // Definitions of iterators.
+  typedef typename Vertex_container::iterator         Vertex_iterator;
+  typedef typename Halfedge_container::iterator       Halfedge_iterator;
+  typedef typename Face_container::iterator           Face_iterator;
+  typedef CGAL::N_step_adaptor_derived<Halfedge_iterator, 2>
+                                                      Edge_iterator;
+  typedef typename Inner_ccb_container::iterator      Inner_ccb_iterator;
+
+  // Definitions of const iterators.
+  typedef typename Vertex_container::const_iterator   Vertex_const_iterator;
+  typedef typename Halfedge_container::const_iterator Halfedge_const_iterator;
+  typedef typename Face_container::const_iterator     Face_const_iterator;
+  typedef CGAL::N_step_adaptor_derived<Halfedge_const_iterator, 2>
+                                                      Edge_const_iterator;
+
+private:
+  // Copy constructor - not supported.
+  Arr_compact_dcel_base(const Self&);
+
+  // Assignment operator - not supported.
+  Self& operator=(const Self&);
+
+public:
+  /// \name Construction and destruction.
+  //@{
+  /*! Default constructor. */
+  Arr_compact_dcel_base() {}
+
+  /*! Destructor. */
+  ~Arr_compact_dcel_base() { delete_all(); }
+  //@}
+
+  /// \name The DCEL size.
+  //@{
+  /*! Obtain the number of DCEL vertices. */
+  Size size_of_vertices() const { return (vertices.size()); }
+
+  /*! Obtain the number of DCEL halfedges (twice the number of edges). */
+  Size size_of_halfedges() const { return (halfedges.size()); }
+
+  /*! Obtain the number of DCEL faces. */
+  Size size_of_faces() const { return (faces.size()); }
+
+  /*! Obtain the number of outer CCBs. */
+  Size size_of_outer_ccbs() const { return (out_ccbs.size()); }
+
+  /*! Obtain the number of inner CCBs. */
+  Size size_of_inner_ccbs() const { return (in_ccbs.size()); }
+
+  /*! Obtain the number of isolated vertices. */
+  Size size_of_isolated_vertices() const { return (iso_verts.size()); }
+  //@}
+
+  /// \name Obtaining iterators.
+  //@{
+  Vertex_iterator   vertices_begin()  { return vertices.begin(); }
+  Vertex_iterator   vertices_end()    { return vertices.end(); }
+  Iterator_range<Prevent_deref<Vertex_iterator> >
+  vertex_handles()
+  {
+    return make_prevent_deref_range(vertices_begin(), vertices_end());
+  }
+  Halfedge_iterator halfedges_begin() { return halfedges.begin();}
+  Halfedge_iterator halfedges_end()   { return halfedges.end(); }
+  Iterator_range<Prevent_deref<Halfedge_iterator> >
+  halfedge_handles()
+  {
+    return make_prevent_deref_range(halfedges_begin(), halfedges_end());
+  }
+  Face_iterator     faces_begin()     { return faces.begin(); }
+  Face_iterator     faces_end()       { return faces.end(); }
+  Iterator_range<Prevent_deref<Face_iterator> >
+  face_handles()
+  {
+    return make_prevent_deref_range(faces_begin(), faces_end());
+  }
+  Edge_iterator     edges_begin()     { return halfedges.begin(); }
+  Edge_iterator     edges_end()       { return halfedges.end(); }
+  Iterator_range<Prevent_deref<Edge_iterator> >
+  edge_handles()
+  {
+    return make_prevent_deref_range(edges_begin(), edges_end());
+  }
+
+  Inner_ccb_iterator inner_ccbs_begin() { return in_ccbs.begin(); }
+  Inner_ccb_iterator inner_ccbs_end()   { return in_ccbs.end(); }
+  //@}
+
+  /// \name Obtaining constant iterators.
+  //@{
+  Vertex_const_iterator   vertices_begin() const { return vertices.begin(); }
+  Vertex_const_iterator   vertices_end() const { return vertices.end(); }
+  Iterator_range<Prevent_deref<Vertex_const_iterator> >
+  vertex_handles() const
+  {
+    return make_prevent_deref_range(vertices_begin(), vertices_end());
+  }
+  Halfedge_const_iterator halfedges_begin() const { return halfedges.begin(); }
+  Halfedge_const_iterator halfedges_end() const { return halfedges.end(); }
+  Iterator_range<Prevent_deref<Halfedge_const_iterator> >
+  halfedge_handles() const
+  {
+    return make_prevent_deref_range(halfedges_begin(), halfedges_end());
+  }
+  Face_const_iterator     faces_begin() const { return faces.begin(); }
+  Face_const_iterator     faces_end() const { return faces.end(); }
+  Iterator_range<Prevent_deref<Face_const_iterator> >
+  face_handles() const
+  {
+    return make_prevent_deref_range(faces_begin(), faces_end());
+  }
+  Edge_const_iterator     edges_begin() const { return halfedges.begin(); }
+  Edge_const_iterator     edges_end() const { return halfedges.end(); }
+  Iterator_range<Prevent_deref<Edge_const_iterator> >
+  edge_handles() const
+  {
+    return make_prevent_deref_range(edges_begin(), edges_end());
+  }
+  //@}
+
+  /// \name Memory management.
+  //@{
+  /*! Reserve storage for the given numbers of vertices, halfedges and faces,
+   * so that they can be created without further allocations.
+   */
+  void reserve(size_type v, size_type h, size_type f)
+  {
+    vertices.reserve(v);
+    halfedges.reserve(h);
+    faces.reserve(f);
+    out_ccbs.reserve(f);
+    in_ccbs.reserve(f);
+  }
+
+  /*! Relocate all DCEL records into freshly allocated blocks, dropping the
+   * free slots left by erased records. The records are arranged in the order
+   * of a traversal of the face boundaries, such that the halfedges of every
+   * CCB and their target vertices are stored close to each other.
+   * All pointers to the DCEL records are invalidated.
+   */
+  void compact()
+  {
+    Self dup;
+    dup.assign(*this);
+    std::swap(vertices, dup.vertices);
+    std::swap(halfedges, dup.halfedges);
+    std::swap(faces, dup.faces);
+    std::swap(out_ccbs, dup.out_ccbs);
+    std::swap(in_ccbs, dup.in_ccbs);
+    std::swap(iso_verts, dup.iso_verts);
+  }
+  //@}
+
+  // \name Creation of new DCEL features.
+  //@{
+  /*! Create a new vertex. */
+  Vertex* new_vertex() { return &(*vertices.emplace()); }
+
+  /*! Create a new pair of opposite halfedges. */
+  Halfedge* new_edge()
+  {
+    // Create two new halfedges (consecutive in the container).
+    Halfedge* h1 = &(*halfedges.emplace());
+    Halfedge* h2 = &(*halfedges.emplace());
+
+    // Pair them together.
+    h1->set_opposite(h2);
+    h2->set_opposite(h1);
+
+    return (h1);
+  }
+
+  /*! Create a new face. */
+  Face* new_face() { return &(*faces.emplace()); }
+
+  /*! Create a new outer CCB. */
+  Outer_ccb* new_outer_ccb() { return &(*out_ccbs.emplace()); }
+
+  /*! Create a new inner CCB. */
+  Inner_ccb* new_inner_ccb() { return &(*in_ccbs.emplace()); }
+
+  /*! Create a new isolated vertex. */
+  Isolated_vertex* new_isolated_vertex() { return &(*iso_verts.emplace()); }
+  //@}
+
+  /// \name Deletion of DCEL features.
+  //@{
+  /*! Delete an existing vertex. */
+  void delete_vertex(Vertex* v) { vertices.erase(Vertex_iterator(v)); }
+
+  /*! Delete an existing pair of opposite halfedges. */
+  void delete_edge(Halfedge* h)
+  {
+    // Both slots are pushed onto the free list together, so the next new
+    // edge reuses them as a consecutive pair.
+    Halfedge* h_opp = h->opposite();
+    halfedges.erase(Halfedge_iterator(h));
+    halfedges.erase(Halfedge_iterator(h_opp));
+  }
+
+  /*! Delete an existing face. */
+  void delete_face(Face* f) { faces.erase(Face_iterator(f)); }
+
+  /*! Delete an existing outer CCB. */
+  void delete_outer_ccb(Outer_ccb* oc)
+  { out_ccbs.erase(typename Outer_ccb_container::iterator(oc)); }
+
+  /*! Delete an existing inner CCB. */
+  void delete_inner_ccb(Inner_ccb* ic) { in_ccbs.erase(Inner_ccb_iterator(ic)); }
+
+  /*! Delete an existing isolated vertex. */
+  void delete_isolated_vertex(Isolated_vertex* iv)
+  { iso_verts.erase(typename Iso_vert_container::iterator(iv)); }
+
+  /*! Delete all DCEL features. */
+  void delete_all()
+  {
+    vertices.clear();
+    halfedges.clear();
+    faces.clear();
+    out_ccbs.clear();
+    in_ccbs.clear();
+    iso_verts.clear();
+  }
+  //@}
+
+  /*! Assign our DCEL the contents of another DCEL.
+   * The duplicated records are created in the order of a traversal of the
+   * boundaries of the faces of the other DCEL.
+   */
+  void assign(const Self& dcel)
+  {
+    // Clear the current contents of the DCEL.
+    delete_all();
+    reserve(dcel.size_of_vertices(), dcel.size_of_halfedges(),
+            dcel.size_of_faces());
+
+    // Create duplicated of the DCEL features and map the features of the
+    // given DCEL to their corresponding duplicates.
+    std::unordered_map<const Vertex*, Vertex*> v_map;
+    std::unordered_map<const Halfedge*, Halfedge*> he_map;
+    std::unordered_map<const Isolated_vertex*, Isolated_vertex*> iv_map;
+    v_map.reserve(dcel.size_of_vertices());
+    he_map.reserve(dcel.size_of_halfedges());
+    iv_map.reserve(dcel.size_of_isolated_vertices());
+
+    auto dup_vertex = [&](const Vertex* v) {
+      Vertex*& dup_v = v_map[v];
+      if (dup_v == nullptr) {
+        dup_v = new_vertex();
+        dup_v->assign(*v);
+      }
+      return dup_v;
+    };
+
+    auto dup_edge = [&](const Halfedge* h) {
+      Halfedge*& dup_h = he_map[h];
+      if (dup_h == nullptr) {
+        dup_h = new_edge();
+        dup_h->assign(*h);
+        dup_h->opposite()->assign(*(h->opposite()));
+        he_map[h->opposite()] = dup_h->opposite();
+      }
+      return dup_h;
+    };
+
+    // Go over the boundary of every face and duplicate the halfedges along
+    // each CCB together with their target vertices, followed by the
+    // isolated vertices inside the face.
+    Face_const_iterator fit;
+    for (fit = dcel.faces_begin(); fit != dcel.faces_end(); ++fit) {
+      const Face* f = &(*fit);
+      Face* dup_f = new_face();
+      dup_f->assign(*f);
+      dup_f->set_unbounded(f->is_unbounded());
+      dup_f->set_fictitious(f->is_fictitious());
+
+      typename Face::Outer_ccb_const_iterator out_ccb_it;
+      for (out_ccb_it = f->outer_ccbs_begin();
+           out_ccb_it != f->outer_ccbs_end(); ++out_ccb_it)
+      {
+        const Halfedge* hccb = *out_ccb_it;
+        Outer_ccb* dup_oc = new_outer_ccb();
+        dup_oc->set_face(dup_f);
+        dup_f->add_outer_ccb(dup_oc, dup_edge(hccb));
+
+        const Halfedge* h = hccb;
+        do {
+          Halfedge* dup_h = dup_edge(h);
+          dup_h->set_vertex(dup_vertex(h->vertex()));
+          dup_h->set_outer_ccb(dup_oc);
+          h = h->next();
+        } while (h != hccb);
+      }
+
+      typename Face::Inner_ccb_const_iterator in_ccb_it;
+      for (in_ccb_it = f->inner_ccbs_begin();
+           in_ccb_it != f->inner_ccbs_end(); ++in_ccb_it)
+      {
+        const Halfedge* hccb = *in_ccb_it;
+        Inner_ccb* dup_ic = new_inner_ccb();
+        dup_ic->set_face(dup_f);
+        dup_f->add_inner_ccb(dup_ic, dup_edge(hccb));
+
+        const Halfedge* h = hccb;
+        do {
+          Halfedge* dup_h = dup_edge(h);
+          dup_h->set_vertex(dup_vertex(h->vertex()));
+          dup_h->set_inner_ccb(dup_ic);
+          h = h->next();
+        } while (h != hccb);
+      }
+
+      typename Face::Isolated_vertex_const_iterator iso_vert_it;
+      for (iso_vert_it = f->isolated_vertices_begin();
+           iso_vert_it != f->isolated_vertices_end(); ++iso_vert_it)
+      {
+        const Vertex* iso_vert = &(*iso_vert_it);
+        Vertex* dup_iso_vert = dup_vertex(iso_vert);
+        Isolated_vertex* dup_iv = new_isolated_vertex();
+        iv_map[iso_vert->isolated_vertex()] = dup_iv;
+
+        dup_iv->set_face(dup_f);
+        dup_f->add_isolated_vertex(dup_iv, dup_iso_vert);
+      }
+    }
+
+    // Duplicate the vertices that are not reachable from the faces (if any).
+    Vertex_const_iterator vit;
+    for (vit = dcel.vertices_begin(); vit != dcel.vertices_end(); ++vit)
+      dup_vertex(&(*vit));
+
+    // Update the vertex records.
+    for (vit = dcel.vertices_begin(); vit != dcel.vertices_end(); ++vit) {
+      const Vertex* v = &(*vit);
+      Vertex* dup_v = v_map[v];
+
+      if (v->is_isolated())
+        dup_v->set_isolated_vertex(iv_map[v->isolated_vertex()]);
+      else if (v->halfedge() != nullptr)
+        dup_v->set_halfedge(he_map[v->halfedge()]);
+    }
+
+    // Update the halfedge records. Note that the incident CCBs were set
+    // during the traversal.
+    Halfedge_const_iterator hit;
+    for (hit = dcel.halfedges_begin(); hit != dcel.halfedges_end(); ++hit) {
+      const Halfedge* h = &(*hit);
+      Halfedge* dup_h = he_map[h];
+
+      dup_h->set_vertex(v_map[h->vertex()]);
+      dup_h->set_next(he_map[h->next()]);
+      dup_h->set_direction(h->direction());
+    }
+  }
+};
+
+/*! \class
+ * The arrangement DCEL class that stores its records in contiguous blocks.
+ * The Traits parameters corresponds to a geometric traits class, which
+ * defines the Point_2 and X_monotone_curve_2 types.
+ */
+template <typename Traits,
+          typename V = Arr_vertex_base<typename Traits::Point_2>,
+          typename H = Arr_halfedge_base<typename Traits::X_monotone_curve_2>,
+          typename F = Arr_face_base>
+class Arr_compact_dcel : public Arr_compact_dcel_base<V, H, F> {
+public:
+  /*! \struct
+   * An auxiliary structure for rebinding the DCEL with a new traits class.
+   */
+  template <typename T>
+  struct rebind {
+  private:
+    using Pnt = typename T::Point_2;
+    using Xcv = typename T::X_monotone_curve_2;
+    using Rebind_v = typename V::template rebind<Pnt>;
+    using V_other = typename Rebind_v::other;
+    using Rebind_h = typename H::template rebind<Xcv>;
+    using H_other = typename Rebind_h::other;
+
+  public:
+    using other = Arr_compact_dcel<T, V_other, H_other, F>;
+  };
+
+  /*! Default constructor. */
+  Arr_compact_dcel() {}
+
+  /*! Destructor. */
+  virtual ~Arr_compact_dcel() {}
+};
+
+/*! Reserve storage in the DCEL of an arrangement for the given numbers of
+ * vertices, edges and faces.
+ * \pre The DCEL of the arrangement is an Arr_compact_dcel.
+ */
+template <typename GeometryTraits_2, typename TopologyTraits>
+void reserve(Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr,
+             std::size_t number_of_vertices,
+             std::size_t number_of_edges,
+             std::size_t number_of_faces)
+{
+  arr.topology_traits()->dcel().reserve(number_of_vertices,
+                                        2 * number_of_edges,
+                                        number_of_faces);
+}
+
+/*! Compact the DCEL of an arrangement, such that the records along the
+ * boundary of every face are stored close to each other.
+ * All handles and iterators of the arrangement are invalidated. The attached
+ * observers are notified as if the arrangement were assigned.
+ * \pre The DCEL of the arrangement is an Arr_compact_dcel.
+ */
+template <typename GeometryTraits_2, typename TopologyTraits>
+void compact(Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr)
+{
+  typedef Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>
+                                                        Arrangement;
+  Arr_accessor<Arrangement> arr_access(arr);
+
+  arr_access.notify_before_assign();
+  arr.topology_traits()->dcel().compact();
+  arr_access.dcel_updated();
+  arr_access.notify_after_assign();
+}
+
+} // namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif
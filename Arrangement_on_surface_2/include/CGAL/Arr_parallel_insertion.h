@@ -0,0 +1,360 @@
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_ARR_PARALLEL_INSERTION_H
+#define CGAL_ARR_PARALLEL_INSERTION_H
+
+#include <CGAL/license/Arrangement_on_surface_2.h>
+
+#include <CGAL/disable_warnings.h>
+
+/*! \file
+ * Aggregated insertion of a range of curves into an empty arrangement, where
+ * the computation of the intersections is distributed among several threads.
+ */
+
+#include <CGAL/Arrangement_on_surface_2.h>
+#include <CGAL/Arr_accessor.h>
+#include <CGAL/Arr_batched_point_location.h>
+#include <CGAL/Arr_curve_data_traits_2.h>
+#include <CGAL/Surface_sweep_2.h>
+#include <CGAL/Surface_sweep_2/Default_visitor.h>
+#include <CGAL/Surface_sweep_2/Surface_sweep_2_utils.h>
+#include <CGAL/tags.h>
+
+#include <vector>
+#include <algorithm>
+#include <iterator>
+#include <type_traits>
+#include <utility>
+#include <variant>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/parallel_sort.h>
+#include <tbb/task_arena.h>
+#endif
+
+namespace CGAL {
+
+namespace internal {
+
+/*! \class
+ * A surface-sweep visitor that reports the maximal x-monotone subcurves,
+ * which are pairwise disjoint in their interiors, induced by a set of
+ * x-monotone curves. Overlapping subcurves are reported once.
+ */
+template <typename GeometryTraits_2, typename OutputIterator>
+class Arr_slab_subcurves_visitor :
+  public Ss2::Default_visitor<Arr_slab_subcurves_visitor<GeometryTraits_2,
+                                                         OutputIterator>,
+                              GeometryTraits_2>
+{
+  typedef Arr_slab_subcurves_visitor<GeometryTraits_2, OutputIterator>
+                                                        Self;
+  typedef Ss2::Default_visitor<Self, GeometryTraits_2>  Base;
+
+public:
+  typedef typename GeometryTraits_2::X_monotone_curve_2 X_monotone_curve_2;
+  typedef typename Base::Subcurve                       Subcurve;
+
+protected:
+  OutputIterator m_out;                 // The output subcurves.
+
+public:
+  Arr_slab_subcurves_visitor(OutputIterator out) : m_out(out) {}
+
+  void add_subcurve(const X_monotone_curve_2& cv, Subcurve* /* sc */)
+  { *m_out++ = cv; }
+};
+
+/*! A functor that merges the indices of overlapping input curves. */
+struct Arr_min_index_merge {
+  std::size_t operator()(std::size_t i1, std::size_t i2) const
+  { return (std::min)(i1, i2); }
+};
+
+} // namespace internal
+
+/*! Insert a range of curves into an arrangement (aggregated insertion),
+ * possibly in parallel.
+ *
+ * If `ConcurrencyTag` is `Parallel_tag`, TBB is available, and the
+ * arrangement is empty, the curves are subdivided into x-monotone subcurves
+ * that are pairwise disjoint in their interiors as follows. The plane is split
+ * into vertical slabs with roughly the same number of curves each. The
+ * subcurves induced by the curves that overlap each slab are computed by a
+ * surface sweep, and the slabs are swept concurrently. A subcurve whose
+ * endpoints both lie in the slab is final; a subcurve that crosses the slab
+ * boundaries is obtained by splitting its input curve at the endpoints
+ * computed by the sweeps of the slabs that contain them. The subcurves are
+ * then inserted into the arrangement by a single sweep that computes no
+ * intersections. Otherwise, this function is equivalent to the sequential
+ * `insert()`.
+ *
+ * \param arr The arrangement.
+ * \param begin An iterator for the range of curves.
+ * \param end A past-the-end iterator for the range of curves.
+ * \param number_of_slabs The number of slabs; if 0, it is chosen according to
+ *        the number of threads.
+ * \pre The value-type of InputIterator is either Arrangement::Curve_2 or
+ *      Arrangement::X_monotone_curve_2.
+ * \pre The geometric traits of `arr` models the concept
+ *      `ArrangementTraits_2`, and it can be copied and used concurrently by
+ *      several threads.
+ * Curves with ends that do not lie in the interior of the parameter space are
+ * supported only by the sequential insertion, which is used if any exists.
+ */
+template <typename ConcurrencyTag,
+          typename GeometryTraits_2, typename TopologyTraits,
+          typename InputIterator>
+void insert(Arrangement_on_surface_2<GeometryTraits_2, TopologyTraits>& arr,
+            InputIterator begin, InputIterator end,
+            std::size_t number_of_slabs = 0)
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert(!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                "Parallel_tag is enabled but TBB is unavailable.");
+  CGAL_USE(number_of_slabs);
+#else
+  if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value &&
+      arr.is_empty())
+  {
+    typedef GeometryTraits_2                            Gt2;
+    typedef TopologyTraits                              Tt;
+
+    typedef Arrangement_on_surface_2<Gt2, Tt>           Arr;
+    typedef typename Arr::Traits_adaptor_2              Traits_adaptor_2;
+    typedef typename Gt2::Point_2                       Point_2;
+    typedef typename Gt2::X_monotone_curve_2            X_monotone_curve_2;
+
+    // Each subcurve is tagged with the (smallest) index of the input
+    // x-monotone curve that contains it.
+    typedef Arr_curve_data_traits_2<Gt2, std::size_t,
+                                    internal::Arr_min_index_merge>
+                                                        Data_traits_2;
+    typedef typename Data_traits_2::X_monotone_curve_2  Data_x_monotone_curve_2;
+    typedef std::back_insert_iterator<std::vector<Data_x_monotone_curve_2> >
+                                                        Subcurves_iterator;
+    typedef internal::Arr_slab_subcurves_visitor<Data_traits_2,
+                                                 Subcurves_iterator>
+                                                        Visitor;
+    typedef Ss2::Surface_sweep_2<Visitor>               Surface_sweep;
+
+    // A slab with fewer curves is not worth a sweep of its own.
+    const std::size_t min_curves_per_slab = 256;
+
+    // Subdivide the input curves into x-monotone curves and isolated points.
+    const Traits_adaptor_2* traits =
+      static_cast<const Traits_adaptor_2*>(arr.geometry_traits());
+    std::vector<X_monotone_curve_2> xcurves;
+    std::vector<Point_2> iso_points;
+    Ss2::make_x_monotone(begin, end,
+                         std::back_inserter(xcurves),
+                         std::back_inserter(iso_points),
+                         traits);
+    const std::size_t n = xcurves.size();
+
+    auto ps_x = traits->parameter_space_in_x_2_object();
+    auto ps_y = traits->parameter_space_in_y_2_object();
+    auto is_interior = [&](const X_monotone_curve_2& xcv, Arr_curve_end ce)
+    {
+      return (ps_x(xcv, ce) == ARR_INTERIOR) && (ps_y(xcv, ce) == ARR_INTERIOR);
+    };
+    bool all_interior = true;
+    for (const auto& xcv : xcurves) {
+      if (! is_interior(xcv, ARR_MIN_END) || ! is_interior(xcv, ARR_MAX_END)) {
+        all_interior = false;
+        break;
+      }
+    }
+
+    if (number_of_slabs == 0)
+      number_of_slabs =
+        static_cast<std::size_t>(tbb::this_task_arena::max_concurrency());
+    number_of_slabs = (std::min)(number_of_slabs, n / min_curves_per_slab);
+
+    if (all_interior && (number_of_slabs >= 2)) {
+      auto min_vertex = traits->construct_min_vertex_2_object();
+      auto max_vertex = traits->construct_max_vertex_2_object();
+      auto compare_xy = traits->compare_xy_2_object();
+      auto equal = traits->equal_2_object();
+      auto split = traits->split_2_object();
+      auto xy_less = [&](const Point_2& p, const Point_2& q)
+      { return compare_xy(p, q) == SMALLER; };
+
+      // Choose the slab boundaries, such that the left endpoints are evenly
+      // distributed among the slabs. Slab j contains the points p such that
+      // bounds[j-1] <= p < bounds[j] in xy-lexicographic order.
+      std::vector<Point_2> left_ends(n);
+      tbb::parallel_for(std::size_t(0), n, [&](std::size_t i)
+                        { left_ends[i] = min_vertex(xcurves[i]); });
+      tbb::parallel_sort(left_ends.begin(), left_ends.end(), xy_less);
+      std::vector<Point_2> bounds;
+      for (std::size_t j = 1; j < number_of_slabs; ++j) {
+        const Point_2& b = left_ends[j * n / number_of_slabs];
+        if (bounds.empty() || xy_less(bounds.back(), b)) bounds.push_back(b);
+      }
+      std::vector<Point_2>().swap(left_ends);
+      const std::size_t k = bounds.size() + 1;
+      auto slab_of = [&](const Point_2& p) -> std::size_t
+      {
+        return std::upper_bound(bounds.begin(), bounds.end(), p, xy_less) -
+          bounds.begin();
+      };
+
+      // Assign each x-monotone curve to all slabs it overlaps.
+      std::vector<std::vector<Data_x_monotone_curve_2> > slab_xcurves(k);
+      for (std::size_t i = 0; i < n; ++i) {
+        const std::size_t first = slab_of(min_vertex(xcurves[i]));
+        const std::size_t last = slab_of(max_vertex(xcurves[i]));
+        for (std::size_t j = first; j <= last; ++j)
+          slab_xcurves[j].push_back(Data_x_monotone_curve_2(xcurves[i], i));
+      }
+
+      // A record of a subcurve that crosses a slab boundary: the index of
+      // the input curve, the endpoint that lies in the slab, and whether it
+      // is the left endpoint.
+      struct Crossing {
+        std::size_t index;
+        Point_2 point;
+        bool is_left;
+      };
+
+      // Sweep the slabs concurrently. Keep the subcurves whose endpoints lie
+      // in the slab, and record the endpoints of the subcurves that cross the
+      // slab boundaries.
+      std::vector<std::vector<X_monotone_curve_2> > slab_subcurves(k);
+      std::vector<std::vector<Crossing> > slab_crossings(k);
+      tbb::parallel_for(std::size_t(0), k, [&](std::size_t j)
+      {
+        std::vector<Data_x_monotone_curve_2> subcurves;
+        {
+          Data_traits_2 data_traits(*arr.geometry_traits());
+          Visitor visitor(std::back_inserter(subcurves));
+          Surface_sweep surface_sweep(&data_traits, &visitor);
+          surface_sweep.sweep(slab_xcurves[j].begin(), slab_xcurves[j].end());
+        }
+        std::vector<Data_x_monotone_curve_2>().swap(slab_xcurves[j]);
+
+        for (const auto& sc : subcurves) {
+          const Point_2& left = min_vertex(sc);
+          const Point_2& right = max_vertex(sc);
+          const bool left_in = (slab_of(left) == j);
+          const bool right_in = (slab_of(right) == j);
+          if (left_in && right_in)
+            slab_subcurves[j].push_back(sc);
+          else if (left_in)
+            slab_crossings[j].push_back(Crossing{sc.data(), left, true});
+          else if (right_in)
+            slab_crossings[j].push_back(Crossing{sc.data(), right, false});
+        }
+      });
+
+      // Pair the crossing records of each input curve. Along the curve, the
+      // left endpoint of every crossing subcurve is followed by its right
+      // endpoint; a right endpoint precedes a coinciding left endpoint.
+      std::vector<Crossing> crossings;
+      for (auto& cr : slab_crossings) {
+        crossings.insert(crossings.end(), cr.begin(), cr.end());
+        std::vector<Crossing>().swap(cr);
+      }
+      tbb::parallel_sort(crossings.begin(), crossings.end(),
+                         [&](const Crossing& c1, const Crossing& c2)
+                         {
+                           if (c1.index != c2.index) return c1.index < c2.index;
+                           Comparison_result res =
+                             compare_xy(c1.point, c2.point);
+                           if (res != EQUAL) return res == SMALLER;
+                           return ! c1.is_left && c2.is_left;
+                         });
+      CGAL_assertion(crossings.size() % 2 == 0);
+
+      // Split the input curves at the endpoints of the crossing subcurves.
+      std::vector<X_monotone_curve_2> subcurves(crossings.size() / 2);
+      tbb::parallel_for(std::size_t(0), subcurves.size(), [&](std::size_t i)
+      {
+        const Crossing& left = crossings[2*i];
+        const Crossing& right = crossings[2*i+1];
+        CGAL_assertion(left.is_left && ! right.is_left &&
+                       (left.index == right.index));
+        X_monotone_curve_2 xcv = xcurves[left.index];
+        X_monotone_curve_2 c1, c2;
+        if (! equal(left.point, min_vertex(xcv))) {
+          split(xcv, left.point, c1, c2);
+          xcv = c2;
+        }
+        if (! equal(right.point, max_vertex(xcv))) {
+          split(xcv, right.point, c1, c2);
+          xcv = c1;
+        }
+        subcurves[i] = xcv;
+      });
+      std::vector<Crossing>().swap(crossings);
+      std::vector<X_monotone_curve_2>().swap(xcurves);
+
+      // Construct the arrangement of the interior-disjoint subcurves.
+      for (auto& sc : slab_subcurves) {
+        subcurves.insert(subcurves.end(), sc.begin(), sc.end());
+        std::vector<X_monotone_curve_2>().swap(sc);
+      }
+      insert_non_intersecting_curves(arr, subcurves.begin(), subcurves.end());
+      if (iso_points.empty()) return;
+
+      // Locate the isolated points by a (parallel) batched point location.
+      // A point in the interior of a face becomes an isolated vertex of this
+      // face; as this does not modify any other feature, the located faces
+      // remain valid. The few points that lie on an edge or a vertex are
+      // inserted afterwards, each with its own point location.
+      typedef typename Arr::Face_const_handle           Face_const_handle;
+      typedef typename Arr_point_location_result<Arr>::Type
+                                                        Result_type;
+      typedef std::pair<Point_2, Result_type>           Query_result;
+      std::vector<Query_result> located;
+      located.reserve(iso_points.size());
+      locate<Parallel_tag>(arr, iso_points.begin(), iso_points.end(),
+                           std::back_inserter(located));
+      std::vector<Point_2>().swap(iso_points);
+
+      // The results are sorted in xy-lexicographic order, so duplicate
+      // points are consecutive; each one is inserted once.
+      std::vector<Point_2> non_face_points;
+      Arr_accessor<Arr> arr_access(arr);
+      arr_access.notify_before_global_change();
+      for (std::size_t i = 0; i < located.size(); ++i) {
+        const Point_2& p = located[i].first;
+        if ((i > 0) && equal(located[i-1].first, p)) continue;
+        const Face_const_handle* fh =
+          std::get_if<Face_const_handle>(&(located[i].second));
+        if (fh != nullptr)
+          arr.insert_in_face_interior(p, arr.non_const_handle(*fh));
+        else
+          non_face_points.push_back(p);
+      }
+      arr_access.notify_after_global_change();
+      for (const auto& p : non_face_points) insert_point(arr, p);
+      return;
+    }
+
+    // Sequential fallback; the input curves are already subdivided.
+    Arr_accessor<Arr> arr_access(arr);
+    arr_access.notify_before_global_change();
+    insert_empty(arr, xcurves.begin(), xcurves.end(),
+                 iso_points.begin(), iso_points.end());
+    arr_access.notify_after_global_change();
+    return;
+  }
+#endif
+
+  insert(arr, begin, end);
+}
+
+} // namespace CGAL
+
+#include <CGAL/enable_warnings.h>
+
+#endif
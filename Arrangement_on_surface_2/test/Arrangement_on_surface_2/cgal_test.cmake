@@ -1440,6 +1440,7 @@ compile_and_run(test_unbounded_rational_insertion)
 compile_and_run(test_unbounded_rational_direct_insertion)
 compile_and_run(test_rational_function_traits_2)
 compile_and_run(test_iso_verts)
+compile_and_run(test_compact_dcel)
 
 compile_and_run(test_vert_ray_shoot_vert_segments)
 
@@ -1461,6 +1462,14 @@ test_point_location_dynamic_segments()
 test_batched_point_location_segments()
 test_batched_point_location_linear()
 test_batched_point_location_spherical_arcs()
+compile_and_run(test_parallel_batched_point_location)
+if(TARGET CGAL::TBB_support)
+  target_link_libraries(test_parallel_batched_point_location CGAL::TBB_support)
+endif()
+compile_and_run(test_parallel_insertion)
+if(TARGET CGAL::TBB_support)
+  target_link_libraries(test_parallel_insertion CGAL::TBB_support)
+endif()
 
 test_vertical_decomposition_segments()
 test_vertical_decomposition_linear()
@@ -0,0 +1,212 @@
+// Testing the compact DCEL: arrangements that use it must be identical to
+// arrangements that use the default DCEL, also after removals, compaction
+// and copying, and the attached point-location objects must remain valid.
+
+#include <iostream>
+#include <vector>
+#include <set>
+#include <algorithm>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arr_linear_traits_2.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_compact_dcel.h>
+#include <CGAL/Arr_landmarks_point_location.h>
+#include <CGAL/Arr_trapezoid_ric_point_location.h>
+#include <CGAL/Arr_walk_along_line_point_location.h>
+#include <CGAL/Arr_vertex_index_map.h>
+#include <CGAL/Random.h>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef CGAL::Arr_segment_traits_2<Kernel>                Traits_2;
+typedef Traits_2::Point_2                                 Point_2;
+typedef Traits_2::Curve_2                                 Segment_2;
+typedef CGAL::Arrangement_2<Traits_2>                     Arrangement_2;
+typedef CGAL::Arr_compact_dcel<Traits_2>                  Compact_dcel;
+typedef CGAL::Arrangement_2<Traits_2, Compact_dcel>       Compact_arrangement_2;
+
+typedef CGAL::Arr_linear_traits_2<Kernel>                 Linear_traits_2;
+typedef Linear_traits_2::Line_2                           Line_2;
+typedef Linear_traits_2::X_monotone_curve_2               Linear_curve_2;
+typedef CGAL::Arrangement_2<Linear_traits_2,
+                            CGAL::Arr_compact_dcel<Linear_traits_2> >
+                                                          Compact_linear_arrangement_2;
+typedef CGAL::Arrangement_2<Linear_traits_2>              Linear_arrangement_2;
+
+template <typename Arrangement1, typename Arrangement2>
+bool have_equal_sizes(const Arrangement1& arr1, const Arrangement2& arr2)
+{
+  if ((arr1.number_of_vertices() != arr2.number_of_vertices()) ||
+      (arr1.number_of_edges() != arr2.number_of_edges()) ||
+      (arr1.number_of_faces() != arr2.number_of_faces()) ||
+      (arr1.number_of_isolated_vertices() !=
+       arr2.number_of_isolated_vertices()))
+  {
+    std::cerr << "Arrangement sizes differ: " << arr1.number_of_vertices()
+              << "/" << arr1.number_of_edges() << "/" << arr1.number_of_faces()
+              << " != " << arr2.number_of_vertices() << "/"
+              << arr2.number_of_edges() << "/" << arr2.number_of_faces()
+              << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Check that the edge iterators visit every edge exactly once, and that the
+// arrangement is valid.
+template <typename Arrangement>
+bool is_valid_arrangement(const Arrangement& arr)
+{
+  if (! arr.is_valid()) {
+    std::cerr << "Invalid arrangement." << std::endl;
+    return false;
+  }
+  std::set<const void*> edges;
+  std::size_t n = 0;
+  for (auto eit = arr.edges_begin(); eit != arr.edges_end(); ++eit, ++n) {
+    const void* h1 = &(*eit);
+    const void* h2 = &(*(eit->twin()));
+    edges.insert((std::min)(h1, h2));
+  }
+  if ((n != arr.number_of_edges()) || (edges.size() != n)) {
+    std::cerr << "The edge iterators are broken." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+// Remove the edges induced by every third segment.
+template <typename Arrangement>
+void remove_some_edges(Arrangement& arr)
+{
+  std::vector<typename Arrangement::Halfedge_handle> to_remove;
+  for (auto eit = arr.edges_begin(); eit != arr.edges_end(); ++eit)
+    if (CGAL::to_double(eit->source()->point().x() +
+                        eit->target()->point().y()) < 60)
+      to_remove.push_back(eit);
+  for (auto e : to_remove) arr.remove_edge(e);
+}
+
+// Compare the results of several point-location strategies.
+template <typename Pl1, typename Pl2>
+bool have_equal_results(const Pl1& pl1, const Pl2& pl2,
+                        const std::vector<Point_2>& points)
+{
+  for (const Point_2& p : points) {
+    if (pl1.locate(p) != pl2.locate(p)) {
+      std::cerr << "Point location differs at " << p << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+  // Random segments with integer endpoints (to obtain many degeneracies) and
+  // a few isolated points.
+  const int size = 100;
+  std::vector<Segment_2> segments;
+  for (int i = 0; i < 300; ++i) {
+    Point_2 p(rnd.get_int(0, size), rnd.get_int(0, size));
+    Point_2 q(p.x() + rnd.get_int(-size / 5, size / 5),
+              p.y() + rnd.get_int(-size / 5, size / 5));
+    if (p != q) segments.push_back(Segment_2(p, q));
+  }
+  std::vector<Point_2> iso_points;
+  for (int i = 0; i < 20; ++i)
+    iso_points.push_back(Point_2(rnd.get_int(0, size) + 0.5, -1));
+
+  Arrangement_2 arr;
+  Compact_arrangement_2 c_arr;
+  CGAL::reserve(c_arr, 4000, 6000, 2000);
+  CGAL::insert(arr, segments.begin(), segments.end());
+  CGAL::insert(c_arr, segments.begin(), segments.end());
+  for (const Point_2& p : iso_points) {
+    CGAL::insert_point(arr, p);
+    CGAL::insert_point(c_arr, p);
+  }
+  std::cout << "Arrangement: " << c_arr.number_of_vertices() << " vertices, "
+            << c_arr.number_of_edges() << " edges, "
+            << c_arr.number_of_faces() << " faces." << std::endl;
+  if (! is_valid_arrangement(c_arr) || ! have_equal_sizes(arr, c_arr))
+    return 1;
+
+  // Attach point-location objects and an index map, which must be updated
+  // after the compaction.
+  CGAL::Arr_landmarks_point_location<Compact_arrangement_2> lm_pl(c_arr);
+  CGAL::Arr_trapezoid_ric_point_location<Compact_arrangement_2> ric_pl(c_arr);
+  CGAL::Arr_walk_along_line_point_location<Compact_arrangement_2> walk_pl(c_arr);
+  CGAL::Arr_vertex_index_map<Compact_arrangement_2> v_index(c_arr);
+
+  // Remove edges (leaving free slots in the containers) and insert new
+  // segments that reuse them.
+  remove_some_edges(arr);
+  remove_some_edges(c_arr);
+  if (! is_valid_arrangement(c_arr) || ! have_equal_sizes(arr, c_arr))
+    return 1;
+  std::vector<Segment_2> more_segments;
+  for (int i = 0; i < 50; ++i)
+    more_segments.push_back(Segment_2(Point_2(rnd.get_int(0, size), 0),
+                                      Point_2(rnd.get_int(0, size), size)));
+  CGAL::insert(arr, more_segments.begin(), more_segments.end());
+  CGAL::insert(c_arr, more_segments.begin(), more_segments.end());
+  if (! is_valid_arrangement(c_arr) || ! have_equal_sizes(arr, c_arr))
+    return 1;
+
+  std::vector<Point_2> points;
+  for (int i = 0; i < 1000; ++i)
+    points.push_back(Point_2(rnd.get_double(-1, size + 1),
+                             rnd.get_double(-1, size + 1)));
+  for (auto vit = c_arr.vertices_begin(); vit != c_arr.vertices_end(); ++vit)
+    points.push_back(vit->point());
+
+  // Compact the DCEL.
+  CGAL::compact(c_arr);
+  if (! is_valid_arrangement(c_arr) || ! have_equal_sizes(arr, c_arr))
+    return 1;
+  if (! have_equal_results(walk_pl, lm_pl, points) ||
+      ! have_equal_results(walk_pl, ric_pl, points))
+    return 1;
+  std::set<unsigned int> indices;
+  for (auto vit = c_arr.vertices_begin(); vit != c_arr.vertices_end(); ++vit)
+    indices.insert(v_index[vit]);
+  if ((indices.size() != c_arr.number_of_vertices()) ||
+      (*indices.rbegin() != c_arr.number_of_vertices() - 1))
+  {
+    std::cerr << "The vertex index map was not updated." << std::endl;
+    return 1;
+  }
+
+  // Copy the arrangement.
+  Compact_arrangement_2 c_arr2(c_arr);
+  if (! is_valid_arrangement(c_arr2) || ! have_equal_sizes(arr, c_arr2))
+    return 1;
+
+  // An arrangement of lines (with an unbounded topology).
+  std::vector<Linear_curve_2> lines;
+  for (int i = 0; i < 30; ++i) {
+    Line_2 l(rnd.get_int(-10, 10), rnd.get_int(-10, 10), rnd.get_int(-10, 10));
+    if (! l.is_degenerate()) lines.push_back(Linear_curve_2(l));
+  }
+  Linear_arrangement_2 l_arr;
+  Compact_linear_arrangement_2 cl_arr;
+  CGAL::insert(l_arr, lines.begin(), lines.end());
+  CGAL::insert(cl_arr, lines.begin(), lines.end());
+  if (! is_valid_arrangement(cl_arr) || ! have_equal_sizes(l_arr, cl_arr))
+    return 1;
+  CGAL::compact(cl_arr);
+  if (! is_valid_arrangement(cl_arr) || ! have_equal_sizes(l_arr, cl_arr))
+    return 1;
+  Kernel::Segment_2 seg(Point_2(-17, 5), Point_2(13, -11));
+  CGAL::insert(cl_arr, Linear_curve_2(seg));
+  CGAL::insert(l_arr, Linear_curve_2(seg));
+  if (! is_valid_arrangement(cl_arr) || ! have_equal_sizes(l_arr, cl_arr))
+    return 1;
+
+  std::cout << "Passed." << std::endl;
+  return 0;
+}
@@ -0,0 +1,166 @@
+// Testing the parallel batched point-location functions: the results must be
+// identical to the results of the sequential batched point location.
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_batched_point_location.h>
+#include <CGAL/Arr_landmarks_point_location.h>
+#include <CGAL/Arr_walk_along_line_point_location.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef CGAL::Arr_segment_traits_2<Kernel>                Traits_2;
+typedef Traits_2::Point_2                                 Point_2;
+typedef Traits_2::X_monotone_curve_2                      Segment_2;
+typedef CGAL::Arrangement_2<Traits_2>                     Arrangement_2;
+typedef CGAL::Arr_point_location_result<Arrangement_2>    Point_location_result;
+typedef Point_location_result::Type                       Result_type;
+typedef std::pair<Point_2, Result_type>                   Query_result;
+typedef CGAL::Arr_landmarks_point_location<Arrangement_2> Landmarks_pl;
+typedef CGAL::Arr_walk_along_line_point_location<Arrangement_2>
+                                                          Walk_pl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag                                Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag                              Concurrency_tag;
+#endif
+
+bool are_equal(const std::vector<Query_result>& res1,
+               const std::vector<Query_result>& res2)
+{
+  if (res1.size() != res2.size()) {
+    std::cerr << "Result sizes differ: " << res1.size() << " != "
+              << res2.size() << std::endl;
+    return false;
+  }
+  for (std::size_t i = 0; i < res1.size(); ++i) {
+    if ((res1[i].first != res2[i].first) || (res1[i].second != res2[i].second))
+    {
+      std::cerr << "Results differ at query point " << res1[i].first
+                << std::endl;
+      return false;
+    }
+  }
+  return true;
+}
+
+bool xy_less(const Query_result& r1, const Query_result& r2)
+{ return CGAL::compare_xy(r1.first, r2.first) == CGAL::SMALLER; }
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+  // Construct an arrangement of random segments with integer endpoints, and
+  // a few isolated vertices, so that some of the query points coincide with
+  // arrangement vertices or lie on arrangement edges.
+  const int size = 100;
+  std::vector<Segment_2> segments;
+  for (int i = 0; i < 100; ++i) {
+    Point_2 p(rnd.get_int(0, size), rnd.get_int(0, size));
+    Point_2 q(rnd.get_int(0, size), rnd.get_int(0, size));
+    if (p != q) segments.push_back(Segment_2(p, q));
+  }
+  // Long segments crossing many strips.
+  segments.push_back(Segment_2(Point_2(-1, -1), Point_2(size + 1, -1)));
+  segments.push_back(Segment_2(Point_2(-1, size + 1),
+                               Point_2(size + 1, size + 1)));
+
+  Arrangement_2 arr;
+  CGAL::insert(arr, segments.begin(), segments.end());
+  for (int i = 0; i < 20; ++i)
+    CGAL::insert_point(arr, Point_2(0.5 * rnd.get_int(0, 2 * size), -0.5));
+  std::cout << "Arrangement: " << arr.number_of_vertices() << " vertices, "
+            << arr.number_of_edges() << " edges, " << arr.number_of_faces()
+            << " faces." << std::endl;
+
+  // Generate the query points: random points (including points outside the
+  // bounding box of the arrangement) and all arrangement vertices.
+  std::vector<Point_2> points;
+  for (int i = 0; i < 6000; ++i)
+    points.push_back(Point_2(rnd.get_double(-2, size + 2),
+                             rnd.get_double(-2, size + 2)));
+  for (auto vit = arr.vertices_begin(); vit != arr.vertices_end(); ++vit)
+    points.push_back(vit->point());
+
+  // The reference results.
+  std::vector<Query_result> expected;
+  CGAL::locate(arr, points.begin(), points.end(), std::back_inserter(expected));
+
+  // The strip-partitioned sweep, with the default and several explicit
+  // numbers of strips.
+  for (std::size_t strips : { std::size_t(0), std::size_t(2), std::size_t(7),
+                              std::size_t(25) })
+  {
+    std::vector<Query_result> results;
+    CGAL::locate<Concurrency_tag>(arr, points.begin(), points.end(),
+                                  std::back_inserter(results), strips);
+    if (! are_equal(expected, results)) {
+      std::cerr << "Parallel batched point location (" << strips
+                << " strips) failed." << std::endl;
+      return 1;
+    }
+  }
+
+  // The sequential tag must behave like the plain function.
+  {
+    std::vector<Query_result> results;
+    CGAL::locate<CGAL::Sequential_tag>(arr, points.begin(), points.end(),
+                                       std::back_inserter(results));
+    if (! are_equal(expected, results)) {
+      std::cerr << "Sequential batched point location failed." << std::endl;
+      return 1;
+    }
+  }
+
+  // Concurrent queries with thread-safe point-location strategies. These
+  // report the results in input order, so sort them before comparing.
+  Landmarks_pl landmarks_pl(arr);
+  Walk_pl walk_pl(arr);
+  std::vector<Query_result> lm_results, walk_results(points.size());
+  CGAL::locate<Concurrency_tag>(landmarks_pl, points.begin(), points.end(),
+                                std::back_inserter(lm_results));
+  // The returned output iterator must be past the last written result.
+  auto walk_end = CGAL::locate<Concurrency_tag>(walk_pl,
+                                                points.begin(), points.end(),
+                                                walk_results.begin());
+  if (walk_end != walk_results.end()) {
+    std::cerr << "Wrong output iterator returned." << std::endl;
+    return 1;
+  }
+  {
+    std::vector<Query_result> results(points.size());
+    auto res_end = CGAL::locate<CGAL::Sequential_tag>(walk_pl, points.begin(),
+                                                      points.end(),
+                                                      results.begin());
+    if (res_end != results.end()) {
+      std::cerr << "Wrong output iterator returned." << std::endl;
+      return 1;
+    }
+  }
+  for (std::size_t i = 0; i < points.size(); ++i) {
+    if (lm_results[i].first != points[i] || walk_results[i].first != points[i])
+    {
+      std::cerr << "Concurrent point location changed the query order."
+                << std::endl;
+      return 1;
+    }
+  }
+  std::stable_sort(lm_results.begin(), lm_results.end(), xy_less);
+  std::stable_sort(walk_results.begin(), walk_results.end(), xy_less);
+  if (! are_equal(expected, lm_results) || ! are_equal(expected, walk_results))
+  {
+    std::cerr << "Concurrent point location failed." << std::endl;
+    return 1;
+  }
+
+  std::cout << "Passed " << points.size() << " queries." << std::endl;
+  return 0;
+}
@@ -0,0 +1,156 @@
+// Testing the parallel aggregated insertion: the resulting arrangement must be
+// identical to the arrangement constructed by the sequential insertion.
+
+#include <iostream>
+#include <vector>
+#include <algorithm>
+#include <variant>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Arr_segment_traits_2.h>
+#include <CGAL/Arrangement_2.h>
+#include <CGAL/Arr_parallel_insertion.h>
+#include <CGAL/Random.h>
+#include <CGAL/tags.h>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel Kernel;
+typedef CGAL::Arr_segment_traits_2<Kernel>                Segment_traits_2;
+
+// Segment traits, where a degenerate segment is subdivided into an isolated
+// point, such that the input curves yield isolated points as well.
+class Traits_2 : public Segment_traits_2 {
+public:
+  typedef Segment_traits_2::Point_2                       Point_2;
+  typedef Segment_traits_2::X_monotone_curve_2            X_monotone_curve_2;
+  typedef Kernel::Segment_2                               Curve_2;
+
+  class Make_x_monotone_2 {
+  public:
+    template <typename OutputIterator>
+    OutputIterator operator()(const Curve_2& cv, OutputIterator oi) const
+    {
+      typedef std::variant<Point_2, X_monotone_curve_2> Make_x_monotone_result;
+      if (cv.is_degenerate()) *oi++ = Make_x_monotone_result(cv.source());
+      else *oi++ = Make_x_monotone_result(X_monotone_curve_2(cv));
+      return oi;
+    }
+  };
+
+  Make_x_monotone_2 make_x_monotone_2_object() const
+  { return Make_x_monotone_2(); }
+};
+
+typedef Traits_2::Point_2                                 Point_2;
+typedef Traits_2::Curve_2                                 Segment_2;
+typedef CGAL::Arrangement_2<Traits_2>                     Arrangement_2;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag                                Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag                              Concurrency_tag;
+#endif
+
+bool xy_less(const Point_2& p, const Point_2& q)
+{ return CGAL::compare_xy(p, q) == CGAL::SMALLER; }
+
+// Compare the sizes of the two arrangements and the points of their vertices.
+bool are_equal(const Arrangement_2& arr1, const Arrangement_2& arr2)
+{
+  if ((arr1.number_of_vertices() != arr2.number_of_vertices()) ||
+      (arr1.number_of_edges() != arr2.number_of_edges()) ||
+      (arr1.number_of_faces() != arr2.number_of_faces()) ||
+      (arr1.number_of_isolated_vertices() !=
+       arr2.number_of_isolated_vertices()))
+  {
+    std::cerr << "Arrangement sizes differ: " << arr1.number_of_vertices()
+              << "/" << arr1.number_of_edges() << "/" << arr1.number_of_faces()
+              << " != " << arr2.number_of_vertices() << "/"
+              << arr2.number_of_edges() << "/" << arr2.number_of_faces()
+              << std::endl;
+    return false;
+  }
+
+  std::vector<Point_2> pts1, pts2;
+  for (auto vit = arr1.vertices_begin(); vit != arr1.vertices_end(); ++vit)
+    pts1.push_back(vit->point());
+  for (auto vit = arr2.vertices_begin(); vit != arr2.vertices_end(); ++vit)
+    pts2.push_back(vit->point());
+  std::sort(pts1.begin(), pts1.end(), xy_less);
+  std::sort(pts2.begin(), pts2.end(), xy_less);
+  if (pts1 != pts2) {
+    std::cerr << "Arrangement vertices differ." << std::endl;
+    return false;
+  }
+  return true;
+}
+
+int main()
+{
+  CGAL::Random rnd(0);
+
+  // Random segments with integer endpoints (to obtain many degeneracies,
+  // e.g., overlaps and common endpoints) and a few long segments that cross
+  // many slabs.
+  const int size = 200;
+  std::vector<Segment_2> segments;
+  for (int i = 0; i < 1500; ++i) {
+    Point_2 p(rnd.get_int(0, size), rnd.get_int(0, size));
+    Point_2 q(p.x() + rnd.get_int(-size / 10, size / 10),
+              p.y() + rnd.get_int(-size / 10, size / 10));
+    if (p != q) segments.push_back(Segment_2(p, q));
+  }
+  for (int i = 0; i < 10; ++i)
+    segments.push_back(Segment_2(Point_2(0, rnd.get_int(0, size)),
+                                 Point_2(size, rnd.get_int(0, size))));
+  segments.push_back(Segment_2(Point_2(0, size / 2), Point_2(size, size / 2)));
+  segments.push_back(Segment_2(Point_2(size / 2, 0), Point_2(size / 2, size)));
+
+  // Isolated points, given as degenerate segments. As their coordinates are
+  // integers, some of them lie on edges or vertices, or coincide.
+  for (int i = 0; i < 300; ++i) {
+    Point_2 p(rnd.get_int(0, size), rnd.get_int(0, size));
+    segments.push_back(Segment_2(p, p));
+  }
+
+  Arrangement_2 expected;
+  CGAL::insert(expected, segments.begin(), segments.end());
+  std::cout << "Arrangement: " << expected.number_of_vertices()
+            << " vertices (" << expected.number_of_isolated_vertices()
+            << " isolated), " << expected.number_of_edges() << " edges, "
+            << expected.number_of_faces() << " faces." << std::endl;
+  if (! expected.is_valid()) {
+    std::cerr << "The sequential arrangement is invalid." << std::endl;
+    return 1;
+  }
+
+  for (std::size_t slabs : { std::size_t(0), std::size_t(2), std::size_t(3),
+                             std::size_t(5), std::size_t(1) })
+  {
+    Arrangement_2 arr;
+    CGAL::insert<Concurrency_tag>(arr, segments.begin(), segments.end(),
+                                  slabs);
+    if (! arr.is_valid() || ! are_equal(expected, arr)) {
+      std::cerr << "Parallel insertion (" << slabs << " slabs) failed."
+                << std::endl;
+      return 1;
+    }
+  }
+
+  // Insertion into a non-empty arrangement falls back to the sequential
+  // insertion.
+  {
+    Arrangement_2 arr;
+    const std::size_t half = segments.size() / 2;
+    CGAL::insert(arr, segments.begin(), segments.begin() + half);
+    CGAL::insert<Concurrency_tag>(arr, segments.begin() + half,
+                                  segments.end());
+    if (! arr.is_valid() || ! are_equal(expected, arr)) {
+      std::cerr << "Parallel insertion into a non-empty arrangement failed."
+                << std::endl;
+      return 1;
+    }
+  }
+
+  std::cout << "Passed." << std::endl;
+  return 0;
+}
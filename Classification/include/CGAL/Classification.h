@@ -15,6 +15,7 @@
 #include <CGAL/license/Classification.h>
 
 #include <CGAL/Classification/classify.h>
+#include <CGAL/Classification/classify_by_tiles.h>
 #include <CGAL/Classification/Sum_of_weighted_features_classifier.h>
 #include <CGAL/Classification/ETHZ/Random_forest_classifier.h>
 
@@ -16,6 +16,7 @@
 
 #include <vector>
 #include <memory>
+#include <algorithm>
 
 #include <CGAL/Classification/compressed_float.h>
 #include <CGAL/Search_traits_3.h>
@@ -87,25 +88,29 @@ private:
     void operator()(const tbb::blocked_range<std::size_t>& r) const
     {
       std::vector<std::size_t> neighbors;
+      std::vector<typename PointMap::value_type> neighbor_points;
+      float range = 0.f;
       for (std::size_t i = r.begin(); i != r.end(); ++ i)
       {
         neighbors.clear();
         m_neighbor_query (get(m_point_map, *(m_input.begin()+i)), std::back_inserter (neighbors));
 
-        std::vector<typename PointMap::value_type> neighbor_points;
+        neighbor_points.clear();
         neighbor_points.reserve(neighbors.size());
         for (std::size_t j = 0; j < neighbors.size(); ++ j)
           neighbor_points.push_back (get(m_point_map, *(m_input.begin()+neighbors[j])));
 
-        m_mutex.lock();
-        m_mean_range += float(CGAL::sqrt
-                              (CGAL::squared_distance (get(m_point_map, *(m_input.begin() + i)),
-                                                       get(m_point_map, *(m_input.begin() + neighbors.back())))));
-        m_mutex.unlock();
+        range += float(CGAL::sqrt
+                       (CGAL::squared_distance (get(m_point_map, *(m_input.begin() + i)),
+                                                get(m_point_map, *(m_input.begin() + neighbors.back())))));
 
         m_eigen.compute<typename PointMap::value_type,
                         DiagonalizeTraits> (i, get(m_point_map, *(m_input.begin()+i)), neighbor_points);
       }
+
+      // Lock once per block instead of once per point
+      std::lock_guard<std::mutex> lock(m_mutex);
+      m_mean_range += range;
     }
 
   };
@@ -155,6 +160,111 @@ private:
   };
 #endif
 
+  template <typename PointRange, typename PointMap, typename NeighborQuery, typename DiagonalizeTraits>
+  class Compute_multiscale_eigen_values
+  {
+    using Point = typename PointMap::value_type;
+
+    std::vector<Local_eigen_analysis>& m_eigen;
+    const PointRange& m_input;
+    PointMap m_point_map;
+    const NeighborQuery& m_neighbor_query;
+    const std::vector<std::size_t>& m_sizes;
+    std::vector<float>& m_mean_ranges;
+#ifdef CGAL_LINKED_WITH_TBB
+    std::mutex* m_mutex;
+#endif
+
+  public:
+
+    Compute_multiscale_eigen_values (std::vector<Local_eigen_analysis>& eigen,
+                                     const PointRange& input,
+                                     PointMap point_map,
+                                     const NeighborQuery& neighbor_query,
+                                     const std::vector<std::size_t>& sizes,
+                                     std::vector<float>& mean_ranges)
+      : m_eigen (eigen), m_input (input), m_point_map (point_map),
+        m_neighbor_query (neighbor_query), m_sizes (sizes), m_mean_ranges (mean_ranges)
+#ifdef CGAL_LINKED_WITH_TBB
+      , m_mutex (nullptr)
+#endif
+    { }
+
+#ifdef CGAL_LINKED_WITH_TBB
+    void set_mutex (std::mutex& mutex) { m_mutex = &mutex; }
+
+    void operator()(const tbb::blocked_range<std::size_t>& r) const
+    {
+      std::vector<std::size_t> neighbors;
+      std::vector<float> ranges (m_sizes.size(), 0.f);
+      for (std::size_t i = r.begin(); i != r.end(); ++ i)
+        apply (i, neighbors, ranges);
+
+      std::lock_guard<std::mutex> lock(*m_mutex);
+      for (std::size_t s = 0; s < m_sizes.size(); ++ s)
+        m_mean_ranges[s] += ranges[s];
+    }
+#endif
+
+    void apply (std::size_t i, std::vector<std::size_t>& neighbors, std::vector<float>& ranges) const
+    {
+      const Point query = get(m_point_map, *(m_input.begin()+i));
+
+      neighbors.clear();
+      m_neighbor_query (query, std::back_inserter (neighbors));
+
+      // The neighbors are sorted by increasing distance: the moments of
+      // the neighborhood of each size are accumulated on the prefixes of
+      // the largest one. Coordinates are taken relative to the query
+      // point to limit cancellation.
+      std::array<double, 3> sum = {{ 0., 0., 0. }};
+      std::array<double, 6> squares = {{ 0., 0., 0., 0., 0., 0. }};
+      std::size_t n = 0;
+
+      for (std::size_t s = 0; s < m_sizes.size(); ++ s)
+      {
+        const std::size_t size = (std::min)(m_sizes[s], neighbors.size());
+        for (; n < size; ++ n)
+        {
+          const Point p = get(m_point_map, *(m_input.begin()+neighbors[n]));
+          const double dx = CGAL::to_double(p.x() - query.x());
+          const double dy = CGAL::to_double(p.y() - query.y());
+          const double dz = CGAL::to_double(p.z() - query.z());
+          sum[0] += dx; sum[1] += dy; sum[2] += dz;
+          squares[0] += dx * dx; squares[1] += dx * dy; squares[2] += dx * dz;
+          squares[3] += dy * dy; squares[4] += dy * dz; squares[5] += dz * dz;
+        }
+
+        Content& content = *(m_eigen[s].m_content);
+        if (n == 0)
+        {
+          content.eigenvalues[i] = make_array (compressed_float(0), compressed_float(0));
+          content.centroids[i] = make_array(float(query.x()), float(query.y()), float(query.z()) );
+          content.smallest_eigenvectors[i] = make_array( 0.f, 0.f );
+          continue;
+        }
+
+        ranges[s] += float(CGAL::sqrt (CGAL::squared_distance
+                                       (query, get(m_point_map, *(m_input.begin()+neighbors[n-1])))));
+
+        const double nb = double(n);
+        const std::array<double, 3> c = {{ sum[0] / nb, sum[1] / nb, sum[2] / nb }};
+        content.centroids[i] = make_array( float(CGAL::to_double(query.x()) + c[0]),
+                                           float(CGAL::to_double(query.y()) + c[1]),
+                                           float(CGAL::to_double(query.z()) + c[2]) );
+
+        std::array<float, 6> covariance = make_array( float(squares[0] - nb * c[0] * c[0]),
+                                                      float(squares[1] - nb * c[0] * c[1]),
+                                                      float(squares[2] - nb * c[0] * c[2]),
+                                                      float(squares[3] - nb * c[1] * c[1]),
+                                                      float(squares[4] - nb * c[1] * c[2]),
+                                                      float(squares[5] - nb * c[2] * c[2]) );
+
+        m_eigen[s].diagonalize<DiagonalizeTraits> (i, covariance);
+      }
+    }
+  };
+
   template <typename ClusterRange, typename DiagonalizeTraits>
   class Compute_clusters_eigen_values
   {
@@ -301,6 +411,112 @@ public:
   }
 
 
+  /*!
+    \brief computes the local eigen analyses of an input point set
+    for several neighborhood sizes in a single pass.
+
+    The neighborhood of each point is queried only once, with
+    `neighbor_query`, which must report the neighbors sorted by
+    increasing distance to the query point, as
+    `Point_set_neighborhood::K_neighbor_query` does. The neighborhood
+    of size `k` of a point is then the prefix of size `k` of this
+    neighborhood: the covariance matrices of all sizes are accumulated
+    along the sorted neighbors, so that computing all the scales costs
+    about as much as computing the largest one.
+
+    The analysis computed for the size `k` is the one computed by
+    `create_from_point_set()` with a
+    `Point_set_neighborhood::K_neighbor_query` of size `k`, up to
+    floating point rounding.
+
+    \tparam PointRange model of `ConstRange`. Its iterator type is
+    `RandomAccessIterator` and its value type is the key type of
+    `PointMap`.
+    \tparam PointMap model of `ReadablePropertyMap` whose key
+    type is the value type of the iterator of `PointRange` and value type
+    is `CGAL::Point_3`.
+    \tparam NeighborQuery model of `NeighborQuery`
+    \tparam ConcurrencyTag enables sequential versus parallel
+    algorithm. Possible values are `Parallel_tag` (default value if \cgal
+    is linked with TBB) or `Sequential_tag` (default value otherwise).
+    \tparam DiagonalizeTraits model of `DiagonalizeTraits` used for
+    matrix diagonalization. It can be omitted if Eigen 3 (or greater)
+    is available and `CGAL_EIGEN3_ENABLED` is defined. In that case,
+    an overload using `Eigen_diagonalize_traits` is provided.
+
+    \param input point range.
+    \param point_map property map to access the input points.
+    \param neighbor_query object used to access neighborhoods of points,
+    reporting at least `neighborhood_sizes.back()` neighbors sorted by
+    increasing distance (if the input contains enough points).
+    \param neighborhood_sizes numbers of neighbors of the scales.
+
+    \return one local eigen analysis per neighborhood size, in the same order.
+
+    \pre `neighborhood_sizes` is not empty and sorted in increasing order.
+  */
+  template <typename PointRange,
+            typename PointMap,
+            typename NeighborQuery,
+#if defined(DOXYGEN_RUNNING)
+            typename ConcurrencyTag,
+#else
+            typename ConcurrencyTag = CGAL::Parallel_if_available_tag,
+#endif
+#if defined(DOXYGEN_RUNNING)
+            typename DiagonalizeTraits>
+#else
+            typename DiagonalizeTraits = CGAL::Default_diagonalize_traits<float, 3> >
+#endif
+  static std::vector<Local_eigen_analysis>
+  create_multiscale_from_point_set (const PointRange& input,
+                                    PointMap point_map,
+                                    const NeighborQuery& neighbor_query,
+                                    const std::vector<std::size_t>& neighborhood_sizes,
+                                    const ConcurrencyTag& = ConcurrencyTag(),
+                                    const DiagonalizeTraits& = DiagonalizeTraits())
+  {
+    CGAL_precondition (!neighborhood_sizes.empty());
+    CGAL_precondition (std::is_sorted (neighborhood_sizes.begin(), neighborhood_sizes.end()));
+
+    std::vector<Local_eigen_analysis> out (neighborhood_sizes.size());
+    for (Local_eigen_analysis& eigen : out)
+    {
+      eigen.m_content = std::make_shared<Content>();
+      eigen.m_content->eigenvalues.resize (input.size());
+      eigen.m_content->centroids.resize (input.size());
+      eigen.m_content->smallest_eigenvectors.resize (input.size());
+    }
+
+    std::vector<float> mean_ranges (neighborhood_sizes.size(), 0.f);
+
+    Compute_multiscale_eigen_values<PointRange, PointMap, NeighborQuery, DiagonalizeTraits>
+      f(out, input, point_map, neighbor_query, neighborhood_sizes, mean_ranges);
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                               "Parallel_tag is enabled but TBB is unavailable.");
+#else
+    if (std::is_convertible<ConcurrencyTag,Parallel_tag>::value)
+    {
+      std::mutex mutex;
+      f.set_mutex (mutex);
+      tbb::parallel_for(tbb::blocked_range<size_t>(0, input.size ()), f);
+    }
+    else
+#endif
+    {
+      std::vector<std::size_t> neighbors;
+      for (std::size_t i = 0; i < input.size(); ++ i)
+        f.apply (i, neighbors, mean_ranges);
+    }
+
+    for (std::size_t s = 0; s < out.size(); ++ s)
+      out[s].m_content->mean_range = mean_ranges[s] / input.size();
+
+    return out;
+  }
+
   /*!
     \brief computes the local eigen analysis of an input face graph
     based on a local neighborhood.
@@ -546,6 +762,12 @@ private:
       covariance[5] += float(d.z () * d.z ());
     }
 
+    diagonalize<DiagonalizeTraits> (index, covariance);
+  }
+
+  template <typename DiagonalizeTraits>
+  void diagonalize (std::size_t index, std::array<float, 6>& covariance)
+  {
     std::array<float, 3> evalues = make_array( 0.f, 0.f, 0.f );
     std::array<float, 9> evectors = make_array( 0.f, 0.f, 0.f,
                                                0.f, 0.f, 0.f,
@@ -100,6 +100,30 @@ public:
 #endif
   {  }
 
+  /*!
+    \brief copies the parameters and the trained forest of `other`
+    and binds them to the feature set `features`.
+
+    This constructor can be used to apply a trained random forest to
+    another data set. The forest is shared with `other`, not copied.
+
+    \warning The feature set should be composed of the same features
+    than the ones used by `other`, and in the same order.
+
+    \note This constructor requires OpenCV 3 or later.
+  */
+#if defined(DOXYGEN_RUNNING) || (CV_MAJOR_VERSION >= 3)
+  Random_forest_classifier (const Random_forest_classifier& other,
+                            const Feature_set& features)
+    : m_labels (other.m_labels), m_features (features),
+      m_max_depth (other.m_max_depth), m_min_sample_count (other.m_min_sample_count),
+      m_max_categories (other.m_max_categories),
+      m_max_number_of_trees_in_the_forest (other.m_max_number_of_trees_in_the_forest),
+      m_forest_accuracy (other.m_forest_accuracy),
+      rtree (other.rtree)
+  {  }
+#endif
+
   /// \cond SKIP_IN_MANUAL
   ~Random_forest_classifier ()
   {
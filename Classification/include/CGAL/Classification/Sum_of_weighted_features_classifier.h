@@ -184,6 +184,36 @@ public:
       m_map_features[features[i]] = i;
   }
 
+  /*!
+    \brief copies the weights and effects of `other` and binds them to
+    the feature set `features`.
+
+    This constructor can be used to apply a trained classifier to
+    another data set. Features are matched by their name: a feature of
+    `features` that has no counterpart in the feature set of `other`
+    keeps the default weight (1) and effects (`NEUTRAL`).
+  */
+  Sum_of_weighted_features_classifier (const Sum_of_weighted_features_classifier& other,
+                                       const Feature_set& features)
+    : Sum_of_weighted_features_classifier (other.m_labels, features)
+  {
+    std::map<std::string, std::size_t> map_n2f;
+    for (std::size_t i = 0; i < other.m_features.size(); ++ i)
+      map_n2f.insert (std::make_pair (other.m_features[i]->name(), i));
+
+    for (std::size_t i = 0; i < m_features.size(); ++ i)
+    {
+      std::map<std::string, std::size_t>::iterator
+        found = map_n2f.find (m_features[i]->name());
+      if (found == map_n2f.end())
+        continue;
+
+      m_weights[i] = other.m_weights[found->second];
+      for (std::size_t l = 0; l < m_labels.size(); ++ l)
+        m_effect_table[l][i] = other.m_effect_table[l][found->second];
+    }
+  }
+
   /// @}
 
   /// \name Weights and Effects
@@ -0,0 +1,321 @@
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_CLASSIFICATION_CLASSIFY_BY_TILES_H
+#define CGAL_CLASSIFICATION_CLASSIFY_BY_TILES_H
+
+#include <CGAL/license/Classification.h>
+
+#include <CGAL/Classification/classify.h>
+#include <CGAL/Classification/Feature_set.h>
+#include <CGAL/Classification/Label_set.h>
+#include <CGAL/Classification/Point_set_feature_generator.h>
+#include <CGAL/Classification/internal/verbosity.h>
+
+#include <CGAL/Kernel_traits.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <type_traits>
+#include <vector>
+
+namespace CGAL {
+
+namespace Classification {
+
+  /*!
+    \ingroup PkgClassificationMain
+
+    \brief runs the classification algorithm without any
+    regularization on a point set split into tiles, so that the
+    features and their data structures never have to be stored for the
+    whole point set at once.
+
+    The input point set is split along the XY plane into square tiles
+    of size `tile_size`. Tiles are processed one after the other: the
+    points of a tile, along with the points of the neighboring tiles
+    located at a distance smaller than `halo` (along X and Y), are
+    gathered into a point set on which a
+    `Point_set_feature_generator` is instantiated with `nb_scales`
+    scales and a smallest scale of `voxel_size`. The features are then
+    generated by `generate_features`, the classifier is bound to these
+    features and only the points of the tile itself are classified
+    (the halo points only provide a complete neighborhood to the
+    points close to the border of the tile). All data structures are
+    released before the next tile is processed.
+
+    The classifier must have been trained on features generated the
+    same way (same number of scales, same voxel size and same calls in
+    `generate_features`), so that the features of each tile have the
+    same names and are in the same order as the ones used for
+    training. The voxel size must therefore be given explicitly: it
+    cannot be estimated independently on each tile.
+
+    The halo should be larger than the largest radius used by the
+    features (for the features generated by
+    `Point_set_feature_generator`, this is the radius of the digital
+    terrain model at the largest scale, that is `voxel_size` \f$
+    \times 10 \times 2^{nb\_scales - 1}\f$): points classified in a
+    tile then have the same neighborhoods as in the whole point
+    set. The planimetric grids being aligned with the bounding box of
+    each tile, the features may still slightly differ from the ones
+    computed on the whole point set.
+
+    \tparam ConcurrencyTag enables sequential versus parallel
+    computation of the features and of the classification of each
+    tile. Possible values are `Parallel_if_available_tag`,
+    `Parallel_tag` or `Sequential_tag`.
+
+    \tparam PointRange model of `ConstRange`. Its iterator type is
+    `RandomAccessIterator` and its value type is the key type of
+    `PointMap`.
+
+    \tparam PointMap model of `ReadablePropertyMap` whose key type is
+    the value type of the iterator of `PointRange` and value type is a
+    point type of a \cgal Kernel.
+
+    \tparam Classifier model of `Classifier` that provides a
+    constructor `Classifier(const Classifier& other, const Feature_set&
+    features)` copying the trained configuration of `other` and
+    binding it to `features`, such as
+    `CGAL::Classification::Sum_of_weighted_features_classifier`,
+    `CGAL::Classification::ETHZ::Random_forest_classifier` or
+    `CGAL::Classification::OpenCV::Random_forest_classifier`.
+
+    \tparam FeatureGeneration functor with an operator `void
+    operator()(Generator& generator, Feature_set& features) const`
+    where `Generator` is
+    `CGAL::Classification::Point_set_feature_generator<GeomTraits,
+    std::vector<Item>, PointMap, ConcurrencyTag>` with `GeomTraits`
+    the kernel of the points and `Item` the value type of the iterator
+    of `PointRange`. Property maps used for additional features
+    (colors, echo, etc.) should therefore be indexed by the items of
+    `PointRange`.
+
+    \tparam LabelIndexRange model of `Range` with random access
+    iterators whose value type is an integer type.
+
+    \param input input range.
+    \param point_map property map to access the input points.
+    \param labels set of input labels.
+    \param classifier trained classifier.
+    \param nb_scales number of scales used for the feature generation.
+    \param voxel_size smallest scale used for the feature generation.
+    \param tile_size size of the side of the tiles. If it is so small
+    that the grid of tiles covering the point set would have more
+    tiles than there are points, the size is doubled until it does not.
+    \param halo size of the neighborhood added around each tile.
+    \param generate_features functor that generates the features of a tile.
+    \param output where to store the result. It is stored as a sequence,
+    ordered like the input range, containing for each point the index
+    (in the `Label_set`) of the assigned label.
+  */
+  template <typename ConcurrencyTag,
+            typename PointRange,
+            typename PointMap,
+            typename Classifier,
+            typename FeatureGeneration,
+            typename LabelIndexRange>
+  void classify_by_tiles (const PointRange& input,
+                          PointMap point_map,
+                          const Label_set& labels,
+                          const Classifier& classifier,
+                          std::size_t nb_scales,
+                          float voxel_size,
+                          float tile_size,
+                          float halo,
+                          const FeatureGeneration& generate_features,
+                          LabelIndexRange& output)
+  {
+    using Item = typename std::iterator_traits<typename PointRange::const_iterator>::value_type;
+    using Point = typename boost::property_traits<PointMap>::value_type;
+    using GeomTraits = typename Kernel_traits<Point>::Kernel;
+    using Tile_range = std::vector<Item>;
+    using Generator = Point_set_feature_generator<GeomTraits, Tile_range, PointMap, ConcurrencyTag>;
+
+    CGAL_precondition (voxel_size > 0.f);
+    CGAL_precondition (tile_size > 0.f);
+    CGAL_precondition (halo >= 0.f);
+
+    const std::size_t size = input.size();
+    if (size == 0)
+      return;
+
+    // Bucket the indices of the input points in a 2D grid of tiles
+
+    double xmin = (std::numeric_limits<double>::max)();
+    double ymin = (std::numeric_limits<double>::max)();
+    double xmax = -(std::numeric_limits<double>::max)();
+    double ymax = -(std::numeric_limits<double>::max)();
+    for (const Item& item : input)
+    {
+      const Point& p = get (point_map, item);
+      xmin = (std::min)(xmin, CGAL::to_double(p.x()));
+      ymin = (std::min)(ymin, CGAL::to_double(p.y()));
+      xmax = (std::max)(xmax, CGAL::to_double(p.x()));
+      ymax = (std::max)(ymax, CGAL::to_double(p.y()));
+    }
+
+    // The grid never has more tiles than there are points: if `tile_size`
+    // is too small with respect to the extent of the point set, the tiles
+    // are enlarged (most of them would be empty anyway).
+    double tile_side = tile_size;
+    auto nb_tiles_along = [&](double extent) -> double
+    {
+      return (std::max)(1., std::ceil (extent / tile_side));
+    };
+    while (nb_tiles_along (xmax - xmin) * nb_tiles_along (ymax - ymin) > double(size))
+      tile_side *= 2.;
+    if (tile_side != tile_size)
+      CGAL_CLASSIFICATION_CERR << "Tile size too small, using " << tile_side << " instead" << std::endl;
+
+    const std::size_t nx = std::size_t (nb_tiles_along (xmax - xmin));
+    const std::size_t ny = std::size_t (nb_tiles_along (ymax - ymin));
+
+    auto tile_coordinate = [&](double v, double vmin, std::size_t n) -> std::size_t
+    {
+      return (std::min)(n - 1, std::size_t((v - vmin) / tile_side));
+    };
+
+    auto tile_of = [&](const Point& p) -> std::size_t
+    {
+      return tile_coordinate (CGAL::to_double(p.x()), xmin, nx)
+        + nx * tile_coordinate (CGAL::to_double(p.y()), ymin, ny);
+    };
+
+    std::vector<std::size_t> offsets (nx * ny + 1, 0);
+    for (const Item& item : input)
+      ++ offsets[tile_of (get (point_map, item)) + 1];
+    for (std::size_t i = 1; i < offsets.size(); ++ i)
+      offsets[i] += offsets[i-1];
+
+    std::vector<std::size_t> sorted (size);
+    {
+      std::vector<std::size_t> cursor (offsets.begin(), offsets.end() - 1);
+      for (std::size_t i = 0; i < size; ++ i)
+        sorted[cursor[tile_of (get (point_map, *(input.begin() + i)))] ++] = i;
+    }
+
+    const std::size_t ring = std::size_t(std::ceil (halo / tile_side));
+
+    CGAL_CLASSIFICATION_CERR << "Classifying " << size << " point(s) in "
+                             << nx << "x" << ny << " tile(s)" << std::endl;
+
+    std::size_t nb_tiles = 0;
+    CGAL::Real_timer t;
+    t.start();
+
+    for (std::size_t iy = 0; iy < ny; ++ iy)
+      for (std::size_t ix = 0; ix < nx; ++ ix)
+      {
+        const std::size_t tile = ix + nx * iy;
+        const std::size_t core_size = offsets[tile+1] - offsets[tile];
+        if (core_size == 0)
+          continue;
+
+        // Points of the tile come first, followed by the halo points
+        Tile_range tile_input;
+        tile_input.reserve (core_size);
+        for (std::size_t i = offsets[tile]; i < offsets[tile+1]; ++ i)
+          tile_input.push_back (*(input.begin() + sorted[i]));
+
+        const double hxmin = xmin + ix * tile_side - halo;
+        const double hymin = ymin + iy * tile_side - halo;
+        const double hxmax = xmin + (ix + 1) * tile_side + halo;
+        const double hymax = ymin + (iy + 1) * tile_side + halo;
+
+        for (std::size_t jy = (iy < ring ? 0 : iy - ring); jy <= (std::min)(ny - 1, iy + ring); ++ jy)
+          for (std::size_t jx = (ix < ring ? 0 : ix - ring); jx <= (std::min)(nx - 1, ix + ring); ++ jx)
+          {
+            const std::size_t neighbor = jx + nx * jy;
+            if (neighbor == tile)
+              continue;
+            for (std::size_t i = offsets[neighbor]; i < offsets[neighbor+1]; ++ i)
+            {
+              const Item& item = *(input.begin() + sorted[i]);
+              const Point& p = get (point_map, item);
+              const double x = CGAL::to_double(p.x());
+              const double y = CGAL::to_double(p.y());
+              if (hxmin <= x && x <= hxmax && hymin <= y && y <= hymax)
+                tile_input.push_back (item);
+            }
+          }
+
+        Generator generator (tile_input, point_map, nb_scales, voxel_size);
+
+        Feature_set features;
+#ifdef CGAL_LINKED_WITH_TBB
+        if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+          features.begin_parallel_additions();
+#endif
+        generate_features (generator, features);
+#ifdef CGAL_LINKED_WITH_TBB
+        if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+          features.end_parallel_additions();
+#endif
+
+        const Classifier tile_classifier (classifier, features);
+
+        std::vector<std::size_t> tile_output (tile_input.size());
+        classify<ConcurrencyTag> (tile_input, labels, tile_classifier, tile_output);
+
+        for (std::size_t i = 0; i < core_size; ++ i)
+          output[sorted[offsets[tile] + i]]
+            = static_cast<typename LabelIndexRange::iterator::value_type>(tile_output[i]);
+
+        ++ nb_tiles;
+      }
+
+    t.stop();
+    CGAL_CLASSIFICATION_CERR << nb_tiles << " tile(s) classified in " << t.time() << " second(s)" << std::endl;
+  }
+
+  /*!
+    \ingroup PkgClassificationMain
+
+    \brief runs the classification algorithm without any
+    regularization on a point set split into tiles, using the features
+    generated by
+    `Point_set_feature_generator::generate_point_based_features()`.
+
+    This is equivalent to calling the other overload of
+    `classify_by_tiles()` with a functor that calls
+    `generate_point_based_features()`.
+  */
+  template <typename ConcurrencyTag,
+            typename PointRange,
+            typename PointMap,
+            typename Classifier,
+            typename LabelIndexRange>
+  void classify_by_tiles (const PointRange& input,
+                          PointMap point_map,
+                          const Label_set& labels,
+                          const Classifier& classifier,
+                          std::size_t nb_scales,
+                          float voxel_size,
+                          float tile_size,
+                          float halo,
+                          LabelIndexRange& output)
+  {
+    classify_by_tiles<ConcurrencyTag>
+      (input, point_map, labels, classifier, nb_scales, voxel_size, tile_size, halo,
+       [](auto& generator, Feature_set& features)
+       {
+         generator.generate_point_based_features (features);
+       },
+       output);
+  }
+
+} // namespace Classification
+
+} // namespace CGAL
+
+#endif // CGAL_CLASSIFICATION_CLASSIFY_BY_TILES_H
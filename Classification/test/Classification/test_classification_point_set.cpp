@@ -3,6 +3,7 @@
                               // converts 64 to 32 bits integers
 #endif
 
+#include <algorithm>
 #include <cstdlib>
 #include <fstream>
 #include <iostream>
@@ -144,6 +145,70 @@ int main (int, char**)
      0.2f, 10, label_indices);
 #endif
 
+  // Eigen analyses at several neighborhood sizes computed in one pass
+  // match the ones computed separately
+  const std::vector<std::size_t> sizes = { 6, 12, 24 };
+  std::vector<Classification::Local_eigen_analysis> multiscale
+    = Classification::Local_eigen_analysis::create_multiscale_from_point_set
+    (pts, pts.point_map(), generator.neighborhood().k_neighbor_query(24), sizes, CGAL::Sequential_tag());
+  assert (multiscale.size() == sizes.size());
+
+  for (std::size_t s = 0; s < sizes.size(); ++ s)
+  {
+    Classification::Local_eigen_analysis eigen
+      = Classification::Local_eigen_analysis::create_from_point_set
+      (pts, pts.point_map(), generator.neighborhood().k_neighbor_query(unsigned(sizes[s])), CGAL::Sequential_tag());
+
+    assert (std::abs (eigen.mean_range() - multiscale[s].mean_range()) < 1e-5f);
+    for (std::size_t i = 0; i < pts.size(); ++ i)
+      for (std::size_t j = 0; j < 3; ++ j)
+        assert (std::abs (eigen.eigenvalue(i)[j] - multiscale[s].eigenvalue(i)[j]) < 1e-3f);
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::vector<Classification::Local_eigen_analysis> parallel_multiscale
+    = Classification::Local_eigen_analysis::create_multiscale_from_point_set
+    (pts, pts.point_map(), generator.neighborhood().k_neighbor_query(24), sizes, CGAL::Parallel_tag());
+  for (std::size_t s = 0; s < sizes.size(); ++ s)
+    for (std::size_t i = 0; i < pts.size(); ++ i)
+      assert (parallel_multiscale[s].eigenvalue(i) == multiscale[s].eigenvalue(i));
+#endif
+
+  // Classification by tiles: with a single tile, the result is the
+  // same as the classification of the whole point set
+  auto generate_all_features = [&](auto& tile_generator, Feature_set& tile_features)
+  {
+    tile_generator.generate_point_based_features(tile_features);
+    tile_generator.generate_normal_based_features(tile_features, normal_map);
+    tile_generator.generate_color_based_features(tile_features, color_map);
+    tile_generator.generate_echo_based_features(tile_features, echo_map);
+  };
+
+  std::vector<int> raw_label_indices(pts.size(), -1);
+  Classification::classify<CGAL::Sequential_tag>
+    (pts, labels, classifier, raw_label_indices);
+
+  std::vector<int> tiled_label_indices(pts.size(), -1);
+  Classification::classify_by_tiles<CGAL::Sequential_tag>
+    (pts, pts.point_map(), labels, classifier, 5, generator.grid_resolution(),
+     2.f, 0.f, generate_all_features, tiled_label_indices);
+  assert (tiled_label_indices == raw_label_indices);
+
+  // With several tiles, all points get a label
+  std::fill (tiled_label_indices.begin(), tiled_label_indices.end(), -1);
+  Classification::classify_by_tiles<CGAL::Sequential_tag>
+    (pts, pts.point_map(), labels, classifier, 2, generator.grid_resolution(),
+     0.25f, 0.1f, generate_all_features, tiled_label_indices);
+  for (int l : tiled_label_indices)
+    assert (l >= 0 && l < int(labels.size()));
+
+#ifdef CGAL_LINKED_WITH_TBB
+  Classification::classify_by_tiles<CGAL::Parallel_tag>
+    (pts, pts.point_map(), labels, classifier, 5, generator.grid_resolution(),
+     2.f, 0.f, generate_all_features, tiled_label_indices);
+  assert (tiled_label_indices == raw_label_indices);
+#endif
+
   Classification::Evaluation evaluation (labels, training_set, label_indices);
 
   return EXIT_SUCCESS;
@@ -0,0 +1,108 @@
+// Measures the scaling of the parallel kinetic space partition with the number of threads.
+//
+// Usage: parallel_benchmark [-i input] [-k k] [-n max_octree_node_size] [-d max_octree_depth] [-t max_threads]
+//
+// The default input is the building of the real data tests.
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Kinetic_space_partition_3.h>
+
+#include <CGAL/IO/polygon_soup_io.h>
+#include <CGAL/Real_timer.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+# include <tbb/global_control.h>
+#endif
+
+#include <cstring>
+#include <iostream>
+#include <string>
+#include <thread>
+#include <vector>
+
+using EPICK = CGAL::Exact_predicates_inexact_constructions_kernel;
+using EPECK = CGAL::Exact_predicates_exact_constructions_kernel;
+
+using Point_3 = EPICK::Point_3;
+using KSP = CGAL::Kinetic_space_partition_3<EPICK, EPECK>;
+
+template <typename ConcurrencyTag>
+double run(const std::vector<Point_3>& points,
+           const std::vector<std::vector<std::size_t> >& polygons,
+           const unsigned int k,
+           const unsigned int max_octree_node_size,
+           const unsigned int max_octree_depth,
+           std::size_t& number_of_volumes)
+{
+  CGAL::Real_timer timer;
+  timer.start();
+
+  KSP ksp(CGAL::parameters::verbose(false).debug(false));
+  ksp.insert(points, polygons);
+  ksp.initialize(CGAL::parameters::max_octree_node_size(max_octree_node_size)
+                                  .max_octree_depth(max_octree_depth)
+                                  .concurrency_tag(ConcurrencyTag()));
+  ksp.partition(k);
+
+  timer.stop();
+  number_of_volumes = ksp.number_of_volumes();
+
+  return timer.time();
+}
+
+int main(int argc, char** argv)
+{
+  const int argc_check = argc - 1;
+  std::string filename = "../../test/Kinetic_space_partition/data/real-data-test/test-40-polygons.ply";
+  unsigned int k = 1, max_octree_node_size = 10, max_octree_depth = 3;
+  int max_threads = static_cast<int>(std::thread::hardware_concurrency());
+
+  for(int i=1; i<argc; ++i)
+  {
+    if(!strcmp("-i", argv[i]) && i < argc_check)
+      filename = argv[++i];
+    else if(!strcmp("-k", argv[i]) && i < argc_check)
+      k = std::stoi(argv[++i]);
+    else if(!strcmp("-n", argv[i]) && i < argc_check)
+      max_octree_node_size = std::stoi(argv[++i]);
+    else if(!strcmp("-d", argv[i]) && i < argc_check)
+      max_octree_depth = std::stoi(argv[++i]);
+    else if(!strcmp("-t", argv[i]) && i < argc_check)
+      max_threads = std::stoi(argv[++i]);
+  }
+
+  std::vector<Point_3> points;
+  std::vector<std::vector<std::size_t> > polygons;
+  if(!CGAL::IO::read_polygon_soup(filename, points, polygons) || polygons.empty())
+  {
+    std::cerr << "Error: Invalid input data." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << filename << ": " << polygons.size() << " polygons, k = " << k
+            << ", max octree node size = " << max_octree_node_size
+            << ", max octree depth = " << max_octree_depth << std::endl;
+
+  std::size_t number_of_volumes = 0;
+  const double sequential_time = run<CGAL::Sequential_tag>(points, polygons, k, max_octree_node_size,
+                                                           max_octree_depth, number_of_volumes);
+  std::cout << "Sequential: " << sequential_time << " s (" << number_of_volumes << " volumes)" << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  for(int n=1; n<=(std::max)(1, max_threads); n*=2)
+  {
+    tbb::global_control control(tbb::global_control::max_allowed_parallelism, n);
+
+    const double parallel_time = run<CGAL::Parallel_tag>(points, polygons, k, max_octree_node_size,
+                                                         max_octree_depth, number_of_volumes);
+    std::cout << "Parallel, " << n << " thread(s): " << parallel_time << " s ("
+              << number_of_volumes << " volumes), speedup: "
+              << sequential_time / parallel_time << std::endl;
+  }
+#else
+  std::cout << "TBB is not available, the parallel partition is not benchmarked." << std::endl;
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -32,6 +32,8 @@ struct Parameters_3 {
 
   bool reorient_bbox = false; // true - optimal bounding box, false - axis aligned
 
+  bool parallel = false; // true - subpartitions are processed concurrently, requires TBB
+
   // All files are saved in the current build directory.
   bool verbose = false; // print basic verbose information
   bool debug = false; // print all steps and substeps + export initial and final configurations
@@ -109,7 +109,6 @@ public:
       }
     }
 
-    std::cout.precision(20);
     CGAL_assertion(m_data.check_bbox());
     CGAL_assertion(m_data.check_interior());
     CGAL_assertion(m_data.check_vertices());
@@ -649,14 +648,14 @@ private:
           if (f_other == mesh.null_face())
             break;
           c_other = fcm[f_other];
-          if (c0 == c_other && ecm[Edge_index(n >> 1)])
+          if (m_parameters.debug && c0 == c_other && ecm[Edge_index(n >> 1)])
             std::cout << "edge and face constraint map inconsistent1" << std::endl;
 
-          if (c0 != c_other && !ecm[Edge_index(n >> 1)])
+          if (m_parameters.debug && c0 != c_other && !ecm[Edge_index(n >> 1)])
             std::cout << "edge and face constraint map inconsistent2" << std::endl;
         } while (c0 == c_other && n != h);
 
-        if (n == h) {
+        if (m_parameters.debug && n == h) {
           // Should not happen.
           std::cout << "Searching for next edge of connected component failed" << std::endl;
         }
@@ -687,7 +686,7 @@ private:
         remove_vertex(v, mesh);
     }
 
-    if (!mesh.is_valid(true)) {
+    if (m_parameters.debug && !mesh.is_valid(true)) {
       std::cout << "mesh is not valid after merging faces of sp " << sp_idx << std::endl;
     }
   }
@@ -736,7 +735,7 @@ private:
           ivertex2vertex[ivertex] = static_cast<int>(vertices.size());
           if (!face_filled)
             face2vertices[cell.faces[f]].push_back(vertices.size());
-          else
+          else if (m_parameters.debug)
             std::cout << "Should not happen" << std::endl;
           vertices.push_back(from_exact(m_data.point_3(ivertex)));
           exact_vertices.push_back(m_data.point_3(ivertex));
@@ -61,7 +61,8 @@ public:
     std::set<std::size_t> planes;
     std::set<std::size_t> crossed;
     std::map<std::size_t, Kinetic_interval> intervals; // Maps support plane index to the kinetic interval. std::pair<FT, FT> is the barycentric coordinate and intersection time.
-    Edge_property() : line(std::size_t(-1)), order(edge_counter++) { }
+    Edge_property() : line(std::size_t(-1)), order(0) { }
+    Edge_property(std::size_t order) : line(std::size_t(-1)), order(order) { }
 
     Edge_property(const Edge_property& e) = default;
 
@@ -75,8 +76,6 @@ public:
 
       return *this;
     }
-  private:
-    static std::size_t edge_counter;
   };
 
   using Kinetic_interval_iterator = typename std::map<std::size_t, Kinetic_interval>::const_iterator;
@@ -134,6 +133,7 @@ private:
   std::map<Point_3, Vertex_descriptor> m_map_points;
   std::map<std::vector<std::size_t>, Vertex_descriptor> m_map_vertices;
   std::vector<Face_property> m_ifaces;
+  std::size_t m_edge_counter; // Creation order of the edges, kept per graph so that partitions can be built concurrently.
 
   std::vector<bool> m_initial_part_of_partition;
   std::vector<std::map<std::size_t, Kinetic_interval> > m_initial_intervals;
@@ -141,7 +141,7 @@ private:
 
 public:
   Intersection_graph() :
-    m_nb_lines_on_bbox(0)
+    m_nb_lines_on_bbox(0), m_edge_counter(0)
   { }
 
   void clear() {
@@ -201,7 +201,7 @@ public:
   const std::pair<Edge_descriptor, bool> add_edge(
     const Vertex_descriptor& source, const Vertex_descriptor& target,
     const std::size_t support_plane_idx) {
-    const auto out = boost::add_edge(source, target, m_graph);
+    const auto out = boost::add_edge(source, target, Edge_property(m_edge_counter++), m_graph);
     m_graph[out.first].planes.insert(support_plane_idx);
 
     return out;
@@ -211,7 +211,7 @@ public:
   const std::pair<Edge_descriptor, bool> add_edge(
     const Vertex_descriptor& source, const Vertex_descriptor& target,
     const IndexContainer& support_planes_idx) {
-    const auto out = boost::add_edge(source, target, m_graph);
+    const auto out = boost::add_edge(source, target, Edge_property(m_edge_counter++), m_graph);
     for (const auto support_plane_idx : support_planes_idx) {
       m_graph[out.first].planes.insert(support_plane_idx);
     }
@@ -330,7 +330,7 @@ public:
 
     bool is_inserted;
     Edge_descriptor sedge;
-    std::tie(sedge, is_inserted) = boost::add_edge(source, vertex, m_graph);
+    std::tie(sedge, is_inserted) = boost::add_edge(source, vertex, Edge_property(m_edge_counter++), m_graph);
     if (!is_inserted) {
       std::cerr << "WARNING: " << segment_3(edge) << " " << point_3(vertex) << std::endl;
     }
@@ -338,7 +338,7 @@ public:
     m_graph[sedge] = prop;
 
     Edge_descriptor tedge;
-    std::tie(tedge, is_inserted) = boost::add_edge(vertex, target, m_graph);
+    std::tie(tedge, is_inserted) = boost::add_edge(vertex, target, Edge_property(m_edge_counter++), m_graph);
     if (!is_inserted) {
       std::cerr << "WARNING: " << segment_3(edge) << " " << point_3(vertex) << std::endl;
     }
@@ -425,8 +425,6 @@ public:
   }
 };
 
-template<typename GeomTraits, typename IntersectionKernel> std::size_t Intersection_graph<GeomTraits, IntersectionKernel>::Edge_property::edge_counter = 0;
-
 #endif //DOXYGEN_RUNNING
 
 } // namespace internal
@@ -21,6 +21,9 @@
 
 #include <algorithm>
 #include <numeric>
+#include <sstream>
+#include <string>
+#include <type_traits>
 
 // CGAL includes.
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
@@ -35,6 +38,11 @@
 
 #include <CGAL/Linear_cell_complex_for_combinatorial_map.h>
 #include <CGAL/Linear_cell_complex_incremental_builder_3.h>
+#include <CGAL/tags.h>
+
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#endif
 
 // Internal includes.
 #include <CGAL/KSP/utils.h>
@@ -228,6 +236,9 @@ private:
   };
 
   Parameters m_parameters;
+  // Parameters of the subpartitions. When they are processed concurrently,
+  // their verbose and debug output is disabled, as it would interleave.
+  Parameters m_subpartition_parameters;
   std::array<Point_3, 8> m_bbox;
   CGAL::Aff_transformation_3<Intersection_kernel> m_transform;
   std::vector<Sub_partition> m_partition_nodes; // Tree of partitions.
@@ -338,6 +349,12 @@ public:
       \cgalParamType{std::size_t}
       \cgalParamDefault{40}
     \cgalParamNEnd
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the subpartitions defined by the leaves of the octree are initialized, propagated and finalized sequentially or in parallel.}
+      \cgalParamType{Concurrency tag type (`CGAL::Sequential_tag` or `CGAL::Parallel_tag`)}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{The parallel mode requires \ref thirdpartyTBB. The resulting partition does not depend on the chosen tag.}
+    \cgalParamNEnd
   \cgalNamedParamsEnd
 
 
@@ -420,7 +437,8 @@ public:
       bool skip = false;
       for (std::size_t i = 0; i < m_input_planes.size(); i++) {
         if (m_input_planes[i] == exact_pl) {
-          std::cout << i << ". input polygon is coplanar to " << (p + offset) << ". input polygon" << std::endl;
+          if (m_parameters.verbose)
+            std::cout << i << ". input polygon is coplanar to " << (p + offset) << ". input polygon" << std::endl;
           skip = true;
           break;
         }
@@ -472,6 +490,12 @@ public:
       \cgalParamType{std::size_t}
       \cgalParamDefault{40}
     \cgalParamNEnd
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the subpartitions defined by the leaves of the octree are initialized, propagated and finalized sequentially or in parallel.}
+      \cgalParamType{Concurrency tag type (`CGAL::Sequential_tag` or `CGAL::Parallel_tag`)}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{The parallel mode requires \ref thirdpartyTBB. The resulting partition does not depend on the chosen tag.}
+    \cgalParamNEnd
   \cgalNamedParamsEnd
 
   \pre input data has been provided via `insert()`.
@@ -491,6 +515,20 @@ public:
     m_parameters.max_octree_node_size = parameters::choose_parameter(
       parameters::get_parameter(np, internal_np::max_octree_node_size), 40);
 
+    using Concurrency_tag = typename internal_np::Lookup_named_param_def<internal_np::concurrency_tag_t,
+                                                                         NamedParameters,
+                                                                         Sequential_tag>::type;
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert(!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                  "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+    m_parameters.parallel = std::is_convertible<Concurrency_tag, Parallel_tag>::value;
+    m_subpartition_parameters = m_parameters;
+    if (m_parameters.parallel) {
+      m_subpartition_parameters.verbose = false;
+      m_subpartition_parameters.debug = false;
+    }
+
     std::cout.precision(20);
     if (m_input_polygons.size() == 0) {
       std::cout << "Warning: Your input is empty!";
@@ -534,14 +572,28 @@ public:
     m_partitions.resize(m_partition_nodes.size());
     std::iota(m_partitions.begin(), m_partitions.end(), 0);
 
-    for (std::size_t idx : m_partitions) {
+    // The subpartitions only share read-only data and can be initialized independently.
+    auto initialize_partition = [&](std::size_t idx) {
       Sub_partition& partition = m_partition_nodes[idx];
       partition.index = idx;
 
-      partition.m_data = std::make_shared<Data_structure>(m_parameters, std::to_string(idx) + "-");
+      partition.m_data = std::make_shared<Data_structure>(m_subpartition_parameters, std::to_string(idx) + "-");
 
-      Initializer initializer(partition.clipped_polygons, partition.m_input_planes, *partition.m_data, m_parameters);
+      Initializer initializer(partition.clipped_polygons, partition.m_input_planes, *partition.m_data, m_subpartition_parameters);
       initializer.initialize(partition.bbox, partition.input_polygons);
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if (m_parameters.parallel) {
+      tbb::parallel_for(std::size_t(0), m_partitions.size(), [&](std::size_t i) {
+        initialize_partition(m_partitions[i]);
+      });
+    }
+    else
+#endif
+    {
+      for (std::size_t idx : m_partitions)
+        initialize_partition(idx);
     }
 
     // Timing.
@@ -579,88 +631,119 @@ public:
             for (boost::filesystem::directory_iterator end_dir_it, it("volumes/"); it != end_dir_it; ++it)
               boost::filesystem::remove_all(it->path());*/
 
-    for (std::size_t idx : m_partitions) {
-      Sub_partition& partition = m_partition_nodes[idx];
-      timer.reset();
-      std::cout.precision(20);
+    if (k == 0) { // for k = 0, we skip propagation
+      std::cout << "k needs to be a positive number" << std::endl;
 
+      return;
+    }
+
+    std::cout.precision(20);
+
+    for (std::size_t idx : m_partitions) {
       // Already initialized?
-      if (partition.m_data->number_of_support_planes() < 6) {
-        std::cout << "Kinetic partition not initialized or empty. Number of support planes: " << partition.m_data->number_of_support_planes() << std::endl;
+      if (m_partition_nodes[idx].m_data->number_of_support_planes() < 6) {
+        std::cout << "Kinetic partition not initialized or empty. Number of support planes: " << m_partition_nodes[idx].m_data->number_of_support_planes() << std::endl;
 
         return;
       }
+    }
 
-      if (k == 0) { // for k = 0, we skip propagation
-        std::cout << "k needs to be a positive number" << std::endl;
+    // Each subpartition is propagated and finalized on its own data structure,
+    // the subpartitions are only merged afterwards by make_conformal().
+    // The messages of each subpartition are gathered in its own log and
+    // written once all subpartitions are done, so that they do not interleave.
+    std::vector<FT> partition_times(m_partitions.size(), FT(0)), finalization_times(m_partitions.size(), FT(0));
+    std::vector<std::string> logs(m_partitions.size());
 
-        return;
-      }
+    auto partition_subpartition = [&](std::size_t n) {
+      const std::size_t idx = m_partitions[n];
+      Sub_partition& partition = m_partition_nodes[idx];
+      Timer partition_timer;
+      partition_timer.start();
+
+      std::ostringstream log;
+      log.precision(20);
 
       if (m_parameters.verbose) {
-        std::cout << std::endl << "--- RUNNING THE QUEUE:" << std::endl;
-        std::cout << "* propagation started" << std::endl;
+        log << std::endl << "--- RUNNING THE QUEUE:" << std::endl;
+        log << "* propagation started" << std::endl;
       }
 
       // Propagation.
-      Propagation propagation(*partition.m_data, m_parameters);
+      Propagation propagation(*partition.m_data, m_subpartition_parameters);
       std::size_t m_num_events = propagation.propagate(k);
 
-      partition_time += timer.time();
+      partition_times[n] = partition_timer.time();
 
       if (m_parameters.verbose) {
-        std::cout << "* propagation finished" << std::endl;
-        std::cout << "* number of events handled: " << m_num_events << std::endl;
+        log << "* propagation finished" << std::endl;
+        log << "* number of events handled: " << m_num_events << std::endl;
       }
 
       if (m_parameters.verbose) {
-        std::cout << std::endl << "--- FINALIZING PARTITION:" << std::endl;
+        log << std::endl << "--- FINALIZING PARTITION:" << std::endl;
       }
 
       // Finalization.
 
-      for (std::size_t i = 0; i < partition.m_data->number_of_support_planes(); i++)
-        if (!partition.m_data->support_plane(i).mesh().is_valid(true))
-          std::cout << i << ". support has an invalid mesh!" << std::endl;
+      auto check_initial_faces = [&](const char* message) {
+        for (std::size_t i = 6; i < partition.m_data->number_of_support_planes(); i++) {
+          bool initial = false;
+          typename Data_structure::Support_plane& sp = partition.m_data->support_plane(i);
+
+          for (const auto& f : sp.mesh().faces())
+            if (sp.is_initial(f)) {
+              initial = true;
+              break;
+            }
 
-      for (std::size_t i = 6; i < partition.m_data->number_of_support_planes(); i++) {
-        bool initial = false;
-        typename Data_structure::Support_plane& sp = partition.m_data->support_plane(i);
+          if (!initial)
+            log << i << message << std::endl;
+        }
+      };
 
-        for (const auto& f : sp.mesh().faces())
-          if (sp.is_initial(f)) {
-            initial = true;
-            break;
-          }
+      if (m_parameters.debug) {
+        for (std::size_t i = 0; i < partition.m_data->number_of_support_planes(); i++)
+          if (!partition.m_data->support_plane(i).mesh().is_valid(false))
+            log << i << ". support has an invalid mesh!" << std::endl;
 
-        if (!initial)
-          std::cout << i << " sp has no initial face before" << std::endl;
+        check_initial_faces(" sp has no initial face before");
       }
 
-      Finalizer finalizer(*partition.m_data, m_parameters);
+      Finalizer finalizer(*partition.m_data, m_subpartition_parameters);
 
       if (m_parameters.verbose)
-        std::cout << "* getting volumes ..." << std::endl;
+        log << "* getting volumes ..." << std::endl;
 
       finalizer.create_polyhedra();
-      finalization_time += timer.time();
+      finalization_times[n] = partition_timer.time();
 
-      for (std::size_t i = 6; i < partition.m_data->number_of_support_planes(); i++) {
-        bool initial = false;
-        typename Data_structure::Support_plane& sp = partition.m_data->support_plane(i);
+      if (m_parameters.debug)
+        check_initial_faces(" sp has no initial face");
 
-        for (const auto& f : sp.mesh().faces())
-          if (sp.is_initial(f)) {
-            initial = true;
-            break;
-          }
+      if (m_parameters.verbose)
+        log << idx << ". partition with " << partition.input_polygons.size() << " input polygons split into " << partition.m_data->number_of_volumes() << " volumes" << std::endl;
 
-        if (!initial)
-          std::cout << i << " sp has no initial face" << std::endl;
-      }
+      logs[n] = log.str();
+    };
 
-      if (m_parameters.verbose)
-        std::cout << idx << ". partition with " << partition.input_polygons.size() << " input polygons split into " << partition.m_data->number_of_volumes() << " volumes" << std::endl;
+#ifdef CGAL_LINKED_WITH_TBB
+    if (m_parameters.parallel) {
+      tbb::parallel_for(std::size_t(0), m_partitions.size(), partition_subpartition);
+    }
+    else
+#endif
+    {
+      for (std::size_t i = 0; i < m_partitions.size(); i++)
+        partition_subpartition(i);
+    }
+
+    for (const std::string& log : logs)
+      std::cout << log;
+
+    for (std::size_t i = 0; i < m_partitions.size(); i++) {
+      partition_time += partition_times[i];
+      finalization_time += finalization_times[i];
     }
 
     // Convert face_neighbors to pair<Index, Index>
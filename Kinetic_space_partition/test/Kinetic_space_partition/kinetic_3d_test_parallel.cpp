@@ -0,0 +1,80 @@
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Kinetic_space_partition_3.h>
+#include <CGAL/IO/polygon_soup_io.h>
+
+#include <algorithm>
+#include <iostream>
+#include <string>
+#include <vector>
+
+using EPICK = CGAL::Exact_predicates_inexact_constructions_kernel;
+using EPECK = CGAL::Exact_predicates_exact_constructions_kernel;
+
+using Point_3 = EPICK::Point_3;
+using KSP = CGAL::Kinetic_space_partition_3<EPICK, EPECK>;
+using LCC = CGAL::Linear_cell_complex_for_combinatorial_map<3, 3, CGAL::Linear_cell_complex_traits<3, EPECK>, KSP::Linear_cell_complex_min_items>;
+
+#ifdef CGAL_LINKED_WITH_TBB
+
+template<typename ConcurrencyTag>
+std::vector<unsigned int> partition(const std::vector<Point_3>& input_vertices,
+                                    const std::vector<std::vector<std::size_t> >& input_faces,
+                                    const unsigned int k,
+                                    std::vector<EPECK::Point_3>& centroids) {
+  KSP ksp(CGAL::parameters::verbose(false).debug(false));
+  ksp.insert(input_vertices, input_faces);
+
+  // Use a small node size, such that the input is split into several subpartitions.
+  ksp.initialize(CGAL::parameters::max_octree_depth(2)
+                                  .max_octree_node_size(5)
+                                  .concurrency_tag(ConcurrencyTag()));
+  ksp.partition(k);
+
+  LCC lcc;
+  ksp.get_linear_cell_complex(lcc);
+
+  centroids.clear();
+  for (const auto& volume : lcc.attributes<3>())
+    centroids.push_back(volume.info().barycenter);
+  std::sort(centroids.begin(), centroids.end());
+
+  std::vector<unsigned int> cells = { 0, 2, 3 };
+  return lcc.count_cells(cells);
+}
+
+void run_test(const std::string& input_filename, const unsigned int k) {
+  std::vector<Point_3> input_vertices;
+  std::vector<std::vector<std::size_t> > input_faces;
+
+  bool res = CGAL::IO::read_polygon_soup(input_filename, input_vertices, input_faces);
+  assert(res && !input_faces.empty());
+  CGAL_USE(res);
+
+  std::vector<EPECK::Point_3> seq_centroids, par_centroids;
+  std::vector<unsigned int> seq_count = partition<CGAL::Sequential_tag>(input_vertices, input_faces, k, seq_centroids);
+  std::vector<unsigned int> par_count = partition<CGAL::Parallel_tag>(input_vertices, input_faces, k, par_centroids);
+
+  std::cout << input_filename << " k = " << k << std::endl;
+  std::cout << "sequential: v " << seq_count[0] << " f " << seq_count[2] << " vol " << seq_count[3] << std::endl;
+  std::cout << "parallel:   v " << par_count[0] << " f " << par_count[2] << " vol " << par_count[3] << std::endl;
+
+  // The partition does not depend on the concurrency tag.
+  assert(seq_count == par_count);
+  assert(seq_centroids == par_centroids);
+}
+
+#endif // CGAL_LINKED_WITH_TBB
+
+int main(const int /* argc */, const char** /* argv */) {
+#ifdef CGAL_LINKED_WITH_TBB
+  run_test("data/stress-test-4/test-9-rnd-polygons-12-4.off", 1);
+  run_test("data/real-data-test/test-15-polygons.off", 2);
+  run_test("data/real-data-test/test-40-polygons.ply", 1);
+#else
+  std::cout << "Warning: TBB is not available, the parallel partition is not tested" << std::endl;
+#endif
+
+  std::cout << "Done!" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,105 @@
+// Measures the throughput of the Boolean operations of Nef_polyhedron_3.
+// Usage: nef_3_boolean_operations [mesh.off] [number_of_runs]
+// The second operand is a translated copy of the first one.
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Nef_polyhedron_3.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Real_timer.h>
+#include <CGAL/IO/polygon_mesh_io.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+
+#include <iostream>
+#include <string>
+#include <type_traits>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel   Kernel;
+typedef Kernel::Vector_3                                    Vector_3;
+typedef CGAL::Surface_mesh<Kernel::Point_3>                 Mesh;
+typedef CGAL::Nef_polyhedron_3<Kernel>                      Nef_polyhedron;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+template <typename ConcurrencyTag>
+void run(const Nef_polyhedron& N0, const Nef_polyhedron& N1, int runs)
+{
+  std::cout << (std::is_same<ConcurrencyTag, CGAL::Parallel_tag>::value ? "Parallel" : "Sequential")
+            << " binary operations" << std::endl;
+
+  CGAL::Real_timer timer;
+  double t_union = 0, t_intersection = 0, t_difference = 0;
+  std::size_t nv_union = 0, nv_intersection = 0, nv_difference = 0;
+  for(int i=0; i<runs; ++i)
+  {
+    timer.reset();
+    timer.start();
+    Nef_polyhedron U = N0.join(N1, ConcurrencyTag());
+    timer.stop();
+    t_union += timer.time();
+    nv_union = U.number_of_vertices();
+
+    timer.reset();
+    timer.start();
+    Nef_polyhedron I = N0.intersection(N1, ConcurrencyTag());
+    timer.stop();
+    t_intersection += timer.time();
+    nv_intersection = I.number_of_vertices();
+
+    timer.reset();
+    timer.start();
+    Nef_polyhedron D = N0.difference(N1, ConcurrencyTag());
+    timer.stop();
+    t_difference += timer.time();
+    nv_difference = D.number_of_vertices();
+  }
+
+  std::cout << "Union:        " << t_union / runs << " sec. ("
+            << nv_union << " vertices)" << std::endl;
+  std::cout << "Intersection: " << t_intersection / runs << " sec. ("
+            << nv_intersection << " vertices)" << std::endl;
+  std::cout << "Difference:   " << t_difference / runs << " sec. ("
+            << nv_difference << " vertices)" << std::endl;
+  std::cout << "Throughput:   " << 3 * runs * (N0.number_of_facets() + N1.number_of_facets())
+                                   / (t_union + t_intersection + t_difference)
+            << " input facets per second" << std::endl;
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/larger_sphere.off");
+  const int runs = (argc > 2) ? std::stoi(argv[2]) : 1;
+
+  Mesh mesh;
+  if(!CGAL::IO::read_polygon_mesh(filename, mesh) || !CGAL::is_triangle_mesh(mesh))
+  {
+    std::cerr << "Invalid input: " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Input: " << filename << " (" << num_faces(mesh) << " faces)" << std::endl;
+
+  CGAL::Real_timer timer;
+  timer.start();
+  Nef_polyhedron N0(mesh);
+
+  // shift the second operand by a fraction of the bounding box so that the
+  // two solids overlap in many edge/facet pairs
+  CGAL::Bbox_3 bb = PMP::bbox(mesh);
+  Mesh mesh_1 = mesh;
+  PMP::transform(Kernel::Aff_transformation_3(CGAL::TRANSLATION,
+                                              Vector_3(0.1 * (bb.xmax() - bb.xmin()),
+                                                       0.05 * (bb.ymax() - bb.ymin()),
+                                                       0.07 * (bb.zmax() - bb.zmin()))),
+                 mesh_1);
+  Nef_polyhedron N1(mesh_1);
+  timer.stop();
+  std::cout << "Conversion to Nef_polyhedron_3: " << timer.time() << " sec." << std::endl;
+
+  run<CGAL::Sequential_tag>(N0, N1, runs);
+#ifdef CGAL_LINKED_WITH_TBB
+  run<CGAL::Parallel_tag>(N0, N1, runs);
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -1435,23 +1435,39 @@ public:
 
 /*!
   return the intersection of `N` and N1.
+
+  \tparam ConcurrencyTag enables sequential versus parallel algorithm.
+  Possible values are `Sequential_tag`, `Parallel_tag`, and `Parallel_if_available_tag`.
+  With `Parallel_tag`, the point location of the vertices and the intersection tests
+  between the edges and facets of both operands are performed in parallel.
 */
-  Nef_polyhedron_3<Traits> intersection(const Nef_polyhedron_3<Traits>& N1) const;
+  template <typename ConcurrencyTag = Sequential_tag>
+  Nef_polyhedron_3<Traits> intersection(const Nef_polyhedron_3<Traits>& N1,
+                                        ConcurrencyTag tag = ConcurrencyTag()) const;
 
 /*!
   return the union of `N` and N1. (Note that ''union'' is a C++ keyword and cannot be used for this operation.)
+  `ConcurrencyTag` is as for `intersection()`.
 */
-  Nef_polyhedron_3<Traits> join(const Nef_polyhedron_3<Traits>& N1) const;
+  template <typename ConcurrencyTag = Sequential_tag>
+  Nef_polyhedron_3<Traits> join(const Nef_polyhedron_3<Traits>& N1,
+                                ConcurrencyTag tag = ConcurrencyTag()) const;
 
 /*!
   return the difference between `N` and N1.
+  `ConcurrencyTag` is as for `intersection()`.
 */
-  Nef_polyhedron_3<Traits> difference(const Nef_polyhedron_3<Traits>& N1) const;
+  template <typename ConcurrencyTag = Sequential_tag>
+  Nef_polyhedron_3<Traits> difference(const Nef_polyhedron_3<Traits>& N1,
+                                      ConcurrencyTag tag = ConcurrencyTag()) const;
 
 /*!
   return the symmetric difference of `N` and N1.
+  `ConcurrencyTag` is as for `intersection()`.
 */
-  Nef_polyhedron_3<Traits> symmetric_difference(const Nef_polyhedron_3<Traits>& N1) const;
+  template <typename ConcurrencyTag = Sequential_tag>
+  Nef_polyhedron_3<Traits> symmetric_difference(const Nef_polyhedron_3<Traits>& N1,
+                                                ConcurrencyTag tag = ConcurrencyTag()) const;
 
 /*!
   returns intersection of `N` with
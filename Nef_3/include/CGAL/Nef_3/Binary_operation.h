@@ -32,6 +32,9 @@
 #include <CGAL/Nef_3/SNC_point_locator.h>
 #include <CGAL/Nef_3/binop_intersection_tests.h>
 #include <CGAL/Nef_3/ID_support_handler.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <vector>
 //#include <CGAL/Nef_3/Edge_edge_overlay.h>
 
 #undef CGAL_NEF_DEBUG
@@ -168,6 +171,23 @@ class Binary_operation : public CGAL::SNC_decorator<Map> {
     return v;
   }
 
+  /*{\opLocates the vertices |vertices| in the structure of |pl| and
+     stores the located objects in |objects|. The point locator is only
+     read, hence with |Parallel_tag| the queries are answered concurrently.}*/
+  template <typename ConcurrencyTag, typename Point_locator>
+  static void locate_vertices( const Point_locator* pl,
+                               const std::vector<Vertex_const_handle>& vertices,
+                               std::vector<Object_handle>& objects)
+  {
+    objects.resize(vertices.size());
+    CGAL::for_each<ConcurrencyTag>(CGAL::make_counting_range<std::size_t>(0, vertices.size()),
+                                   [&](const std::size_t i) -> bool
+                                   {
+                                     objects[i] = pl->locate(vertices[i]->point());
+                                     return true;
+                                   });
+  }
+
   template <typename SNC_decorator,
             typename Selection,
             typename Association>
@@ -236,16 +256,19 @@ class Binary_operation : public CGAL::SNC_decorator<Map> {
     Association& A;
   };
 
-  template <typename Selection>
+  template <typename Selection, typename ConcurrencyTag = Sequential_tag>
     void operator()( SNC_point_locator* pl0,
                      const SNC_structure& snc1,
                      const SNC_point_locator* pl1,
                      const SNC_structure& snc2,
                      const SNC_point_locator* pl2,
-                     const Selection& BOP)
+                     const Selection& BOP,
+                     ConcurrencyTag = ConcurrencyTag())
       /*{\opPerforms a binary operation defined on |BOP| between two
       SNC structures.  The input structures are not modified and the
-      result of the operation is stored in |result|.
+      result of the operation is stored in |result|. With |Parallel_tag|,
+      the point location of the vertices and the intersection tests are
+      performed concurrently.
       \precondition: the structure |result| is empty.}*/
   {
     //    CGAL_NEF_SETDTHREAD(23);
@@ -306,23 +329,34 @@ class Binary_operation : public CGAL::SNC_decorator<Map> {
     CGAL_forall_shalfloops(sli, snc2)
       A.initialize_hash(sli);
 
-    CGAL_forall_vertices( v0, snc1) {
+    // The sphere map overlays below modify the result structure and are
+    // performed one after the other. The point location queries only read
+    // the input structures and are answered beforehand, all at once.
+    std::vector<Vertex_const_handle> located_vertices;
+    std::vector<Object_handle> located_objects;
+    located_vertices.reserve(snc1.number_of_vertices());
+    CGAL_forall_vertices( v0, snc1)
+      located_vertices.push_back(v0);
+
+#ifdef CGAL_NEF3_TIMER_POINT_LOCATION
+    number_of_point_location_queries += located_vertices.size();
+    timer_point_location.start();
+#endif
+    locate_vertices<ConcurrencyTag>(pl2, located_vertices, located_objects);
+#ifdef CGAL_NEF3_TIMER_POINT_LOCATION
+    timer_point_location.stop();
+#endif
+
+    for(std::size_t i = 0; i < located_vertices.size(); ++i) {
+      v0 = located_vertices[i];
       CGAL_assertion(!ignore[v0]);
       Point_3 p0(v0->point());
       Vertex_handle v;
       Halfedge_handle e;
       Halffacet_handle f;
       Volume_handle c;
-      CGAL_NEF_TRACEN("Locating point " << p0);
-
-#ifdef CGAL_NEF3_TIMER_POINT_LOCATION
-      ++number_of_point_location_queries;
-      timer_point_location.start();
-#endif
-      Object_handle o = pl2->locate(p0);
-#ifdef CGAL_NEF3_TIMER_POINT_LOCATION
-      timer_point_location.stop();
-#endif
+      CGAL_NEF_TRACEN("Located point " << p0);
+      const Object_handle& o = located_objects[i];
 
 #if defined(CGAL_NEF3_TIMER_OVERLAY)
       timer_overlay.start();
@@ -379,24 +413,29 @@ class Binary_operation : public CGAL::SNC_decorator<Map> {
                     << this->sncp()->number_of_vertices());
 
     CGAL_NEF_TRACEN("=> for all v1 in snc1, qualify v1 with respect snc0");
-    CGAL_forall_vertices( v0, snc2) {
-
-      if(ignore[v0]) continue;
-      Point_3 p1(v0->point());
-      Halfedge_handle e;
-      Halffacet_handle f;
-      Volume_handle c;
-      CGAL_NEF_TRACEN("Locating point " << p1);
+    located_vertices.clear();
+    CGAL_forall_vertices( v0, snc2)
+      if(!ignore[v0])
+        located_vertices.push_back(v0);
 
 #ifdef CGAL_NEF3_TIMER_POINT_LOCATION
-      number_of_point_location_queries++;
-      timer_point_location.start();
+    number_of_point_location_queries += located_vertices.size();
+    timer_point_location.start();
 #endif
-      Object_handle o = pl1->locate(p1);
+    locate_vertices<ConcurrencyTag>(pl1, located_vertices, located_objects);
 #ifdef CGAL_NEF3_TIMER_POINT_LOCATION
-      timer_point_location.stop();
+    timer_point_location.stop();
 #endif
 
+    for(std::size_t i = 0; i < located_vertices.size(); ++i) {
+      v0 = located_vertices[i];
+      Point_3 p1(v0->point());
+      Halfedge_handle e;
+      Halffacet_handle f;
+      Volume_handle c;
+      CGAL_NEF_TRACEN("Located point " << p1);
+      const Object_handle& o = located_objects[i];
+
       CGAL_assertion_code(Vertex_handle v);
       CGAL_assertion( !CGAL::assign( v, o));
 
@@ -506,7 +545,7 @@ class Binary_operation : public CGAL::SNC_decorator<Map> {
                     << this->sncp()->number_of_vertices());
 #else
     CGAL_NEF_TRACEN("intersection by fast box intersection");
-        binop_intersection_test_segment_tree<SNC_const_decorator> binop_box_intersection;
+        binop_intersection_test_segment_tree<SNC_const_decorator, ConcurrencyTag> binop_box_intersection;
         binop_box_intersection(call_back0, call_back1, snc1, snc2);
 #endif
 
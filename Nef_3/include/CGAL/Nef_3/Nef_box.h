@@ -130,17 +130,17 @@ class Nef_box : public Box_intersection_d::Box_d< double, 3 > {
     }
   }
 
-  Halffacet_handle get_halffacet() {
+  Halffacet_handle get_halffacet() const {
     CGAL_assertion( type == FACET );
     return f;
   }
 
-  Halfedge_handle get_halfedge() {
+  Halfedge_handle get_halfedge() const {
     CGAL_assertion( type == EDGE );
     return e;
   }
 
-  Vertex_handle get_vertex() {
+  Vertex_handle get_vertex() const {
     CGAL_assertion(type == VERTEX);
     return v;
   }
@@ -101,18 +101,16 @@ class SNC_indexed_items {
     typedef SHalfloop_base<Refs>                    Base;
     typedef typename Refs::Halffacet_const_handle Halffacet_const_handle;
     int index;
+    // a default constructed handle means that the facet is not set
     Halffacet_const_handle ifacet;
-    bool init_ifacet;
   public:
-    SHalfloop() : Base(), index(0), init_ifacet(false) {}
+    SHalfloop() : Base(), index(0), ifacet() {}
     SHalfloop(const SHalfloop<Refs>& sl)
-      : Base(sl), index(0),
-      ifacet(sl.ifacet), init_ifacet(sl.init_ifacet) {}
+      : Base(sl), index(0), ifacet(sl.ifacet) {}
     SHalfloop<Refs>& operator=(const SHalfloop<Refs>& sl) {
       (Base&) *this = (Base) sl;
       index = sl.index;
       ifacet = sl.ifacet;
-      init_ifacet = sl.init_ifacet;
       return *this;
     }
     int new_index()
@@ -121,13 +119,12 @@ class SNC_indexed_items {
     { index = idx; }
     int get_index() const { return index; }
     Halffacet_const_handle get_index_facet() const {
-      if(init_ifacet)
+      if(ifacet != Halffacet_const_handle())
         return ifacet;
       return this->facet();
     }
     void set_index_facet(Halffacet_const_handle f) {
       ifacet = f;
-      init_ifacet = true;
     }
   };
 
@@ -136,19 +133,18 @@ class SNC_indexed_items {
     typedef typename Refs::Halffacet_const_handle Halffacet_const_handle;
     int index;
     int index2;
+    // a default constructed handle means that the facet is not set
     Halffacet_const_handle ifacet;
-    bool init_ifacet;
   public:
-    SHalfedge() : Base(), index(0), index2(0), init_ifacet(false) {}
+    SHalfedge() : Base(), index(0), index2(0), ifacet() {}
     SHalfedge(const SHalfedge<Refs>& se)
       : Base(se), index(se.index), index2(se.index2),
-      ifacet(se.ifacet), init_ifacet(se.init_ifacet) {}
+      ifacet(se.ifacet) {}
     SHalfedge<Refs>& operator=(const SHalfedge<Refs>& se) {
       (Base&) *this = (Base) se;
       index = se.index;
       index2 = se.index2;
       ifacet = se.ifacet;
-      init_ifacet = se.init_ifacet;
       return *this;
     }
     int new_index()
@@ -164,13 +160,12 @@ class SNC_indexed_items {
     int get_backward_index() { return index2; }
     int get_smaller_index() { return index < index2 ? index : index2; }
     Halffacet_const_handle get_index_facet() const {
-      if(init_ifacet)
+      if(ifacet != Halffacet_const_handle())
         return ifacet;
       return this->facet();
     }
     void set_index_facet(Halffacet_const_handle f) {
       ifacet = f;
-      init_ifacet = true;
     }
   };
 
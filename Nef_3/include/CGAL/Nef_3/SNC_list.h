@@ -18,6 +18,11 @@
 
 #include <CGAL/Nef_S2/SM_list.h>
 
+// The allocator used for all the items of an SNC structure.
+#ifndef CGAL_NEF3_ALLOCATOR
+#  define CGAL_NEF3_ALLOCATOR(T) CGAL_ALLOCATOR(T)
+#endif
+
 namespace CGAL {
 
 template < class Sphere_map>
@@ -131,8 +131,8 @@ public:
  public:
   typedef Sphere_map                                        Vertex_base;
   typedef SNC_in_place_list_sm<Vertex_base>                 Vertex;
-  typedef CGAL::In_place_list<Vertex,false>                 Vertex_list;
-  typedef CGAL_ALLOCATOR(Vertex)                            Vertex_alloc;
+  typedef CGAL_NEF3_ALLOCATOR(Vertex)                       Vertex_alloc;
+  typedef CGAL::In_place_list<Vertex,false,Vertex_alloc>    Vertex_list;
   typedef typename Vertex_list::iterator                    Vertex_handle;
   typedef typename Vertex_list::const_iterator              Vertex_const_handle;
   typedef typename Vertex_list::iterator                    Vertex_iterator;
@@ -140,8 +140,8 @@ public:
 
   typedef typename Items::template Halffacet<SNC_structure> Halffacet_base;
   typedef SNC_in_place_list_halffacet<Halffacet_base>       Halffacet;
-  typedef CGAL::In_place_list<Halffacet,false>              Halffacet_list;
-  typedef CGAL_ALLOCATOR(Halffacet)                         Halffacet_alloc;
+  typedef CGAL_NEF3_ALLOCATOR(Halffacet)                    Halffacet_alloc;
+  typedef CGAL::In_place_list<Halffacet,false,Halffacet_alloc> Halffacet_list;
   typedef typename Halffacet_list::iterator                 Halffacet_handle;
   typedef typename Halffacet_list::const_iterator           Halffacet_const_handle;
   typedef typename Halffacet_list::iterator                 Halffacet_iterator;
@@ -149,8 +149,8 @@ public:
 
   typedef typename Items::template Volume<SNC_structure>    Volume_base;
   typedef SNC_in_place_list_volume<Volume_base>             Volume;
-  typedef CGAL::In_place_list<Volume,false>                 Volume_list;
-  typedef CGAL_ALLOCATOR(Volume)                            Volume_alloc;
+  typedef CGAL_NEF3_ALLOCATOR(Volume)                       Volume_alloc;
+  typedef CGAL::In_place_list<Volume,false,Volume_alloc>    Volume_list;
   typedef typename Volume_list::iterator                    Volume_handle;
   typedef typename Volume_list::const_iterator              Volume_const_handle;
   typedef typename Volume_list::iterator                    Volume_iterator;
@@ -158,8 +158,8 @@ public:
 
   typedef typename Items::template SVertex<SNC_structure>   SVertex_base;
   typedef SNC_in_place_list_svertex<SVertex_base>           SVertex;
-  typedef CGAL::In_place_list<SVertex,false>                SVertex_list;
-  typedef CGAL_ALLOCATOR(SVertex)                           SVertex_alloc;
+  typedef CGAL_NEF3_ALLOCATOR(SVertex)                      SVertex_alloc;
+  typedef CGAL::In_place_list<SVertex,false,SVertex_alloc>  SVertex_list;
   typedef typename SVertex_list::iterator                   SVertex_handle;
   typedef typename SVertex_list::const_iterator             SVertex_const_handle;
   typedef typename SVertex_list::iterator                   SVertex_iterator;
@@ -167,8 +167,8 @@ public:
 
   typedef typename Items::template SVertex<SNC_structure>   Halfedge_base;
   typedef SNC_in_place_list_svertex<SVertex_base>           Halfedge;
-  typedef CGAL::In_place_list<SVertex,false>                Halfedge_list;
-  typedef CGAL_ALLOCATOR(SVertex)                           Halfedge_alloc;
+  typedef CGAL_NEF3_ALLOCATOR(SVertex)                      Halfedge_alloc;
+  typedef CGAL::In_place_list<SVertex,false,Halfedge_alloc> Halfedge_list;
   typedef typename SVertex_list::iterator                   Halfedge_handle;
   typedef typename SVertex_list::const_iterator             Halfedge_const_handle;
   typedef typename SVertex_list::iterator                   Halfedge_iterator;
@@ -176,8 +176,8 @@ public:
 
   typedef typename Items::template SHalfedge<SNC_structure> SHalfedge_base;
   typedef SNC_in_place_list_shalfedge<SHalfedge_base>       SHalfedge;
-  typedef CGAL::In_place_list<SHalfedge,false>              SHalfedge_list;
-  typedef CGAL_ALLOCATOR(SHalfedge)                         SHalfedge_alloc;
+  typedef CGAL_NEF3_ALLOCATOR(SHalfedge)                    SHalfedge_alloc;
+  typedef CGAL::In_place_list<SHalfedge,false,SHalfedge_alloc> SHalfedge_list;
   typedef typename SHalfedge_list::iterator                 SHalfedge_handle;
   typedef typename SHalfedge_list::const_iterator           SHalfedge_const_handle;
   typedef typename SHalfedge_list::iterator                 SHalfedge_iterator;
@@ -185,8 +185,8 @@ public:
 
   typedef typename Items::template SHalfloop<SNC_structure> SHalfloop_base;
   typedef SNC_in_place_list_shalfloop<SHalfloop_base>       SHalfloop;
-  typedef CGAL::In_place_list<SHalfloop,false>              SHalfloop_list;
-  typedef CGAL_ALLOCATOR(SHalfloop)                         SHalfloop_alloc;
+  typedef CGAL_NEF3_ALLOCATOR(SHalfloop)                    SHalfloop_alloc;
+  typedef CGAL::In_place_list<SHalfloop,false,SHalfloop_alloc> SHalfloop_list;
   typedef typename SHalfloop_list::iterator                 SHalfloop_handle;
   typedef typename SHalfloop_list::const_iterator           SHalfloop_const_handle;
   typedef typename SHalfloop_list::iterator                 SHalfloop_iterator;
@@ -194,8 +194,8 @@ public:
 
   typedef typename Items::template SFace<SNC_structure>     SFace_base;
   typedef SNC_in_place_list_sface<SFace_base>               SFace;
-  typedef CGAL::In_place_list<SFace,false>                  SFace_list;
-  typedef CGAL_ALLOCATOR(SFace)                             SFace_alloc;
+  typedef CGAL_NEF3_ALLOCATOR(SFace)                        SFace_alloc;
+  typedef CGAL::In_place_list<SFace,false,SFace_alloc>      SFace_list;
   typedef typename SFace_list::iterator                     SFace_handle;
   typedef typename SFace_list::const_iterator               SFace_const_handle;
   typedef typename SFace_list::iterator                     SFace_iterator;
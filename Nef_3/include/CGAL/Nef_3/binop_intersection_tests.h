@@ -18,11 +18,15 @@
 #include <CGAL/Nef_3/Nef_box.h>
 #include <CGAL/Nef_3/Infimaximal_box.h>
 #include <CGAL/Nef_3/SNC_const_decorator.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+#include <type_traits>
 #include <vector>
 
 namespace CGAL {
 
-template<class SNC_decorator>
+template<class SNC_decorator, class ConcurrencyTag = Sequential_tag>
 struct binop_intersection_test_segment_tree {
   typedef typename SNC_decorator::SNC_structure          SNC_structure;
   typedef typename CGAL::SNC_intersection<SNC_structure> SNC_intersection;
@@ -44,19 +48,26 @@ struct binop_intersection_test_segment_tree {
     : cb(cb)
     {}
 
+    static bool intersect( const Nef_box& box0, const Nef_box& box1, Point_3& ip ) {
+      Halfedge_iterator  e0 = box0.get_halfedge();
+      Halffacet_iterator f1 = box1.get_halffacet();
+      if( Infi_box::degree( f1->plane().d() ) > 0 )
+        return false;
+      return SNC_intersection::does_intersect_internally( Const_decorator::segment(e0), f1, ip );
+    }
+
+    void report( const Nef_box& box0, const Nef_box& box1, const Point_3& ip ) {
+      cb(box0.get_halfedge(), box1.get_halffacet(), ip);
+    }
+
     void operator()( Nef_box& box0, Nef_box& box1 ) {
 
 #ifdef CGAL_NEF3_DUMP_STATISTICS
       ++number_of_intersection_candidates;
 #endif
-      Halfedge_iterator  e0 = box0.get_halfedge();
-      Halffacet_iterator f1 = box1.get_halffacet();
-      if( Infi_box::degree( f1->plane().d() ) > 0 )
-        return;
       Point_3 ip;
-      if( SNC_intersection::does_intersect_internally( Const_decorator::segment(e0), f1, ip )) {
-        cb(e0,f1,ip);
-      }
+      if( intersect( box0, box1, ip ))
+        report( box0, box1, ip );
     }
   };
 
@@ -68,19 +79,27 @@ struct binop_intersection_test_segment_tree {
     : cb(cb)
     {}
 
+    static bool intersect( const Nef_box& box0, const Nef_box& box1, Point_3& ip ) {
+      Halfedge_iterator  e1 = box0.get_halfedge();
+      Halffacet_iterator f0 = box1.get_halffacet();
+      if( Infi_box::degree( f0->plane().d() ) > 0 )
+        return false;
+      return SNC_intersection::does_intersect_internally( Const_decorator::segment( e1 ),
+                                                          f0, ip );
+    }
+
+    void report( const Nef_box& box0, const Nef_box& box1, const Point_3& ip ) {
+      cb(box0.get_halfedge(), box1.get_halffacet(), ip);
+    }
+
     void operator()( Nef_box& box0, Nef_box& box1 ) {
 
 #ifdef CGAL_NEF3_DUMP_STATISTICS
       ++number_of_intersection_candidates;
 #endif
-      Halfedge_iterator  e1 = box0.get_halfedge();
-      Halffacet_iterator f0 = box1.get_halffacet();
-      if( Infi_box::degree( f0->plane().d() ) > 0 )
-        return;
       Point_3 ip;
-      if( SNC_intersection::does_intersect_internally( Const_decorator::segment( e1 ),
-                                                       f0, ip ) )
-        cb(e1,f0,ip);
+      if( intersect( box0, box1, ip ))
+        report( box0, box1, ip );
     }
   };
 
@@ -92,20 +111,77 @@ struct binop_intersection_test_segment_tree {
     : cb(cb)
     {}
 
+    static bool intersect( const Nef_box& box0, const Nef_box& box1, Point_3& ip ) {
+      Halfedge_iterator e0 = box0.get_halfedge();
+      Halfedge_iterator e1 = box1.get_halfedge();
+      return SNC_intersection::does_intersect_internally( Const_decorator::segment( e0 ),
+                                                          Const_decorator::segment( e1 ), ip );
+    }
+
+    void report( const Nef_box& box0, const Nef_box& box1, const Point_3& ip ) {
+      cb(box0.get_halfedge(), box1.get_halfedge(), ip);
+    }
+
     void operator()( Nef_box& box0, Nef_box& box1 ) {
 
 #ifdef CGAL_NEF3_DUMP_STATISTICS
       ++number_of_intersection_candidates;
 #endif
-      Halfedge_iterator e0 = box0.get_halfedge();
-      Halfedge_iterator e1 = box1.get_halfedge();
       Point_3 ip;
-      if( SNC_intersection::does_intersect_internally( Const_decorator::segment( e0 ),
-                                                       Const_decorator::segment( e1 ), ip ))
-        cb(e0,e1,ip);
+      if( intersect( box0, box1, ip ))
+        report( box0, box1, ip );
+    }
+  };
+
+  // Collects the candidate pairs reported by the box intersection, so that
+  // the (exact, hence expensive) intersection tests can be run in parallel.
+  struct Candidate_collector {
+    std::vector<std::pair<Nef_box, Nef_box> >& candidates;
+
+    Candidate_collector(std::vector<std::pair<Nef_box, Nef_box> >& candidates)
+    : candidates(candidates)
+    {}
+
+    void operator()( Nef_box& box0, Nef_box& box1 ) {
+
+#ifdef CGAL_NEF3_DUMP_STATISTICS
+      ++number_of_intersection_candidates;
+#endif
+      candidates.emplace_back(box0, box1);
     }
   };
 
+  // Tests all candidate pairs concurrently. The inputs are only read, and
+  // the intersections found are then reported sequentially, in the order
+  // in which the box intersection enumerated them, because the call backs
+  // modify the result structure.
+  template<class Bop_callback>
+  void test_candidates( std::vector<Nef_box>& boxes0,
+                        std::vector<Nef_box>& boxes1,
+                        Bop_callback& callback )
+  {
+    std::vector<std::pair<Nef_box, Nef_box> > candidates;
+    Candidate_collector collector( candidates );
+    box_intersection_d( boxes0.begin(), boxes0.end(),
+                        boxes1.begin(), boxes1.end(),
+                        collector);
+
+    std::vector<Point_3> ips( candidates.size() );
+    std::vector<unsigned char> found( candidates.size(), 0 );
+    CGAL::for_each<ConcurrencyTag>( CGAL::make_counting_range<std::size_t>(0, candidates.size()),
+                                    [&](const std::size_t i) -> bool
+                                    {
+                                      found[i] = Bop_callback::intersect( candidates[i].first,
+                                                                          candidates[i].second,
+                                                                          ips[i] );
+                                      return true;
+                                    });
+
+    for(std::size_t i = 0; i < candidates.size(); ++i)
+      if( found[i] )
+        callback.report( candidates[i].first, candidates[i].second, ips[i] );
+  }
+
   template<class Callback>
   void operator()(Callback& cb0,
                   Callback& cb1,
@@ -126,23 +202,42 @@ struct binop_intersection_test_segment_tree {
     CGAL_forall_facets( f0, snc0) f0boxes.push_back( Nef_box( f0 ) );
     CGAL_forall_facets( f1, snc1) f1boxes.push_back( Nef_box( f1 ) );
 
-    CGAL_NEF_TRACEN("start edge0 edge1");
-    Bop_edge0_edge1_callback<Callback> callback_edge0_edge1( cb0 );
-    box_intersection_d( e0boxes.begin(), e0boxes.end(),
-                        e1boxes.begin(), e1boxes.end(),
-                        callback_edge0_edge1);
-
-    CGAL_NEF_TRACEN("start edge0 face1");
-    Bop_edge0_face1_callback<Callback> callback_edge0_face1( cb0 );
-    box_intersection_d( e0boxes.begin(), e0boxes.end(),
-                        f1boxes.begin(), f1boxes.end(),
-                        callback_edge0_face1);
-
-    CGAL_NEF_TRACEN("start edge1 face0");
-    Bop_edge1_face0_callback<Callback> callback_edge1_face0( cb1 );
-    box_intersection_d( e1boxes.begin(), e1boxes.end(),
-                        f0boxes.begin(), f0boxes.end(),
-                        callback_edge1_face0);
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    if constexpr (std::is_convertible<ConcurrencyTag, Parallel_tag>::value) {
+      CGAL_NEF_TRACEN("start edge0 edge1");
+      Bop_edge0_edge1_callback<Callback> callback_edge0_edge1( cb0 );
+      test_candidates( e0boxes, e1boxes, callback_edge0_edge1 );
+
+      CGAL_NEF_TRACEN("start edge0 face1");
+      Bop_edge0_face1_callback<Callback> callback_edge0_face1( cb0 );
+      test_candidates( e0boxes, f1boxes, callback_edge0_face1 );
+
+      CGAL_NEF_TRACEN("start edge1 face0");
+      Bop_edge1_face0_callback<Callback> callback_edge1_face0( cb1 );
+      test_candidates( e1boxes, f0boxes, callback_edge1_face0 );
+    } else {
+      CGAL_NEF_TRACEN("start edge0 edge1");
+      Bop_edge0_edge1_callback<Callback> callback_edge0_edge1( cb0 );
+      box_intersection_d( e0boxes.begin(), e0boxes.end(),
+                          e1boxes.begin(), e1boxes.end(),
+                          callback_edge0_edge1);
+
+      CGAL_NEF_TRACEN("start edge0 face1");
+      Bop_edge0_face1_callback<Callback> callback_edge0_face1( cb0 );
+      box_intersection_d( e0boxes.begin(), e0boxes.end(),
+                          f1boxes.begin(), f1boxes.end(),
+                          callback_edge0_face1);
+
+      CGAL_NEF_TRACEN("start edge1 face0");
+      Bop_edge1_face0_callback<Callback> callback_edge1_face0( cb1 );
+      box_intersection_d( e1boxes.begin(), e1boxes.end(),
+                          f0boxes.begin(), f0boxes.end(),
+                          callback_edge1_face0);
+    }
   }
 };
 
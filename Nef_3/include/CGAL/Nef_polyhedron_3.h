@@ -1399,8 +1399,10 @@ protected:
     return res;
   }
 
+  template <typename ConcurrencyTag = Sequential_tag>
   Nef_polyhedron_3<Kernel,Items, Mark>
-  intersection(const Nef_polyhedron_3<Kernel,Items, Mark>& N1) const
+  intersection(const Nef_polyhedron_3<Kernel,Items, Mark>& N1,
+               ConcurrencyTag tag = ConcurrencyTag()) const
     /*{\Mop returns |\Mvar| $\cap$ |N1|. }*/ {
     CGAL_NEF_TRACEN(" intersection between nef3 "<<&*this<<" and "<<&N1);
     if (is_empty()) return *this;
@@ -1410,7 +1412,7 @@ protected:
     AND _and;
     Nef_polyhedron_3<Kernel,Items, Mark> res(Private_tag{});
     Binary_operation bo( res.snc());
-    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _and);
+    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _and, tag);
     return res;
   }
 
@@ -1425,8 +1427,10 @@ protected:
     return res;
   }
 
+  template <typename ConcurrencyTag = Sequential_tag>
   Nef_polyhedron_3<Kernel,Items, Mark>
-  join(const Nef_polyhedron_3<Kernel,Items, Mark>& N1) const
+  join(const Nef_polyhedron_3<Kernel,Items, Mark>& N1,
+       ConcurrencyTag tag = ConcurrencyTag()) const
   /*{\Mop returns |\Mvar| $\cup$ |N1|. }*/ {
     CGAL_NEF_TRACEN(" join between nef3 "<<&*this<<" and "<<&N1);
     if (is_empty()) return N1;
@@ -1437,12 +1441,14 @@ protected:
     //CGAL::binop_intersection_tests_allpairs<SNC_decorator, OR> tests_impl;
     Nef_polyhedron_3<Kernel,Items, Mark> res(Private_tag{});
     Binary_operation bo(res.snc());
-    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _or);
+    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _or, tag);
     return res;
   }
 
+  template <typename ConcurrencyTag = Sequential_tag>
   Nef_polyhedron_3<Kernel,Items, Mark>
-  difference(const Nef_polyhedron_3<Kernel,Items, Mark>& N1) const
+  difference(const Nef_polyhedron_3<Kernel,Items, Mark>& N1,
+             ConcurrencyTag tag = ConcurrencyTag()) const
   /*{\Mop returns |\Mvar| $-$ |N1|. }*/ {
     CGAL_NEF_TRACEN(" difference between nef3 "<<&*this<<" and "<<&N1);
     if (is_empty()) return *this;
@@ -1453,12 +1459,14 @@ protected:
     //CGAL::binop_intersection_tests_allpairs<SNC_decorator, DIFF> tests_impl;
     Nef_polyhedron_3<Kernel,Items, Mark> res(Private_tag{});
     Binary_operation bo(res.snc());
-    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _diff);
+    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _diff, tag);
     return res;
   }
 
+  template <typename ConcurrencyTag = Sequential_tag>
   Nef_polyhedron_3<Kernel,Items, Mark>
-  symmetric_difference(const Nef_polyhedron_3<Kernel,Items, Mark>& N1) const
+  symmetric_difference(const Nef_polyhedron_3<Kernel,Items, Mark>& N1,
+                       ConcurrencyTag tag = ConcurrencyTag()) const
   /*{\Mop returns the symmectric difference |\Mvar - T| $\cup$
           |T - \Mvar|. }*/ {
     CGAL_NEF_TRACEN(" symmetric difference between nef3 "<<&*this<<" and "<<&N1);
@@ -1470,7 +1478,7 @@ protected:
     //CGAL::binop_intersection_tests_allpairs<SNC_decorator, XOR> tests_impl;
     Nef_polyhedron_3<Kernel,Items, Mark> res(Private_tag{});
     Binary_operation bo(res.snc());
-    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _xor);
+    bo(res.pl(), snc(), pl(), N1.snc(), N1.pl(), _xor, tag);
     return res;
   }
 
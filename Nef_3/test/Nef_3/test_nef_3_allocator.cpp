@@ -0,0 +1,55 @@
+#include <memory>
+#define CGAL_NEF3_ALLOCATOR(T) std::allocator<T>
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/Nef_polyhedron_3.h>
+#include <CGAL/boost/graph/generators.h>
+
+#include <cassert>
+#include <iostream>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef K::Point_3 Point_3;
+typedef CGAL::Surface_mesh<K::Point_3> Polygon_mesh;
+
+typedef CGAL::Nef_polyhedron_3<K> Nef_polyhedron;
+
+int main()
+{
+  Point_3 p0(0,0,0), p1(2,0,0), p2(2,2,0), p3(0,2,0), p4(0,2,2), p5(0,0,2), p6(2,0,2), p7(2,2,2);
+  Point_3 q0(1,1,1), q1(3,1,1), q2(3,3,1), q3(1,3,1), q4(1,3,3), q5(1,1,3), q6(3,1,3), q7(3,3,3);
+
+  Polygon_mesh A, B;
+  CGAL::make_hexahedron(p0, p1, p2, p3, p4, p5, p6, p7, A);
+  CGAL::make_hexahedron(q0, q1, q2, q3, q4, q5, q6, q7, B);
+
+  Nef_polyhedron a(A), b(B);
+  assert(a.is_valid() && b.is_valid());
+
+  Nef_polyhedron u = a + b;
+  Nef_polyhedron i = a * b;
+  Nef_polyhedron d = a - b;
+  assert(u.is_simple() && i.is_simple() && d.is_simple());
+
+  // two overlapping cubes: the intersection is a unit cube and the union
+  // and the difference have the combinatorics of the "L" shaped solids
+  assert(i.number_of_vertices() == 8);
+  assert(i.number_of_facets() == 6);
+  assert(u.number_of_vertices() == 20);
+  assert(d.number_of_vertices() == 14);
+
+  assert((u - i) == (a ^ b));
+  assert((d + i) == a);
+
+  // a copy shares the representation of the original through Handle_for,
+  // clearing it gives it a new representation and leaves the original intact
+  Nef_polyhedron c(u);
+  assert(c.identical(u));
+  c.clear();
+  assert(!c.identical(u));
+  assert(c.is_empty() && u.number_of_vertices() == 20);
+
+  std::cout << "done" << std::endl;
+  return 0;
+}
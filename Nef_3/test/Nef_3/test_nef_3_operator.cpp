@@ -31,5 +31,21 @@ int main(int /* argc */, char** /* argv[] */)
     assert(a1_bis==a1);
     assert(a2_bis==a2);
 
+    // the binary operations give the same results with and without concurrency
+    Polygon_mesh A3;
+    Point_3 r0(1.5,1.5,0.5), r1(2.5,1.5,0.5), r2(2.5,2.5,0.5), r3(1.5,2.5,0.5),
+            r4(1.5,2.5,1.5), r5(1.5,1.5,1.5), r6(2.5,1.5,1.5), r7(2.5,2.5,1.5);
+    make_hexahedron(r0, r1, r2, r3, r4, r5, r6, r7, A3);
+    Nef_polyhedron a3(A3);
+
+    assert(a1.join(a3, CGAL::Sequential_tag()) == (a1 + a3));
+    assert(a1.intersection(a3, CGAL::Sequential_tag()) == (a1 * a3));
+#ifdef CGAL_LINKED_WITH_TBB
+    assert(a1.join(a3, CGAL::Parallel_tag()) == (a1 + a3));
+    assert(a1.intersection(a3, CGAL::Parallel_tag()) == (a1 * a3));
+    assert(a1.difference(a3, CGAL::Parallel_tag()) == (a1 - a3));
+    assert(a1.symmetric_difference(a3, CGAL::Parallel_tag()) == (a1 ^ a3));
+#endif
+
     return 0;
 }
@@ -0,0 +1,732 @@
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_POISSON_OCTREE_RECONSTRUCTION_FUNCTION_H
+#define CGAL_POISSON_OCTREE_RECONSTRUCTION_FUNCTION_H
+
+#include <CGAL/license/Poisson_surface_reconstruction_3.h>
+
+#include <CGAL/IO/trace.h>
+#include <CGAL/Orthtree.h>
+#include <CGAL/Orthtree_traits_point.h>
+#include <CGAL/assertions.h>
+#include <CGAL/for_each.h>
+#include <CGAL/iterator.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+#include <CGAL/Timer.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <iterator>
+#include <limits>
+#include <memory>
+#include <optional>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+/*!
+  \file Poisson_octree_reconstruction_function.h
+*/
+
+namespace CGAL {
+
+namespace internal {
+namespace Poisson {
+
+// Traits of the octree of the input samples: the root node is a cube
+// enlarged around the bounding box of the samples, so that the
+// implicit function has room to become positive outside the surface.
+template <typename Gt, typename PointRange, typename PointMap>
+struct Octree_traits
+  : public Orthtree_traits_point<Gt, PointRange, PointMap, true, 3>
+{
+  using Base = Orthtree_traits_point<Gt, PointRange, PointMap, true, 3>;
+  using Self = Octree_traits<Gt, PointRange, PointMap>;
+  using Tree = Orthtree<Self>;
+  using FT = typename Base::FT;
+  using Point_d = typename Base::Point_d;
+  using Bbox_d = typename Base::Bbox_d;
+  using Node_index = typename Base::Node_index;
+
+  Octree_traits(PointRange& points, PointMap point_map, FT enlarge_ratio)
+    : Base(points, point_map), m_enlarge_ratio(enlarge_ratio)
+  { }
+
+  auto construct_root_node_bbox_object() const {
+    return [&]() -> Bbox_d {
+      const Bbox_d bbox = Base::construct_root_node_bbox_object()();
+      FT half_side = m_enlarge_ratio * (bbox.xmax() - bbox.xmin()) / FT(2);
+      if(half_side == FT(0)) // a single sample
+        half_side = FT(1);
+      const FT cx = (bbox.xmin() + bbox.xmax()) / FT(2);
+      const FT cy = (bbox.ymin() + bbox.ymax()) / FT(2);
+      const FT cz = (bbox.zmin() + bbox.zmax()) / FT(2);
+      return Bbox_d(Point_d(cx - half_side, cy - half_side, cz - half_side),
+                    Point_d(cx + half_side, cy + half_side, cz + half_side));
+    };
+  }
+
+  auto distribute_node_contents_object() const {
+    return [&](Node_index n, Tree& tree, const Point_d& center) {
+      CGAL_precondition(!tree.is_leaf(n));
+      reassign_points(tree, this->m_point_map, n, center, tree.data(n));
+    };
+  }
+
+  FT m_enlarge_ratio;
+};
+
+} // namespace Poisson
+} // namespace internal
+
+/*!
+\ingroup PkgPoissonSurfaceReconstruction3Ref
+
+\brief Implementation of the Poisson Surface Reconstruction method on
+an adaptive octree.
+
+Like `Poisson_reconstruction_function`, this class solves for an
+approximate indicator function of the solid bounded by a set of 3D
+points with oriented normals, whose gradient best matches the input
+normals \cgalCite{Kazhdan06}. Instead of refining a 3D Delaunay
+triangulation, the unknowns are stored on the leaves of an adaptive
+octree (`CGAL::Orthtree`) built on the input points: the octree is
+refined down to a maximum depth where the points are, and balanced so
+that adjacent leaves differ by at most one level. The memory footprint
+and the running time are therefore roughly proportional to the number
+of leaves, which is much smaller than the number of vertices of the
+refined Delaunay triangulation for large inputs.
+
+The function is discretized with one value per leaf (finite volumes
+on the octree), and the value at a point samples the values of the
+leaves around it with a trilinear interpolation. The linear system
+is screened \cgalCite{Kazhdan13}: the function is additionally pulled
+towards zero at the input points, which prevents the surface from
+drifting away from the samples where the normals are noisy. It is
+solved by a conjugate gradient preconditioned by the diagonal, level
+by level from a coarse level of the octree to the finest one, the
+solution of a level being the initial guess of the next one.
+
+The surface is the zero level set of the function, with negative
+values inside: the screening term pulls the function towards this
+value at the input points. Without screening, the function is only
+defined up to a constant, and it is shifted so that its mean value at
+the input points is zero.
+
+\tparam Gt Geometric traits class.
+\tparam ConcurrencyTag enables sequential versus parallel assembly
+and products of the matrix of the linear system and evaluation of
+ranges of query points with `evaluate()`. Possible values are `Sequential_tag`,
+`Parallel_tag`, and `Parallel_if_available_tag`. The result does not
+depend on this parameter.
+
+\cgalModels{ImplicitFunction}
+
+\sa `Poisson_reconstruction_function`
+*/
+template <class Gt, class ConcurrencyTag = Parallel_if_available_tag>
+class Poisson_octree_reconstruction_function
+{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+// Public types
+public:
+
+  /// \name Types
+  /// @{
+
+  typedef Gt Geom_traits; ///< Geometric traits class
+
+  // Geometric types
+  typedef typename Geom_traits::FT FT; ///< number type.
+  typedef typename Geom_traits::Point_3 Point; ///< point type.
+  typedef typename Geom_traits::Vector_3 Vector; ///< vector type.
+  typedef typename Geom_traits::Sphere_3 Sphere;
+
+  /// @}
+
+// Private types
+private:
+
+  typedef std::pair<Point, Vector> Point_with_normal;
+  typedef std::vector<Point_with_normal> Point_range;
+  typedef First_of_pair_property_map<Point_with_normal> Point_map;
+  typedef internal::Poisson::Octree_traits<Gt, Point_range, Point_map> Octree_traits;
+  typedef Orthtree<Octree_traits> Octree;
+  typedef typename Octree::Node_index Node_index;
+  typedef typename Octree::Local_coordinates Local_coordinates;
+  typedef typename Octree::template Property_map<double> Value_map;
+  typedef typename Octree::template Property_map<std::size_t> Row_map;
+
+  // Symmetric matrix of a level, stored by rows
+  struct Sparse_matrix
+  {
+    std::vector<std::size_t> offsets;
+    std::vector<std::size_t> columns;
+    std::vector<double> values;
+    std::vector<double> diagonal;
+  };
+
+  // Data shared by the copies of the function (the surface mesher
+  // copies the implicit function)
+  struct Data
+  {
+    Point_range points;
+    Octree octree;
+    Value_map values;
+    Row_map rows;
+    double area_per_point;
+    FT contouring_value;
+    Node_index sink;
+
+    Data(Point_range&& pwn, FT enlarge_ratio)
+      : points(std::move(pwn))
+      , octree(Octree_traits(points, Point_map(), enlarge_ratio))
+      , values(octree.add_property("values", 0.).first)
+      , rows(octree.add_property("rows", std::size_t(0)).first)
+      , area_per_point(0.)
+      , contouring_value(0)
+      , sink(octree.root())
+    { }
+  };
+
+// Data members
+private:
+
+  std::shared_ptr<Data> m_data;
+
+// Public methods
+public:
+
+  /// \name Creation
+  /// @{
+
+  /*!
+    creates a Poisson implicit function from the range of points `[first, beyond)`.
+    The points and their normals are copied: the input range is not
+    modified.
+
+    \tparam InputIterator iterator over input points.
+    \tparam PointPMap is a model of `ReadablePropertyMap` with value type `Point`.
+    \tparam NormalPMap is a model of `ReadablePropertyMap` with value type `Vector`.
+  */
+  template <typename InputIterator,
+            typename PointPMap,
+            typename NormalPMap
+  >
+  Poisson_octree_reconstruction_function(
+    InputIterator first,  ///< iterator over the first input point.
+    InputIterator beyond, ///< past-the-end iterator over the input points.
+    PointPMap point_pmap, ///< property map: `value_type of InputIterator` -> `Point` (the position of an input point).
+    NormalPMap normal_pmap ///< property map: `value_type of InputIterator` -> `Vector` (the *oriented* normal of an input point).
+  )
+  {
+    Point_range pwn;
+    pwn.reserve(static_cast<std::size_t>(std::distance(first, beyond)));
+    for(InputIterator it = first; it != beyond; ++it)
+      pwn.emplace_back(get(point_pmap, *it), get(normal_pmap, *it));
+    CGAL_precondition(!pwn.empty());
+
+    m_data = std::make_shared<Data>(std::move(pwn), FT(1.25));
+  }
+
+  /// @}
+
+  /// \name Operations
+  /// @{
+
+  /// Returns a sphere bounding the inferred surface.
+  Sphere bounding_sphere() const
+  {
+    const typename Octree::Bbox bbox = m_data->octree.bbox(m_data->octree.root());
+    const Point center = CGAL::midpoint((bbox.min)(), (bbox.max)());
+    return Sphere(center, CGAL::squared_distance(center, (bbox.max)()));
+  }
+
+  /*!
+    builds the octree and computes the implicit function.
+
+    \param depth maximum depth of the octree. The side of the smallest
+    leaves is the side of the root node (the bounding box of the input
+    points enlarged by a factor 1.25) divided by \f$ 2^{depth} \f$.
+    \param screening_weight weight of the interpolation of the input
+    points. `0` solves the classical Poisson equation.
+    \param tolerance relative residual at which the conjugate gradient
+    of each level stops.
+    \param max_iterations maximum number of iterations of the
+    conjugate gradient of each level.
+
+    \return `false` if the solver fails.
+  */
+  bool compute_implicit_function(unsigned int depth = 8,
+                                 double screening_weight = 4.,
+                                 double tolerance = 1e-7,
+                                 unsigned int max_iterations = 1000)
+  {
+    CGAL_precondition(depth > 0 && depth < 20);
+    CGAL_precondition(screening_weight >= 0.);
+
+    Data& data = *m_data;
+    Octree& octree = data.octree;
+
+    CGAL::Timer task_timer; task_timer.start();
+    CGAL_TRACE_STREAM << "Builds octree...\n";
+
+    octree.refine(depth, 1);
+    octree.grade();
+
+    // The surface area is estimated from the number of the finest
+    // leaves containing samples, the side of the root being 1
+    const double finest_side = std::ldexp(1., -int(octree.depth()));
+    std::size_t nb_surface_leaves = 0;
+    for(Node_index n : octree.traverse(Orthtrees::Leaves_traversal<Octree>(octree)))
+      if(octree.depth(n) == octree.depth() && !octree.data(n).empty())
+        ++nb_surface_leaves;
+    data.area_per_point = double(nb_surface_leaves) * finest_side * finest_side
+                          / double(data.points.size());
+
+    CGAL_TRACE_STREAM << "Builds octree: " << task_timer.time() << " seconds, depth "
+                      << octree.depth() << "\n";
+    task_timer.reset();
+
+    // Solves level by level, from coarse to fine
+    const std::size_t coarsest = (std::min)(std::size_t(3), octree.depth());
+    for(std::size_t level = coarsest; level <= octree.depth(); ++level)
+    {
+      std::vector<Node_index> nodes = active_nodes(level);
+      CGAL::for_each<ConcurrencyTag>
+        (CGAL::make_counting_range<std::size_t>(0, nodes.size()),
+         [&](const std::size_t i) -> bool
+         {
+           data.rows[nodes[i]] = i;
+           return true;
+         });
+
+      // Initial guess: the solution of the previous level
+      std::vector<double> x(nodes.size(), 0.);
+      if(level != coarsest)
+        for(std::size_t i = 0; i < nodes.size(); ++i)
+          x[i] = (octree.depth(nodes[i]) < level) ? data.values[nodes[i]]
+                                                  : data.values[octree.parent(nodes[i])];
+
+      Sparse_matrix A;
+      std::vector<double> b;
+      assemble(level, nodes, screening_weight, A, b);
+
+      const std::size_t iterations = solve(A, b, x, tolerance, max_iterations);
+      for(std::size_t i = 0; i < nodes.size(); ++i)
+        data.values[nodes[i]] = x[i];
+
+      CGAL_TRACE_STREAM << "  level " << level << ": " << nodes.size() << " unknowns, "
+                        << iterations << " iterations\n";
+      if(iterations == (std::numeric_limits<std::size_t>::max)())
+        return false;
+    }
+
+    CGAL_TRACE_STREAM << "Solves Poisson equation: " << task_timer.time() << " seconds\n";
+
+    // The screening pulls the function towards 0 at the samples, so the
+    // surface is the zero level set. Without screening, the function is
+    // only defined up to a constant, and the surface is the level set of
+    // the mean value at the samples.
+    data.contouring_value = FT(0);
+    if(screening_weight == 0.)
+    {
+      std::vector<double> values(data.points.size());
+      CGAL::for_each<ConcurrencyTag>
+        (CGAL::make_counting_range<std::size_t>(0, values.size()),
+         [&](const std::size_t i) -> bool
+         {
+           values[i] = raw_value(data.points[i].first);
+           return true;
+         });
+      double sum = 0.;
+      for(const double v : values)
+        sum += v;
+      data.contouring_value = FT(sum / double(values.size()));
+    }
+
+    data.sink = octree.root();
+    double min_value = (std::numeric_limits<double>::max)();
+    for(Node_index n : octree.traverse(Orthtrees::Leaves_traversal<Octree>(octree)))
+      if(data.values[n] < min_value)
+      {
+        min_value = data.values[n];
+        data.sink = n;
+      }
+
+    return true;
+  }
+
+  /*!
+    `ImplicitFunction` interface: evaluates the implicit function at a
+    given 3D query point. The function `compute_implicit_function()` must be
+    called before the first call to `operator()`.
+  */
+  FT operator()(const Point& p) const
+  {
+    return FT(raw_value(p)) - m_data->contouring_value;
+  }
+
+  /*!
+    evaluates the implicit function at each point of `points` and
+    writes the values in `values`, in the same order. If
+    `ConcurrencyTag` is `Parallel_tag`, the points are evaluated
+    concurrently.
+
+    \tparam PointRange a model of `ConstRange` with random access
+    iterators and value type `Point`.
+    \tparam OutputIterator an output iterator accepting values of type `FT`.
+  */
+  template <typename PointRange, typename OutputIterator>
+  OutputIterator evaluate(const PointRange& points, OutputIterator values) const
+  {
+    const std::size_t size = static_cast<std::size_t>(std::distance(points.begin(), points.end()));
+    std::vector<FT> results(size);
+
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, size),
+       [&](const std::size_t i) -> bool
+       {
+         results[i] = (*this)(*(points.begin() + i));
+         return true;
+       });
+
+    return std::copy(results.begin(), results.end(), values);
+  }
+
+  /// Returns a point located inside the inferred surface.
+  Point get_inner_point() const
+  {
+    return m_data->octree.barycenter(m_data->sink);
+  }
+
+  /// @}
+
+// Private methods:
+private:
+
+  // A node is an unknown of a level if it is a leaf not deeper than
+  // the level, or a node of the level
+  bool is_active(Node_index n, std::size_t level) const
+  {
+    const Octree& octree = m_data->octree;
+    return octree.depth(n) <= level && (octree.is_leaf(n) || octree.depth(n) == level);
+  }
+
+  std::vector<Node_index> active_nodes(std::size_t level) const
+  {
+    const Octree& octree = m_data->octree;
+    std::vector<Node_index> nodes;
+    for(Node_index n : octree.traverse(Orthtrees::Preorder_traversal<Octree>(octree)))
+      if(is_active(n, level))
+        nodes.push_back(n);
+    return nodes;
+  }
+
+  // Side of a node, the side of the root being 1
+  static double side(const Octree& octree, Node_index n)
+  {
+    return std::ldexp(1., -int(octree.depth(n)));
+  }
+
+  // Vector field of a node: the normals of its samples weighted by
+  // their area, divided by its volume
+  std::array<double, 3> vector_field(Node_index n) const
+  {
+    const Data& data = *m_data;
+    std::array<double, 3> v = { 0., 0., 0. };
+    for(const Point_with_normal& pwn : data.octree.data(n))
+      for(int i = 0; i < 3; ++i)
+        v[i] += CGAL::to_double(pwn.second[i]);
+
+    const double h = side(data.octree, n);
+    for(int i = 0; i < 3; ++i)
+      v[i] *= data.area_per_point / (h * h * h);
+    return v;
+  }
+
+  // Calls `f(j, coefficient, flux)` for each face between the active
+  // node of row `i` and an active node of row `j`, where `flux` is the
+  // flux of the vector field through the face, out of the node of row
+  // `i`. The coefficient of a face is its area, that of the smaller
+  // node, divided by the distance between the centers of the nodes.
+  template <typename Function>
+  void for_each_face(std::size_t level,
+                     const std::vector<Node_index>& nodes,
+                     const std::vector<std::array<double, 3> >& fields,
+                     std::size_t i,
+                     const Function& f) const
+  {
+    const Data& data = *m_data;
+    const Octree& octree = data.octree;
+    const Node_index n = nodes[i];
+    const double h = side(octree, n);
+
+    auto face = [&](std::size_t j, double area, double hm, int axis, int sign)
+    {
+      const double coefficient = area / ((h + hm) / 2.);
+      const double flux = (sign ? 1. : -1.) * area * (fields[i][axis] + fields[j][axis]) / 2.;
+      f(j, coefficient, flux);
+    };
+
+    for(int axis = 0; axis < 3; ++axis)
+      for(int sign = 0; sign < 2; ++sign)
+      {
+        const std::optional<Node_index> m
+          = octree.adjacent_node(n, Local_coordinates(2 * axis + sign));
+        if(!m)
+          continue;
+
+        // The adjacent node is not smaller than this one
+        if(is_active(*m, level))
+        {
+          face(data.rows[*m], h * h, side(octree, *m), axis, sign);
+          continue;
+        }
+
+        // The adjacent node is subdivided: as the octree is balanced,
+        // its children along the face are active leaves
+        for(std::size_t k = 0; k < 8; ++k)
+        {
+          if(bool((k >> axis) & 1) == bool(sign))
+            continue;
+          const Node_index c = octree.child(*m, k);
+          CGAL_assertion(is_active(c, level));
+          const double hc = side(octree, c);
+          face(data.rows[c], hc * hc, hc, axis, sign);
+        }
+      }
+  }
+
+  // Assembles the finite volume discretization of the screened
+  // Poisson equation on the active nodes of a level, with Neumann
+  // boundary conditions on the root node. Each row is assembled
+  // independently: a first pass counts the faces of each node, and a
+  // second one fills the rows.
+  void assemble(std::size_t level,
+                const std::vector<Node_index>& nodes,
+                double screening_weight,
+                Sparse_matrix& A,
+                std::vector<double>& b) const
+  {
+    const Data& data = *m_data;
+    const Octree& octree = data.octree;
+    const std::size_t size = nodes.size();
+
+    std::vector<std::array<double, 3> > fields(size);
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, size),
+       [&](const std::size_t i) -> bool
+       {
+         fields[i] = vector_field(nodes[i]);
+         return true;
+       });
+
+    A.diagonal.assign(size, 0.);
+    A.offsets.assign(size + 1, 0);
+    b.assign(size, 0.);
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, size),
+       [&](const std::size_t i) -> bool
+       {
+         double diagonal = screening_weight * data.area_per_point
+                           * double(octree.data(nodes[i]).size());
+         double rhs = 0.;
+         std::size_t nb_faces = 0;
+         for_each_face(level, nodes, fields, i,
+                       [&](std::size_t, double coefficient, double flux)
+                       {
+                         diagonal += coefficient;
+                         rhs -= flux;
+                         ++nb_faces;
+                       });
+         A.diagonal[i] = diagonal;
+         A.offsets[i + 1] = nb_faces;
+         b[i] = rhs;
+         return true;
+       });
+
+    for(std::size_t i = 0; i < size; ++i)
+      A.offsets[i + 1] += A.offsets[i];
+
+    A.columns.resize(A.offsets.back());
+    A.values.resize(A.offsets.back());
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, size),
+       [&](const std::size_t i) -> bool
+       {
+         std::size_t k = A.offsets[i];
+         for_each_face(level, nodes, fields, i,
+                       [&](std::size_t j, double coefficient, double)
+                       {
+                         A.columns[k] = j;
+                         A.values[k++] = -coefficient;
+                       });
+         return true;
+       });
+  }
+
+  void multiply(const Sparse_matrix& A, const std::vector<double>& x, std::vector<double>& y) const
+  {
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, x.size()),
+       [&](const std::size_t i) -> bool
+       {
+         double sum = A.diagonal[i] * x[i];
+         for(std::size_t k = A.offsets[i]; k < A.offsets[i + 1]; ++k)
+           sum += A.values[k] * x[A.columns[k]];
+         y[i] = sum;
+         return true;
+       });
+  }
+
+  static double dot(const std::vector<double>& a, const std::vector<double>& b)
+  {
+    double sum = 0.;
+    for(std::size_t i = 0; i < a.size(); ++i)
+      sum += a[i] * b[i];
+    return sum;
+  }
+
+  // Conjugate gradient preconditioned by the diagonal. Returns the
+  // number of iterations, or the maximum value of `std::size_t` if the
+  // matrix is not positive definite.
+  std::size_t solve(const Sparse_matrix& A,
+                    const std::vector<double>& b,
+                    std::vector<double>& x,
+                    double tolerance,
+                    unsigned int max_iterations) const
+  {
+    const std::size_t size = x.size();
+    for(const double d : A.diagonal)
+      if(!(d > 0.))
+        return (std::numeric_limits<std::size_t>::max)();
+
+    const double b_norm = std::sqrt(dot(b, b));
+    if(b_norm == 0.)
+    {
+      std::fill(x.begin(), x.end(), 0.);
+      return 0;
+    }
+
+    std::vector<double> r(size), z(size), p(size), q(size);
+    multiply(A, x, q);
+    for(std::size_t i = 0; i < size; ++i)
+    {
+      r[i] = b[i] - q[i];
+      z[i] = r[i] / A.diagonal[i];
+    }
+    p = z;
+    double rz = dot(r, z);
+
+    std::size_t iteration = 0;
+    for(; iteration < max_iterations; ++iteration)
+    {
+      if(std::sqrt(dot(r, r)) <= tolerance * b_norm)
+        break;
+
+      multiply(A, p, q);
+      const double pq = dot(p, q);
+      if(!(pq > 0.))
+        return (std::numeric_limits<std::size_t>::max)();
+
+      const double alpha = rz / pq;
+      for(std::size_t i = 0; i < size; ++i)
+      {
+        x[i] += alpha * p[i];
+        r[i] -= alpha * q[i];
+        z[i] = r[i] / A.diagonal[i];
+      }
+
+      const double new_rz = dot(r, z);
+      const double beta = new_rz / rz;
+      rz = new_rz;
+      for(std::size_t i = 0; i < size; ++i)
+        p[i] = z[i] + beta * p[i];
+    }
+
+    return iteration;
+  }
+
+  // Value of the leaf containing p, or of the closest leaf if p is
+  // outside the root node
+  double leaf_value(double x, double y, double z) const
+  {
+    const Data& data = *m_data;
+    const typename Octree::Bbox bbox = data.octree.bbox(data.octree.root());
+    auto clamp = [](double v, const FT& vmin, const FT& vmax) -> FT
+    {
+      return (std::min)((std::max)(FT(v), vmin), vmax);
+    };
+    const Point q(clamp(x, bbox.xmin(), bbox.xmax()),
+                  clamp(y, bbox.ymin(), bbox.ymax()),
+                  clamp(z, bbox.zmin(), bbox.zmax()));
+    return data.values[data.octree.locate(q)];
+  }
+
+  // Trilinear interpolation of the values of the leaves at the corners
+  // of the cube of the side of the leaf containing p, centered at the
+  // center of this leaf and containing p
+  double raw_value(const Point& p) const
+  {
+    const Data& data = *m_data;
+    const typename Octree::Bbox root = data.octree.bbox(data.octree.root());
+    const double px = (std::min)((std::max)(CGAL::to_double(p.x()), CGAL::to_double(root.xmin())),
+                                 CGAL::to_double(root.xmax()));
+    const double py = (std::min)((std::max)(CGAL::to_double(p.y()), CGAL::to_double(root.ymin())),
+                                 CGAL::to_double(root.ymax()));
+    const double pz = (std::min)((std::max)(CGAL::to_double(p.z()), CGAL::to_double(root.zmin())),
+                                 CGAL::to_double(root.zmax()));
+
+    const Node_index leaf = data.octree.locate(Point(px, py, pz));
+    const Point c = data.octree.barycenter(leaf);
+    const typename Octree::Bbox bbox = data.octree.bbox(leaf);
+    const double h = CGAL::to_double(bbox.xmax() - bbox.xmin());
+
+    const std::array<double, 3> center = { CGAL::to_double(c.x()), CGAL::to_double(c.y()), CGAL::to_double(c.z()) };
+    const std::array<double, 3> position = { px, py, pz };
+    std::array<double, 3> step, t;
+    for(int i = 0; i < 3; ++i)
+    {
+      step[i] = (position[i] < center[i]) ? -h : h;
+      t[i] = (std::min)(std::abs(position[i] - center[i]) / h, 1.);
+    }
+
+    double value = 0.;
+    for(int corner = 0; corner < 8; ++corner)
+    {
+      double weight = 1.;
+      std::array<double, 3> q = center;
+      for(int i = 0; i < 3; ++i)
+      {
+        if(corner & (1 << i))
+        {
+          weight *= t[i];
+          q[i] += step[i];
+        }
+        else
+          weight *= 1. - t[i];
+      }
+      if(weight == 0.)
+        continue;
+      value += weight * (corner == 0 ? data.values[leaf] : leaf_value(q[0], q[1], q[2]));
+    }
+    return value;
+  }
+
+}; // end of Poisson_octree_reconstruction_function
+
+} // namespace CGAL
+
+#endif // CGAL_POISSON_OCTREE_RECONSTRUCTION_FUNCTION_H
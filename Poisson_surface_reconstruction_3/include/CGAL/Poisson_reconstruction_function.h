@@ -22,6 +22,7 @@
 #  endif
 #endif
 
+#include <string>
 #include <vector>
 #include <deque>
 #include <algorithm>
@@ -43,10 +44,19 @@
 #include <CGAL/Robust_weighted_circumcenter_filtered_traits_3.h>
 #include <CGAL/compute_average_spacing.h>
 #include <CGAL/Timer.h>
+#include <CGAL/for_each.h>
+#include <CGAL/iterator.h>
+#include <CGAL/tags.h>
 
 #include <memory>
+#include <utility>
 #include <boost/iterator/indirect_iterator.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/parallel_for.h>
+#include <tbb/blocked_range.h>
+#endif // CGAL_LINKED_WITH_TBB
+
 /*!
   \file Poisson_reconstruction_function.h
 */
@@ -144,13 +154,23 @@ algorithm which solves for a piecewise linear function on a 3D
 Delaunay triangulation instead of an adaptive octree.
 
 \tparam Gt Geometric traits class.
+\tparam ConcurrencyTag enables sequential versus parallel assembly of
+the linear system and evaluation of ranges of query points with
+`evaluate()`. Possible values are `Sequential_tag`, `Parallel_tag`,
+and `Parallel_if_available_tag`. The result does not depend on this
+parameter. The default is `Sequential_tag`.
 
 \cgalModels{ImplicitFunction}
 
 */
-template <class Gt>
+template <class Gt, class ConcurrencyTag = Sequential_tag>
 class Poisson_reconstruction_function
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
 // Public types
 public:
 
@@ -204,6 +224,17 @@ private:
   typedef typename Triangulation::All_cells_iterator       All_cells_iterator;
   typedef typename Triangulation::Locate_type Locate_type;
 
+  // Row of the linear system, computed before its insertion in the matrix
+  struct Poisson_row
+  {
+    std::vector<std::pair<unsigned int, double> > coefficients; // off-diagonal
+    double diagonal;
+    double rhs;
+    // invalid values met while computing the row, reported when the row
+    // is inserted in the matrix, since rows may be computed concurrently
+    std::string diagnostics;
+  };
+
   enum Cache_state { UNINITIALIZED, BUSY, INITIALIZED };
   // Thread-safe cache for barycentric coordinates of a cell
   class Cached_bary_coord
@@ -223,17 +254,14 @@ private:
     bool is_initialized()
     {
       Cache_state s = m_state;
-      if (s == UNINITIALIZED)
-      {
-        // If the following line successfully replaces UNINITIALIZED
-        // by BUSY, then the current thread in charge of initialization
-        if (m_state.compare_exchange_weak(s, BUSY))
-          return false;
-      }
+      // If the following line successfully replaces UNINITIALIZED
+      // by BUSY, then the current thread in charge of initialization
+      if (s == UNINITIALIZED && m_state.compare_exchange_strong(s, BUSY))
+        return false;
+
       // Otherwise, either the thread is BUSY by another thread, or
       // it's already INITIALIZED. Either way, we way until it's INITIALIZED
-      else
-        while (m_state != INITIALIZED) { }
+      while (m_state != INITIALIZED) { }
 
       // At this point, it's always INITIALIZED
       return true;
@@ -478,7 +506,7 @@ public:
       CGAL::Timer approximation_timer; approximation_timer.start();
 
       CGAL::Timer sizing_field_timer; sizing_field_timer.start();
-      Poisson_reconstruction_function<Geom_traits>
+      Poisson_reconstruction_function<Geom_traits, ConcurrencyTag>
         coarse_poisson_function(boost::make_indirect_iterator (some_points.begin()),
                                 boost::make_indirect_iterator (some_points.end()),
                                 Normal_of_point_with_normal_map<Geom_traits>() );
@@ -491,7 +519,7 @@ public:
 
       Special_wrapper_of_two_functions_keep_pointers<
         internal::Poisson::Constant_sizing_field<Triangulation>,
-        Poisson_reconstruction_function<Geom_traits> > sizing_field2(&min_sizing_field,
+        Poisson_reconstruction_function<Geom_traits, ConcurrencyTag> > sizing_field2(&min_sizing_field,
                                                                      &coarse_poisson_function);
 
       sizing_field_timer.stop();
@@ -614,8 +642,25 @@ public:
   FT operator()(const Point& p) const
   {
     Cell_handle hint = m_hint.get();
-    hint = m_tr->locate(p, hint);
+    const FT value = (*this)(p, hint);
     m_hint.set(hint);
+    return value;
+  }
+
+  /*!
+    evaluates the implicit function at a given 3D query point, starting
+    the point location from the cell `hint`, which is updated to the
+    cell containing `p`. The function `compute_implicit_function()` must
+    be called before the first call to this operator.
+
+    Unlike `operator()(const Point&)`, this operator does not share its
+    hint with other calls: each thread can use its own hint to benefit
+    from the spatial coherence of its own queries. A default-constructed
+    `Cell_handle` can be passed as initial hint.
+  */
+  FT operator()(const Point& p, Cell_handle& hint) const
+  {
+    hint = m_tr->locate(p, hint);
 
     if(m_tr->is_infinite(hint)) {
       int i = hint->index(m_tr->infinite_vertex());
@@ -630,6 +675,46 @@ public:
            d * hint->vertex(3)->f();
   }
 
+  /*!
+    evaluates the implicit function at each point of `points` and
+    writes the values in `values`, in the same order. If
+    `ConcurrencyTag` is `Parallel_tag`, the points are evaluated
+    concurrently. Spatially sorting the query points (for example, the
+    points of a grid in lexicographic order) speeds up the point
+    location.
+
+    \tparam PointRange a model of `ConstRange` with random access
+    iterators and value type `Point`.
+    \tparam OutputIterator an output iterator accepting values of type `FT`.
+  */
+  template <typename PointRange, typename OutputIterator>
+  OutputIterator evaluate(const PointRange& points, OutputIterator values) const
+  {
+    const std::size_t size = static_cast<std::size_t>(std::distance(points.begin(), points.end()));
+    std::vector<FT> results(size);
+
+#ifdef CGAL_LINKED_WITH_TBB
+    if(std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      tbb::parallel_for(tbb::blocked_range<std::size_t>(0, size),
+                        [&](const tbb::blocked_range<std::size_t>& r)
+                        {
+                          Cell_handle hint = m_hint.get();
+                          for(std::size_t i = r.begin(); i != r.end(); ++i)
+                            results[i] = (*this)(*(points.begin() + i), hint);
+                        });
+    }
+    else
+#endif // CGAL_LINKED_WITH_TBB
+    {
+      Cell_handle hint = m_hint.get();
+      for(std::size_t i = 0; i < size; ++i)
+        results[i] = (*this)(*(points.begin() + i), hint);
+    }
+
+    return std::copy(results.begin(), results.end(), values);
+  }
+
   /// \cond SKIP_IN_MANUAL
   void initialize_cell_indices()
   {
@@ -647,32 +732,45 @@ public:
     m_bary->resize(m_tr->number_of_cells());
   }
 
-  void initialize_cell_normals() const
+  // finite cells, in the order of their indices
+  std::vector<Cell_handle> finite_cells() const
   {
-    Normal.resize(m_tr->number_of_cells());
-    int i = 0;
-    int N = 0;
+    std::vector<Cell_handle> cells;
+    cells.reserve(m_tr->number_of_finite_cells());
     for(Finite_cells_iterator fcit = m_tr->finite_cells_begin();
         fcit != m_tr->finite_cells_end();
-        ++fcit){
-      Normal[i] = cell_normal(fcit);
-      if(Normal[i] == NULL_VECTOR){
-        N++;
-      }
-      ++i;
-    }
-    std::cerr << N << " out of " << i << " cells have NULL_VECTOR as normal" << std::endl;
+        ++fcit)
+      cells.push_back(fcit);
+    return cells;
+  }
+
+  void initialize_cell_normals() const
+  {
+    Normal.resize(m_tr->number_of_cells());
+    const std::vector<Cell_handle> cells = finite_cells();
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, cells.size()),
+       [&](const std::size_t i) -> bool
+       {
+         Normal[i] = cell_normal(cells[i]);
+         return true;
+       });
+
+    const std::size_t N = std::count(Normal.begin(), Normal.begin() + cells.size(), NULL_VECTOR);
+    std::cerr << N << " out of " << cells.size() << " cells have NULL_VECTOR as normal" << std::endl;
   }
 
   void initialize_duals() const
   {
     Dual.resize(m_tr->number_of_cells());
-    int i = 0;
-    for(Finite_cells_iterator fcit = m_tr->finite_cells_begin();
-        fcit != m_tr->finite_cells_end();
-        ++fcit){
-      Dual[i++] = m_tr->dual(fcit);
-    }
+    const std::vector<Cell_handle> cells = finite_cells();
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t>(0, cells.size()),
+       [&](const std::size_t i) -> bool
+       {
+         Dual[i] = m_tr->dual(cells[i]);
+         return true;
+       });
   }
 
   void clear_duals() const
@@ -794,19 +892,36 @@ private:
     initialize_cell_normals();
 #endif
     Finite_vertices_iterator v, e;
+    std::vector<Vertex_handle> variables;
+    variables.reserve(nb_variables);
     for(v = m_tr->finite_vertices_begin(),
         e = m_tr->finite_vertices_end();
         v != e;
         ++v)
     {
-      if(!m_tr->is_constrained(v)) {
-#ifdef CGAL_DIV_NON_NORMALIZED
-        B[v->index()] = div(v); // rhs -> divergent
-#else // not defined(CGAL_DIV_NORMALIZED)
-        B[v->index()] = div_normalized(v); // rhs -> divergent
-#endif // not defined(CGAL_DIV_NORMALIZED)
-        assemble_poisson_row<SparseLinearAlgebraTraits_d>(A,v,B,lambda);
-      }
+      if(!m_tr->is_constrained(v))
+        variables.push_back(v);
+    }
+
+    // Rows are computed concurrently by blocks (the triangulation is
+    // only read), and then inserted sequentially in the matrix
+    const std::size_t block_size = std::size_t(1) << 16;
+    std::vector<Poisson_row> rows;
+    for(std::size_t first = 0; first < variables.size(); first += block_size)
+    {
+      const std::size_t last = (std::min)(first + block_size, variables.size());
+      rows.resize(last - first);
+
+      CGAL::for_each<ConcurrencyTag>
+        (CGAL::make_counting_range<std::size_t>(first, last),
+         [&](const std::size_t i) -> bool
+         {
+           compute_poisson_row(variables[i], lambda, rows[i - first]);
+           return true;
+         });
+
+      for(std::size_t i = first; i < last; ++i)
+        assemble_poisson_row<SparseLinearAlgebraTraits_d>(A, variables[i], B, rows[i - first]);
     }
 
     clear_duals();
@@ -995,11 +1110,11 @@ private:
   // - nn and area should not be computed for the face and its opposite face
   //
   // divergent
-  FT div_normalized(Vertex_handle v)
+  FT div_normalized(Vertex_handle v) const
   {
     std::vector<Cell_handle> cells;
     cells.reserve(32);
-    m_tr->incident_cells(v,std::back_inserter(cells));
+    m_tr->incident_cells_threadsafe(v,std::back_inserter(cells));
 
     FT div = 0;
     typename std::vector<Cell_handle>::iterator it;
@@ -1041,11 +1156,11 @@ private:
     return div * FT(3.0);
   }
 
-  FT div(Vertex_handle v)
+  FT div(Vertex_handle v) const
   {
     std::vector<Cell_handle> cells;
     cells.reserve(32);
-    m_tr->incident_cells(v,std::back_inserter(cells));
+    m_tr->incident_cells_threadsafe(v,std::back_inserter(cells));
 
     FT div = 0.0;
     typename std::vector<Cell_handle>::iterator it;
@@ -1069,7 +1184,7 @@ private:
     return div;
   }
 
-  Vector get_cell_normal(Cell_handle cell)
+  Vector get_cell_normal(Cell_handle cell) const
   {
     return Normal[cell->info()];
   }
@@ -1091,7 +1206,7 @@ private:
   }
 
   // cotan formula as area(voronoi face) / len(primal edge)
-  FT cotan_geometric(Edge& edge)
+  FT cotan_geometric(const Edge& edge) const
   {
     Cell_handle cell = edge.first;
     Vertex_handle vi = cell->vertex(edge.second);
@@ -1107,7 +1222,7 @@ private:
 
   // spin around edge
   // return area(voronoi face)
-  FT area_voronoi_face(Edge& edge)
+  FT area_voronoi_face(const Edge& edge) const
   {
     // circulate around edge
     Cell_circulator circ = m_tr->incident_cells(edge);
@@ -1145,7 +1260,7 @@ private:
   }
 
   // approximate area when a cell is infinite
-  FT area_voronoi_face_boundary(Edge& edge)
+  FT area_voronoi_face_boundary(const Edge& edge) const
   {
     FT area = 0.0;
     Vertex_handle vi = edge.first->vertex(edge.second);
@@ -1198,18 +1313,24 @@ private:
     return area;
   }
 
-  /// Assemble vi's row of the linear system A*X=B
-  ///
-  /// @tparam SparseLinearAlgebraTraits_d Symmetric definite positive sparse linear solver.
-  template <class SparseLinearAlgebraTraits_d>
-  void assemble_poisson_row(typename SparseLinearAlgebraTraits_d::Matrix& A,
-                            Vertex_handle vi,
-                            typename SparseLinearAlgebraTraits_d::Vector& B,
-                            double lambda)
+  /// Computes vi's row of the linear system A*X=B.
+  /// Only reads the triangulation, thus can be called concurrently.
+  void compute_poisson_row(Vertex_handle vi,
+                           double lambda,
+                           Poisson_row& row) const
   {
+#ifdef CGAL_DIV_NON_NORMALIZED
+    row.rhs = div(vi); // rhs -> divergent
+#else // not defined(CGAL_DIV_NORMALIZED)
+    row.rhs = div_normalized(vi); // rhs -> divergent
+#endif // not defined(CGAL_DIV_NORMALIZED)
+
+    row.coefficients.clear();
+    row.diagnostics.clear();
+
     // for each vertex vj neighbor of vi
     std::vector<Edge> edges;
-    m_tr->incident_edges(vi,std::back_inserter(edges));
+    m_tr->incident_edges_threadsafe(vi,std::back_inserter(edges));
 
     double diagonal = 0.0;
 
@@ -1234,30 +1355,47 @@ private:
 
         if(m_tr->is_constrained(vj)){
           if(! is_valid(vj->f())){
-            std::cerr << "vj->f() = " << vj->f() << " is not valid" << std::endl;
+            row.diagnostics += "vj->f() = " + std::to_string(CGAL::to_double(vj->f())) + " is not valid\n";
           }
-          B[vi->index()] -= cij * vj->f(); // change rhs
-          if(! is_valid( B[vi->index()])){
-            std::cerr << " B[vi->index()] = " <<  B[vi->index()] << " is not valid" << std::endl;
+          row.rhs -= cij * vj->f(); // change rhs
+          if(! is_valid(row.rhs)){
+            row.diagnostics += " B[vi->index()] = " + std::to_string(row.rhs) + " is not valid\n";
           }
 
         } else {
           if(! is_valid(cij)){
-            std::cerr << "cij = " << cij << " is not valid" << std::endl;
+            row.diagnostics += "cij = " + std::to_string(cij) + " is not valid\n";
           }
-          A.set_coef(vi->index(),vj->index(), -cij, true /*new*/); // off-diagonal coefficient
+          row.coefficients.emplace_back(vj->index(), -cij); // off-diagonal coefficient
         }
 
         diagonal += cij;
       }
     // diagonal coefficient
     if (vi->type() == Triangulation::INPUT){
-      A.set_coef(vi->index(),vi->index(), diagonal + lambda, true /*new*/) ;
+      row.diagonal = diagonal + lambda;
     } else{
-      A.set_coef(vi->index(),vi->index(), diagonal, true /*new*/);
+      row.diagonal = diagonal;
     }
   }
 
+  /// Assemble vi's row of the linear system A*X=B
+  ///
+  /// @tparam SparseLinearAlgebraTraits_d Symmetric definite positive sparse linear solver.
+  template <class SparseLinearAlgebraTraits_d>
+  void assemble_poisson_row(typename SparseLinearAlgebraTraits_d::Matrix& A,
+                            Vertex_handle vi,
+                            typename SparseLinearAlgebraTraits_d::Vector& B,
+                            const Poisson_row& row) const
+  {
+    if(! row.diagnostics.empty())
+      std::cerr << row.diagnostics << std::flush;
+    B[vi->index()] = row.rhs;
+    for(const std::pair<unsigned int, double>& coefficient : row.coefficients)
+      A.set_coef(vi->index(), coefficient.first, coefficient.second, true /*new*/); // off-diagonal coefficient
+    A.set_coef(vi->index(), vi->index(), row.diagonal, true /*new*/); // diagonal coefficient
+  }
+
 
   /// Computes enlarged geometric bounding sphere of the embedded triangulation.
   Sphere enlarged_bounding_sphere(FT ratio) const
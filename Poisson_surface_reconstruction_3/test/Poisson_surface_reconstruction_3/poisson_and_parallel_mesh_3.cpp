@@ -25,7 +25,8 @@ typedef std::pair<Point_3, Vector_3> Pwn;
 typedef CGAL::First_of_pair_property_map<Pwn> Point_map;
 typedef CGAL::Second_of_pair_property_map<Pwn> Vector_map;
 
-typedef CGAL::Poisson_reconstruction_function<Kernel> Poisson;
+typedef CGAL::Poisson_reconstruction_function<Kernel, CGAL::Parallel_tag> Poisson;
+typedef CGAL::Poisson_reconstruction_function<Kernel, CGAL::Sequential_tag> Sequential_poisson;
 
 typedef CGAL::Labeled_mesh_domain_3<Kernel> Implicit_domain;
 typedef CGAL::Mesh_triangulation_3<Implicit_domain, CGAL::Default,
@@ -64,6 +65,36 @@ int main(int, char**)
                     (points.end(),
                      CGAL::Property_map_to_unary_function<Point_map>()));
 
+  // The parallel assembly gives the same function as the sequential one
+  Sequential_poisson sequential_poisson (points.begin(), points.end(), Point_map(), Vector_map());
+  if (!sequential_poisson.compute_implicit_function())
+  {
+    std::cerr << "Error: cannot compute implicit function" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<Point_3> queries;
+  const int n = 20;
+  for (int i = 0; i < n; ++ i)
+    for (int j = 0; j < n; ++ j)
+      for (int k = 0; k < n; ++ k)
+        queries.emplace_back (bbox.xmin() + (bbox.xmax() - bbox.xmin()) * i / (n - 1),
+                              bbox.ymin() + (bbox.ymax() - bbox.ymin()) * j / (n - 1),
+                              bbox.zmin() + (bbox.zmax() - bbox.zmin()) * k / (n - 1));
+
+  std::vector<FT> values, sequential_values;
+  poisson.evaluate (queries, std::back_inserter (values));
+  sequential_poisson.evaluate (queries, std::back_inserter (sequential_values));
+  assert (values.size() == queries.size());
+  assert (values == sequential_values);
+
+  Sequential_poisson::Cell_handle hint;
+  for (std::size_t i = 0; i < queries.size(); ++ i)
+  {
+    assert (poisson (queries[i]) == values[i]);
+    assert (sequential_poisson (queries[i], hint) == values[i]);
+  }
+
   Implicit_domain domain
     = Implicit_domain::create_implicit_mesh_domain
     (poisson, bbox);
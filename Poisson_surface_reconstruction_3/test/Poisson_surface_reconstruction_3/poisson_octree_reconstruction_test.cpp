@@ -0,0 +1,107 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Poisson_octree_reconstruction_function.h>
+#include <CGAL/poisson_surface_reconstruction.h>
+#include <CGAL/Surface_mesh.h>
+#include <CGAL/property_map.h>
+#include <CGAL/IO/read_xyz_points.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::FT FT;
+typedef Kernel::Point_3 Point_3;
+typedef Kernel::Vector_3 Vector_3;
+
+typedef std::pair<Point_3, Vector_3> Pwn;
+typedef CGAL::First_of_pair_property_map<Pwn> Point_map;
+typedef CGAL::Second_of_pair_property_map<Pwn> Vector_map;
+
+typedef CGAL::Poisson_octree_reconstruction_function<Kernel, CGAL::Sequential_tag> Sequential_poisson;
+typedef CGAL::Poisson_octree_reconstruction_function<Kernel, CGAL::Parallel_if_available_tag> Poisson;
+
+typedef CGAL::Surface_mesh<Point_3> Mesh;
+
+int main(int, char**)
+{
+  // Points sampled on the unit sphere, whose normals are their positions
+  std::vector<Point_3> samples;
+  std::ifstream stream("data/sphere_20k.xyz");
+  if (!stream || !CGAL::IO::read_XYZ(stream, std::back_inserter(samples)))
+  {
+    std::cerr << "Error: cannot read file" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<Pwn> points;
+  for (const Point_3& p : samples)
+    points.emplace_back(p, p - CGAL::ORIGIN);
+
+  Sequential_poisson sequential_poisson (points.begin(), points.end(), Point_map(), Vector_map());
+  if (!sequential_poisson.compute_implicit_function(6))
+  {
+    std::cerr << "Error: cannot compute implicit function" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // Negative inside, positive outside
+  assert (sequential_poisson(CGAL::ORIGIN) < 0);
+  assert (sequential_poisson(Point_3(1.5, 0., 0.)) > 0);
+  assert (sequential_poisson(Point_3(-1., -1., 1.)) > 0);
+  assert (sequential_poisson(sequential_poisson.get_inner_point()) < 0);
+
+  // The zero level set is close to the sphere
+  for (int i = 0; i < 100; ++ i)
+  {
+    const Vector_3 d = points[i * 200].second;
+    assert (sequential_poisson(CGAL::ORIGIN + 0.8 * d) < 0);
+    assert (sequential_poisson(CGAL::ORIGIN + 1.2 * d) > 0);
+  }
+
+  // The parallel solver gives the same function
+  Poisson poisson (points.begin(), points.end(), Point_map(), Vector_map());
+  if (!poisson.compute_implicit_function(6))
+  {
+    std::cerr << "Error: cannot compute implicit function" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::vector<Point_3> queries;
+  for (int i = 0; i < 10; ++ i)
+    for (int j = 0; j < 10; ++ j)
+      for (int k = 0; k < 10; ++ k)
+        queries.emplace_back(-1.2 + 0.24 * i, -1.2 + 0.24 * j, -1.2 + 0.24 * k);
+
+  std::vector<FT> sequential_values, values;
+  sequential_poisson.evaluate(queries, std::back_inserter(sequential_values));
+  poisson.evaluate(queries, std::back_inserter(values));
+  for (std::size_t i = 0; i < queries.size(); ++ i)
+  {
+    assert (std::abs(values[i] - sequential_values[i]) < 1e-8);
+    assert (values[i] == poisson(queries[i]));
+  }
+
+  // Reconstruction of a closed surface close to the sphere
+  Mesh mesh;
+  if (!CGAL::poisson_surface_reconstruction_octree
+      (points.begin(), points.end(), Point_map(), Vector_map(), mesh, 0.05))
+  {
+    std::cerr << "Error: cannot reconstruct the surface" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cerr << mesh.number_of_vertices() << " vertices, "
+            << mesh.number_of_faces() << " faces" << std::endl;
+  assert (mesh.number_of_faces() > 100);
+  assert (CGAL::is_closed(mesh));
+  for (Mesh::Vertex_index v : vertices(mesh))
+  {
+    const double r = std::sqrt(CGAL::to_double((mesh.point(v) - CGAL::ORIGIN).squared_length()));
+    assert (r > 0.9 && r < 1.1);
+  }
+
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,101 @@
+// Compares the union of N meshes computed with successive calls to
+// corefine_and_compute_union() to the one computed with union_of_triangle_meshes().
+//
+// usage: union_of_triangle_meshes [mesh.off] [N]
+
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/union_of_triangle_meshes.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/Polygon_mesh_processing/measure.h>
+#include <CGAL/Polygon_mesh_processing/transform.h>
+#include <CGAL/Aff_transformation_3.h>
+#include <CGAL/Real_timer.h>
+
+#include <cmath>
+#include <cstdlib>
+#include <iostream>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef CGAL::Surface_mesh<K::Point_3>                    Mesh;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  const std::size_t nb_meshes = (argc > 2) ? std::size_t(std::atoi(argv[2])) : 8;
+
+  Mesh mesh;
+  if(!PMP::IO::read_polygon_mesh(filename, mesh) || !CGAL::is_triangle_mesh(mesh))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  // overlapping copies of the input, rotated around the z-axis and slightly translated
+  CGAL::Bbox_3 bb = PMP::bbox(mesh);
+  const double step = 0.1 * (bb.xmax() - bb.xmin());
+  std::vector<Mesh> meshes(nb_meshes, mesh);
+  for(std::size_t i=1; i<nb_meshes; ++i)
+  {
+    const double angle = 0.3 * double(i);
+    const double c = std::cos(angle), s = std::sin(angle);
+    K::Aff_transformation_3 t(c, -s, 0, step * double(i),
+                              s,  c, 0, 0,
+                              0,  0, 1, 0);
+    PMP::transform(t, meshes[i]);
+  }
+
+  CGAL::Real_timer timer;
+
+  timer.start();
+  Mesh pairwise = meshes[0];
+  for(std::size_t i=1; i<nb_meshes; ++i)
+  {
+    Mesh tmp = meshes[i];
+    if(!PMP::corefine_and_compute_union(pairwise, tmp, pairwise))
+    {
+      std::cerr << "Pairwise union failed at step " << i << std::endl;
+      return EXIT_FAILURE;
+    }
+  }
+  timer.stop();
+  std::cout << "Pairwise unions: " << timer.time() << " sec. ("
+            << num_faces(pairwise) << " faces, volume "
+            << CGAL::to_double(PMP::volume(pairwise)) << ")" << std::endl;
+
+  timer.reset();
+  timer.start();
+  Mesh nary;
+  if(!PMP::union_of_triangle_meshes(meshes, nary))
+  {
+    std::cerr << "N-ary union failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+  timer.stop();
+  std::cout << "N-ary union: " << timer.time() << " sec. ("
+            << num_faces(nary) << " faces, volume "
+            << CGAL::to_double(PMP::volume(nary)) << ")" << std::endl;
+
+#ifdef CGAL_LINKED_WITH_TBB
+  timer.reset();
+  timer.start();
+  Mesh nary_parallel;
+  if(!PMP::union_of_triangle_meshes(meshes, nary_parallel, CGAL::parameters::concurrency_tag(CGAL::Parallel_tag())))
+  {
+    std::cerr << "Parallel n-ary union failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+  timer.stop();
+  std::cout << "N-ary union (parallel): " << timer.time() << " sec. ("
+            << num_faces(nary_parallel) << " faces)" << std::endl;
+#endif
+
+  return EXIT_SUCCESS;
+}
@@ -58,5 +58,15 @@ int main(int argc, char* argv[])
             << polylines.size() << " polylines" << std::endl;
   polylines.clear();
 
+  // Slice the mesh with many parallel planes at once
+  std::vector<K::Plane_3> planes;
+  for(int i=-5; i<=5; ++i)
+    planes.push_back(K::Plane_3(0, 0, 1, -0.1 * i));
+  std::vector<std::vector<Polyline_type> > layers;
+  slicer.slice(planes, std::back_inserter(layers));
+  for(std::size_t i=0; i<planes.size(); ++i)
+    std::cout << "At z = " << 0.1 * (int(i) - 5) << ", the slicer intersects "
+              << layers[i].size() << " polylines" << std::endl;
+
   return 0;
 }
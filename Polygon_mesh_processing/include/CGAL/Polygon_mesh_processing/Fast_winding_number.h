@@ -0,0 +1,441 @@
+// Copyright (c) 2024 GeometryFactory (France).
+// All rights reserved.
+//
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+//
+// Author(s)     : Sebastien Loriot
+
+#ifndef CGAL_POLYGON_MESH_PROCESSING_FAST_WINDING_NUMBER_H
+#define CGAL_POLYGON_MESH_PROCESSING_FAST_WINDING_NUMBER_H
+
+#include <CGAL/license/Polygon_mesh_processing/predicate.h>
+
+#include <CGAL/array.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/Default.h>
+#include <CGAL/enum.h>
+#include <CGAL/for_each.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/number_utils.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <vector>
+
+namespace CGAL {
+namespace Polygon_mesh_processing {
+
+/*!
+ * \ingroup PMP_predicates_grp
+ *
+ * @brief locates points with respect to a triangle mesh using its generalized winding number.
+ *
+ * The generalized winding number of a point `q` with respect to a triangle mesh is the sum,
+ * over all the faces of the mesh, of the signed solid angles of the faces seen from `q`, divided by `4 pi`.
+ * For a closed and consistently outward oriented triangle mesh, it is `1` inside the domain bounded
+ * by the mesh and `0` outside. Contrary to the parity of the number of intersections with a ray used
+ * by `CGAL::Side_of_triangle_mesh`, it degrades gracefully in the presence of holes,
+ * self-intersections, or non-manifold features, which makes it suited to the voxelization of imperfect inputs:
+ * a point is considered to be on the bounded side of the domain if its winding number is larger than `1/2`.
+ *
+ * The faces of the mesh are stored in a bounding volume hierarchy. A cluster of faces
+ * far enough from the query point is approximated by a dipole, located at the area-weighted
+ * barycenter of its faces and whose moment is the sum of their area vectors, while the exact solid
+ * angle of the faces of the close clusters is computed. A cluster is considered far enough when the distance
+ * from the query point to its barycenter is larger than `accuracy()` times its radius, so the cost of a query
+ * grows logarithmically with the number of faces instead of linearly.
+ *
+ * The computations are done with `double`, and the faces of the mesh are copied at construction,
+ * so the mesh does not need to outlive this object.
+ *
+ * @tparam TriangleMesh a model of `FaceListGraph`
+ * @tparam VertexPointMap a model of `ReadablePropertyMap` with `boost::graph_traits<TriangleMesh>::%vertex_descriptor`
+ *         as key type and `%Point_3` as value type. The default is the type of the internal property map
+ *         for `CGAL::vertex_point_t` of `TriangleMesh`.
+ *
+ * \sa `CGAL::Side_of_triangle_mesh`
+ */
+template <class TriangleMesh,
+          class VertexPointMap = Default>
+class Fast_winding_number
+{
+  typedef typename boost::property_map<TriangleMesh, vertex_point_t>::const_type  Default_vpm;
+  typedef typename Default::Get<VertexPointMap, Default_vpm>::type                VPM;
+
+  typedef std::array<double, 3>                                                    Vec;
+  typedef std::array<Vec, 3>                                                       Triangle;
+
+  // a node of the hierarchy, containing the triangles of indices in `[begin, end)`
+  struct Node
+  {
+    std::size_t begin, end;
+    std::size_t left_child; // the right child is `left_child + 1`, and `0` for a leaf
+    Vec center;             // area-weighted barycenter of the triangles
+    Vec area_vector;        // sum of the area vectors of the triangles
+    double area;
+    double radius;          // radius of a ball centered at `center` containing the triangles
+  };
+
+  static constexpr std::size_t max_leaf_size = 8;
+
+public:
+  /// point type
+  typedef typename boost::property_traits<VPM>::value_type                         Point;
+
+  /*!
+   * builds the hierarchy of the faces of `tmesh`.
+   *
+   * @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+   *
+   * @param tmesh the triangle mesh. Its faces are expected to be consistently oriented, outward for closed meshes.
+   * @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+   *
+   * \cgalNamedParamsBegin
+   *   \cgalParamNBegin{vertex_point_map}
+   *     \cgalParamDescription{a property map associating points to the vertices of `tmesh`}
+   *     \cgalParamType{`VertexPointMap`}
+   *     \cgalParamDefault{`boost::get(CGAL::vertex_point, tmesh)`}
+   *   \cgalParamNEnd
+   * \cgalNamedParamsEnd
+   *
+   * @pre `is_triangle_mesh(tmesh)`
+   */
+  template <class NamedParameters = parameters::Default_named_parameters>
+  Fast_winding_number(const TriangleMesh& tmesh,
+                      const NamedParameters& np = parameters::default_values())
+    : m_accuracy(2.)
+  {
+    CGAL_precondition(is_triangle_mesh(tmesh));
+
+    VPM vpm = parameters::choose_parameter(parameters::get_parameter(np, internal_np::vertex_point),
+                                           get_const_property_map(vertex_point, tmesh));
+
+    m_triangles.reserve(num_faces(tmesh));
+    for(auto f : faces(tmesh))
+    {
+      Triangle t;
+      int i = 0;
+      for(auto h : halfedges_around_face(halfedge(f, tmesh), tmesh))
+      {
+        const Point& p = get(vpm, target(h, tmesh));
+        t[i++] = CGAL::make_array(CGAL::to_double(p.x()), CGAL::to_double(p.y()), CGAL::to_double(p.z()));
+      }
+      m_triangles.push_back(t);
+    }
+
+    if(!m_triangles.empty())
+      build();
+  }
+
+  /// \name Accuracy
+  /// @{
+
+  /*!
+   * returns the ratio between the distance from a query point to a cluster of faces and the radius
+   * of the cluster above which the cluster is approximated. The default is `2`.
+   */
+  double accuracy() const { return m_accuracy; }
+
+  /*!
+   * sets the ratio between the distance from a query point to a cluster of faces and the radius
+   * of the cluster above which the cluster is approximated. Larger values give more accurate
+   * but slower queries.
+   *
+   * @pre `accuracy > 1`
+   */
+  void set_accuracy(double accuracy)
+  {
+    CGAL_precondition(accuracy > 1.);
+    m_accuracy = accuracy;
+  }
+
+  /// @}
+
+  /// \name Queries
+  /// @{
+
+  /*!
+   * returns the approximated generalized winding number of `q`.
+   */
+  double winding_number(const Point& q) const
+  {
+    if(m_nodes.empty())
+      return 0.;
+
+    const Vec qv = CGAL::make_array(CGAL::to_double(q.x()), CGAL::to_double(q.y()), CGAL::to_double(q.z()));
+    const double sq_accuracy = m_accuracy * m_accuracy;
+
+    double solid_angle = 0.;
+    std::vector<std::size_t> stack(1, 0);
+    while(!stack.empty())
+    {
+      const Node& node = m_nodes[stack.back()];
+      stack.pop_back();
+
+      const Vec d = difference(node.center, qv);
+      const double sq_dist = dot(d, d);
+      if(sq_dist > sq_accuracy * node.radius * node.radius)
+      {
+        // far cluster: dipole approximation
+        solid_angle += dot(d, node.area_vector) / (sq_dist * std::sqrt(sq_dist));
+      }
+      else if(node.left_child == 0)
+      {
+        for(std::size_t i=node.begin; i<node.end; ++i)
+          solid_angle += triangle_solid_angle(m_triangles[i], qv);
+      }
+      else
+      {
+        stack.push_back(node.left_child);
+        stack.push_back(node.left_child + 1);
+      }
+    }
+
+    return solid_angle / (4. * CGAL_PI);
+  }
+
+  /*!
+   * returns `CGAL::ON_BOUNDED_SIDE` if the winding number of `q` is larger than `1/2`,
+   * and `CGAL::ON_UNBOUNDED_SIDE` otherwise. `CGAL::ON_BOUNDARY` is never returned.
+   */
+  Bounded_side operator()(const Point& q) const
+  {
+    return winding_number(q) > 0.5 ? ON_BOUNDED_SIDE : ON_UNBOUNDED_SIDE;
+  }
+
+  /*!
+   * computes the winding number of each point of `points`, and puts it in `out`.
+   *
+   * @tparam ConcurrencyTag enables sequential versus parallel computation.
+   *         Possible values are `Sequential_tag` (the default), `Parallel_if_available_tag`, and `Parallel_tag`.
+   * @tparam PointRange a model of `ConstRange` with `Point` as value type
+   * @tparam OutputIterator a model of `OutputIterator` accepting values of type `double`
+   *
+   * @param points the query points
+   * @param out the output iterator, in which the winding numbers are put, following the order of `points`
+   *
+   * @return the output iterator
+   */
+  template <class ConcurrencyTag = Sequential_tag, class PointRange, class OutputIterator>
+  OutputIterator winding_numbers(const PointRange& points, OutputIterator out) const
+  {
+    const std::vector<double> values = compute_winding_numbers<ConcurrencyTag>(points);
+    return std::copy(values.begin(), values.end(), out);
+  }
+
+  /*!
+   * computes the location of each point of `points`, as given by `operator()`, and puts it in `out`.
+   *
+   * @tparam ConcurrencyTag enables sequential versus parallel computation.
+   *         Possible values are `Sequential_tag` (the default), `Parallel_if_available_tag`, and `Parallel_tag`.
+   * @tparam PointRange a model of `ConstRange` with `Point` as value type
+   * @tparam OutputIterator a model of `OutputIterator` accepting values of type `CGAL::Bounded_side`
+   *
+   * @param points the query points
+   * @param out the output iterator, in which the locations of the points are put, following the order of `points`
+   *
+   * @return the output iterator
+   */
+  template <class ConcurrencyTag = Sequential_tag, class PointRange, class OutputIterator>
+  OutputIterator classify(const PointRange& points, OutputIterator out) const
+  {
+    for(double w : compute_winding_numbers<ConcurrencyTag>(points))
+      *out++ = (w > 0.5 ? ON_BOUNDED_SIDE : ON_UNBOUNDED_SIDE);
+    return out;
+  }
+
+  /// @}
+
+private:
+  static Vec difference(const Vec& a, const Vec& b)
+  {
+    return CGAL::make_array(a[0] - b[0], a[1] - b[1], a[2] - b[2]);
+  }
+
+  static double dot(const Vec& a, const Vec& b)
+  {
+    return a[0] * b[0] + a[1] * b[1] + a[2] * b[2];
+  }
+
+  static Vec cross(const Vec& a, const Vec& b)
+  {
+    return CGAL::make_array(a[1] * b[2] - a[2] * b[1],
+                            a[2] * b[0] - a[0] * b[2],
+                            a[0] * b[1] - a[1] * b[0]);
+  }
+
+  static double norm(const Vec& a)
+  {
+    return std::sqrt(dot(a, a));
+  }
+
+  // signed solid angle of `t` seen from `q` (Van Oosterom and Strackee formula)
+  static double triangle_solid_angle(const Triangle& t, const Vec& q)
+  {
+    const Vec a = difference(t[0], q), b = difference(t[1], q), c = difference(t[2], q);
+    const double la = norm(a), lb = norm(b), lc = norm(c);
+    const double numerator = dot(a, cross(b, c));
+    const double denominator = la * lb * lc + dot(a, b) * lc + dot(b, c) * la + dot(c, a) * lb;
+    return 2. * std::atan2(numerator, denominator);
+  }
+
+  template <class ConcurrencyTag, class PointRange>
+  std::vector<double> compute_winding_numbers(const PointRange& points) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    const std::vector<Point> query_points(std::begin(points), std::end(points));
+    std::vector<double> values(query_points.size());
+    CGAL::for_each<ConcurrencyTag>(
+      CGAL::make_counting_range<std::size_t>(0, query_points.size()),
+      [&](const std::size_t i) -> bool
+      {
+        values[i] = winding_number(query_points[i]);
+        return true;
+      });
+    return values;
+  }
+
+  void build()
+  {
+    const std::size_t nb_triangles = m_triangles.size();
+
+    std::vector<Vec> centroids(nb_triangles);
+    for(std::size_t i=0; i<nb_triangles; ++i)
+      for(int k=0; k<3; ++k)
+        centroids[i][k] = (m_triangles[i][0][k] + m_triangles[i][1][k] + m_triangles[i][2][k]) / 3.;
+
+    std::vector<std::size_t> order(nb_triangles);
+    for(std::size_t i=0; i<nb_triangles; ++i)
+      order[i] = i;
+
+    m_nodes.reserve(2 * (nb_triangles / max_leaf_size + 1));
+    m_nodes.push_back(Node());
+    build_node(0, 0, nb_triangles, order, centroids);
+
+    // reorder the triangles so that the triangles of a node are contiguous
+    std::vector<Triangle> ordered_triangles(nb_triangles);
+    for(std::size_t i=0; i<nb_triangles; ++i)
+      ordered_triangles[i] = m_triangles[order[i]];
+    m_triangles.swap(ordered_triangles);
+
+    compute_node_data(0);
+  }
+
+  void build_node(std::size_t node_id,
+                  std::size_t begin, std::size_t end,
+                  std::vector<std::size_t>& order,
+                  const std::vector<Vec>& centroids)
+  {
+    m_nodes[node_id].begin = begin;
+    m_nodes[node_id].end = end;
+    m_nodes[node_id].left_child = 0;
+    if(end - begin <= max_leaf_size)
+      return;
+
+    // split along the largest extent of the bounding box of the centroids
+    Vec lo = centroids[order[begin]], hi = lo;
+    for(std::size_t i=begin+1; i<end; ++i)
+      for(int k=0; k<3; ++k)
+      {
+        lo[k] = (std::min)(lo[k], centroids[order[i]][k]);
+        hi[k] = (std::max)(hi[k], centroids[order[i]][k]);
+      }
+    int axis = 0;
+    for(int k=1; k<3; ++k)
+      if(hi[k] - lo[k] > hi[axis] - lo[axis])
+        axis = k;
+
+    const std::size_t middle = begin + (end - begin) / 2;
+    std::nth_element(order.begin() + begin, order.begin() + middle, order.begin() + end,
+                     [&](std::size_t i, std::size_t j)
+                     {
+                       return centroids[i][axis] < centroids[j][axis];
+                     });
+
+    const std::size_t left_child = m_nodes.size();
+    m_nodes[node_id].left_child = left_child;
+    m_nodes.push_back(Node());
+    m_nodes.push_back(Node());
+    build_node(left_child, begin, middle, order, centroids);
+    build_node(left_child + 1, middle, end, order, centroids);
+  }
+
+  void compute_node_data(std::size_t node_id)
+  {
+    Node& node = m_nodes[node_id];
+    node.area_vector = CGAL::make_array(0., 0., 0.);
+    node.area = 0.;
+    Vec weighted_center = CGAL::make_array(0., 0., 0.);
+
+    if(node.left_child == 0)
+    {
+      for(std::size_t i=node.begin; i<node.end; ++i)
+      {
+        const Triangle& t = m_triangles[i];
+        const Vec n = cross(difference(t[1], t[0]), difference(t[2], t[0]));
+        const double area = 0.5 * norm(n);
+        for(int k=0; k<3; ++k)
+        {
+          node.area_vector[k] += 0.5 * n[k];
+          weighted_center[k] += area * (t[0][k] + t[1][k] + t[2][k]) / 3.;
+        }
+        node.area += area;
+      }
+      if(node.area > 0)
+      {
+        for(int k=0; k<3; ++k)
+          node.center[k] = weighted_center[k] / node.area;
+      }
+      else
+      {
+        node.center = m_triangles[node.begin][0];
+      }
+
+      node.radius = 0.;
+      for(std::size_t i=node.begin; i<node.end; ++i)
+        for(const Vec& p : m_triangles[i])
+          node.radius = (std::max)(node.radius, norm(difference(p, node.center)));
+      return;
+    }
+
+    const std::size_t left_child = node.left_child;
+    compute_node_data(left_child);
+    compute_node_data(left_child + 1);
+
+    // `node` is not invalidated: no node is added
+    const Node& left = m_nodes[left_child];
+    const Node& right = m_nodes[left_child + 1];
+    node.area = left.area + right.area;
+    for(int k=0; k<3; ++k)
+    {
+      node.area_vector[k] = left.area_vector[k] + right.area_vector[k];
+      node.center[k] = (node.area > 0) ? (left.area * left.center[k] + right.area * right.center[k]) / node.area
+                                       : 0.5 * (left.center[k] + right.center[k]);
+    }
+    node.radius = (std::max)(norm(difference(left.center, node.center)) + left.radius,
+                             norm(difference(right.center, node.center)) + right.radius);
+  }
+
+  std::vector<Triangle> m_triangles;
+  std::vector<Node> m_nodes;
+  double m_accuracy;
+};
+
+} // namespace Polygon_mesh_processing
+} // namespace CGAL
+
+#endif // CGAL_POLYGON_MESH_PROCESSING_FAST_WINDING_NUMBER_H
@@ -0,0 +1,340 @@
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+
+#ifndef CGAL_POLYGON_MESH_PROCESSING_SELF_INTERSECTION_TRACKER_H
+#define CGAL_POLYGON_MESH_PROCESSING_SELF_INTERSECTION_TRACKER_H
+
+#include <CGAL/license/Polygon_mesh_processing/predicate.h>
+
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
+
+#include <CGAL/AABB_face_graph_triangle_primitive.h>
+#include <CGAL/AABB_traits_3.h>
+#include <CGAL/AABB_tree.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/box_intersection_d.h>
+#include <CGAL/Default.h>
+#include <CGAL/Named_function_parameters.h>
+
+#include <boost/iterator/function_output_iterator.hpp>
+
+#include <algorithm>
+#include <map>
+#include <set>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace Polygon_mesh_processing {
+
+/*!
+ * \ingroup PMP_intersection_grp
+ *
+ * @brief maintains the set of pairs of intersecting faces of a triangle mesh that is locally edited.
+ *
+ * The pairs of intersecting faces are computed once at construction, using `self_intersections()`.
+ * After an edit of the mesh, `update()` must be called with the faces whose geometry changed and
+ * with the new faces: only these faces are tested against the faces of the mesh whose bounding
+ * boxes intersect theirs, so that the cost of an update depends on the size of the edit rather than
+ * on the size of the mesh. This is typically useful in interactive applications where the validity
+ * of the mesh is checked after each local edit.
+ *
+ * The faces of the mesh are stored in an AABB tree. The bounding boxes of the faces modified since the
+ * tree was built are handled separately, and the tree is rebuilt when the number of modified faces
+ * becomes large.
+ *
+ * @tparam TriangleMesh a model of `FaceListGraph`
+ * @tparam VertexPointMap a model of `ReadablePropertyMap` with `boost::graph_traits<TriangleMesh>::%vertex_descriptor`
+ *         as key type and `%Point_3` as value type. The default is the type of the internal property map
+ *         for `CGAL::vertex_point_t` of `TriangleMesh`.
+ * @tparam GeomTraits a model of `AABBGeomTraits_3`. The default is a \cgal Kernel deduced from the point type,
+ *         using `CGAL::Kernel_traits`.
+ *
+ * \sa `CGAL::Polygon_mesh_processing::self_intersections()`
+ * \sa `CGAL::Polygon_mesh_processing::does_self_intersect()`
+ */
+template <class TriangleMesh,
+          class VertexPointMap = Default,
+          class GeomTraits = Default>
+class Self_intersection_tracker
+{
+  typedef typename boost::property_map<TriangleMesh, vertex_point_t>::const_type  Default_vpm;
+  typedef typename Default::Get<VertexPointMap, Default_vpm>::type                VPM;
+  typedef typename Default::Get<GeomTraits,
+    typename Kernel_traits<typename boost::property_traits<VPM>::value_type>::Kernel>::type GT;
+
+  typedef boost::graph_traits<TriangleMesh>                                        GT_graph;
+  typedef typename GT_graph::vertex_descriptor                                     vertex_descriptor;
+  typedef typename GT_graph::halfedge_descriptor                                   halfedge_descriptor;
+
+public:
+  /// face descriptor type
+  typedef typename GT_graph::face_descriptor                                       face_descriptor;
+
+private:
+  typedef AABB_face_graph_triangle_primitive<TriangleMesh, VPM>                    Primitive;
+  typedef AABB_traits_3<GT, Primitive>                                             Tree_traits;
+  typedef AABB_tree<Tree_traits>                                                   Tree;
+
+  typedef Box_intersection_d::ID_FROM_BOX_ADDRESS                                  Box_policy;
+  typedef Box_intersection_d::Box_with_info_d<double, 3, face_descriptor, Box_policy> Box;
+
+public:
+  /*!
+   * builds the tracker and computes the pairs of intersecting faces of `tmesh`.
+   *
+   * @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+   *
+   * @param tmesh the triangle mesh to be tracked. It must outlive the tracker.
+   * @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+   *
+   * \cgalNamedParamsBegin
+   *   \cgalParamNBegin{vertex_point_map}
+   *     \cgalParamDescription{a property map associating points to the vertices of `tmesh`}
+   *     \cgalParamType{`VertexPointMap`}
+   *     \cgalParamDefault{`boost::get(CGAL::vertex_point, tmesh)`}
+   *   \cgalParamNEnd
+   *
+   *   \cgalParamNBegin{geom_traits}
+   *     \cgalParamDescription{an instance of a geometric traits class}
+   *     \cgalParamType{`GeomTraits`}
+   *     \cgalParamDefault{`GeomTraits()`}
+   *   \cgalParamNEnd
+   * \cgalNamedParamsEnd
+   *
+   * @pre `is_triangle_mesh(tmesh)`
+   */
+  template <class NamedParameters = parameters::Default_named_parameters>
+  Self_intersection_tracker(const TriangleMesh& tmesh,
+                            const NamedParameters& np = parameters::default_values())
+    : m_tmesh(tmesh),
+      m_vpm(parameters::choose_parameter(parameters::get_parameter(np, internal_np::vertex_point),
+                                         get_const_property_map(vertex_point, tmesh))),
+      m_gt(parameters::choose_parameter<GT>(parameters::get_parameter(np, internal_np::geom_traits))),
+      m_nb_pairs(0)
+  {
+    CGAL_precondition(is_triangle_mesh(tmesh));
+    reset();
+  }
+
+  /// \name Updates
+  /// @{
+
+  /*!
+   * recomputes all the pairs of intersecting faces from scratch. It must be called if faces
+   * have been removed from the mesh.
+   */
+  void reset()
+  {
+    m_intersections.clear();
+    m_nb_pairs = 0;
+    rebuild_tree();
+
+    Polygon_mesh_processing::self_intersections(faces(m_tmesh), m_tmesh,
+      boost::make_function_output_iterator([this](const std::pair<face_descriptor, face_descriptor>& fp)
+                                           {
+                                             add_pair(fp.first, fp.second);
+                                           }),
+      parameters::vertex_point_map(m_vpm).geom_traits(m_gt));
+  }
+
+  /*!
+   * updates the pairs of intersecting faces after an edit of the mesh.
+   *
+   * @tparam FaceRange a model of `ConstRange` with value type `face_descriptor`
+   *
+   * @param modified_faces the faces of the mesh whose geometry changed since the last update, including
+   *        the faces that were added to the mesh. A face may appear several times.
+   *
+   * @pre no face of the mesh was removed since the last update.
+   */
+  template <class FaceRange>
+  void update(const FaceRange& modified_faces)
+  {
+    std::set<face_descriptor> modified(std::begin(modified_faces), std::end(modified_faces));
+    if(modified.empty())
+      return;
+
+    // forget the pairs involving modified faces
+    for(face_descriptor f : modified)
+    {
+      auto it = m_intersections.find(f);
+      if(it == m_intersections.end())
+        continue;
+      for(face_descriptor g : it->second)
+      {
+        --m_nb_pairs;
+        if(g == f)
+          continue;
+        std::vector<face_descriptor>& g_intersections = m_intersections[g];
+        g_intersections.erase(std::find(g_intersections.begin(), g_intersections.end(), f));
+        if(g_intersections.empty())
+          m_intersections.erase(g);
+      }
+      m_intersections.erase(it);
+    }
+
+    // the boxes stored in the tree for modified faces are outdated
+    m_stale_faces.insert(modified.begin(), modified.end());
+
+    typename GT::Construct_segment_3 construct_segment = m_gt.construct_segment_3_object();
+    typename GT::Construct_triangle_3 construct_triangle = m_gt.construct_triangle_3_object();
+    typename GT::Do_intersect_3 do_intersect = m_gt.do_intersect_3_object();
+
+    auto test_pair = [&](face_descriptor f, face_descriptor g)
+    {
+      if(internal::do_faces_intersect<GT>(f, g, m_tmesh, m_vpm,
+                                          construct_segment, construct_triangle, do_intersect))
+        add_pair(f, g);
+    };
+
+    // modified faces against the faces of the tree that have not been modified
+    std::vector<Box> modified_boxes;
+    modified_boxes.reserve(modified.size());
+    std::vector<face_descriptor> candidates;
+    for(face_descriptor f : modified)
+    {
+      if(is_degenerate(f))
+      {
+        add_pair(f, f);
+        continue;
+      }
+      modified_boxes.push_back(Box(face_bbox(f), f));
+
+      candidates.clear();
+      m_tree.all_intersected_primitives(modified_boxes.back().bbox(), std::back_inserter(candidates));
+      for(face_descriptor g : candidates)
+        if(g != f && m_stale_faces.count(g) == 0 && !is_degenerate(g))
+          test_pair(f, g);
+    }
+
+    // modified faces against the faces whose boxes in the tree are outdated
+    std::vector<Box> stale_boxes;
+    stale_boxes.reserve(m_stale_faces.size());
+    for(face_descriptor g : m_stale_faces)
+      if(!is_degenerate(g))
+        stale_boxes.push_back(Box(face_bbox(g), g));
+
+    CGAL::box_intersection_d(modified_boxes.begin(), modified_boxes.end(),
+                             stale_boxes.begin(), stale_boxes.end(),
+                             [&](const Box& b, const Box& c)
+                             {
+                               const face_descriptor f = b.info(), g = c.info();
+                               // pairs of modified faces are reported twice
+                               if(f == g || (modified.count(g) != 0 && g < f))
+                                 return;
+                               test_pair(f, g);
+                             });
+
+    // Only now that the pairs involving modified faces have been computed can the tree
+    // be rebuilt: modified faces must be treated as stale during the tests above,
+    // otherwise a pair of modified faces would be found both in the tree and in the boxes.
+    if(m_stale_faces.size() > (std::max)(std::size_t(1024), std::size_t(num_faces(m_tmesh) / 16)))
+      rebuild_tree();
+  }
+
+  /*!
+   * updates the pairs of intersecting faces after some vertices of the mesh have been moved.
+   * This is equivalent to calling `update()` with the faces incident to these vertices.
+   *
+   * @tparam VertexRange a model of `ConstRange` with value type `boost::graph_traits<TriangleMesh>::%vertex_descriptor`
+   *
+   * @param moved_vertices the vertices whose positions changed since the last update
+   */
+  template <class VertexRange>
+  void update_around_vertices(const VertexRange& moved_vertices)
+  {
+    std::vector<face_descriptor> modified_faces;
+    for(vertex_descriptor v : moved_vertices)
+      for(face_descriptor f : faces_around_target(halfedge(v, m_tmesh), m_tmesh))
+        if(f != GT_graph::null_face())
+          modified_faces.push_back(f);
+    update(modified_faces);
+  }
+
+  /// @}
+
+  /// \name Queries
+  /// @{
+
+  /// returns `true` if the mesh self-intersects, i.e. if at least one pair of faces intersect
+  /// or if a face is degenerate.
+  bool does_self_intersect() const
+  {
+    return m_nb_pairs != 0;
+  }
+
+  /// returns the number of pairs of intersecting faces, a degenerate face being reported
+  /// as a pair made of twice the same face.
+  std::size_t number_of_intersecting_pairs() const
+  {
+    return m_nb_pairs;
+  }
+
+  /// puts in `out` the pairs of intersecting faces, as `self_intersections()` does.
+  ///
+  /// @tparam FacePairOutputIterator a model of `OutputIterator` holding objects of type
+  ///         `std::pair<face_descriptor, face_descriptor>`
+  template <class FacePairOutputIterator>
+  FacePairOutputIterator self_intersections(FacePairOutputIterator out) const
+  {
+    for(const auto& f_and_intersections : m_intersections)
+      for(face_descriptor g : f_and_intersections.second)
+        if(!(g < f_and_intersections.first))
+          *out++ = std::make_pair(f_and_intersections.first, g);
+    return out;
+  }
+
+  /// @}
+
+private:
+  bool is_degenerate(face_descriptor f) const
+  {
+    const halfedge_descriptor h = halfedge(f, m_tmesh);
+    return collinear(get(m_vpm, source(h, m_tmesh)),
+                     get(m_vpm, target(h, m_tmesh)),
+                     get(m_vpm, target(next(h, m_tmesh), m_tmesh)));
+  }
+
+  Bbox_3 face_bbox(face_descriptor f) const
+  {
+    const halfedge_descriptor h = halfedge(f, m_tmesh);
+    return get(m_vpm, source(h, m_tmesh)).bbox() +
+           get(m_vpm, target(h, m_tmesh)).bbox() +
+           get(m_vpm, target(next(h, m_tmesh), m_tmesh)).bbox();
+  }
+
+  void add_pair(face_descriptor f, face_descriptor g)
+  {
+    ++m_nb_pairs;
+    m_intersections[f].push_back(g);
+    if(g != f)
+      m_intersections[g].push_back(f);
+  }
+
+  void rebuild_tree()
+  {
+    m_tree.clear();
+    m_tree.insert(faces(m_tmesh).first, faces(m_tmesh).second, m_tmesh, m_vpm);
+    m_tree.build();
+    m_stale_faces.clear();
+  }
+
+  const TriangleMesh& m_tmesh;
+  const VPM m_vpm;
+  const GT m_gt;
+  Tree m_tree;
+  // faces modified since the tree was built
+  std::set<face_descriptor> m_stale_faces;
+  // for each face, the faces it intersects
+  std::map<face_descriptor, std::vector<face_descriptor> > m_intersections;
+  std::size_t m_nb_pairs;
+};
+
+} } // end of namespace CGAL::Polygon_mesh_processing
+
+#endif // CGAL_POLYGON_MESH_PROCESSING_SELF_INTERSECTION_TRACKER_H
@@ -17,6 +17,8 @@
 
 #include <CGAL/disable_warnings.h>
 
+#include<atomic>
+#include<iterator>
 #include<set>
 #include<vector>
 
@@ -24,6 +26,7 @@
 #include <CGAL/boost/graph/helpers.h>
 #include <boost/graph/graph_traits.hpp>
 #include <boost/property_map/vector_property_map.hpp>
+#include <boost/property_map/property_map.hpp>
 
 #include <CGAL/assertions.h>
 #include <CGAL/boost/graph/iterator.h>
@@ -36,6 +39,9 @@
 #include <CGAL/Default.h>
 #include <CGAL/Dynamic_property_map.h>
 #include <CGAL/iterator.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 #include <CGAL/tuple.h>
 
 #include <CGAL/Named_function_parameters.h>
@@ -83,6 +89,168 @@ namespace internal {
       EdgeConstraintMap ecm;
     };
 
+// A union-find structure on the integers `[0, n)` supporting concurrent calls to `unite()`.
+// A set is always linked to the set of smaller root, so that the root of a set is its smallest element.
+class Concurrent_union_find
+{
+  std::vector<std::atomic<std::size_t> > m_parent;
+
+public:
+  Concurrent_union_find(std::size_t n)
+    : m_parent(n)
+  {
+    for(std::size_t i=0; i<n; ++i)
+      m_parent[i].store(i, std::memory_order_relaxed);
+  }
+
+  bool is_root(std::size_t i) const
+  {
+    return m_parent[i].load() == i;
+  }
+
+  std::size_t find(std::size_t i)
+  {
+    for(;;)
+    {
+      std::size_t p = m_parent[i].load();
+      if(p == i)
+        return i;
+      std::size_t gp = m_parent[p].load();
+      // path halving: parents are only ever replaced by one of their ancestors
+      if(p != gp)
+        m_parent[i].compare_exchange_weak(p, gp);
+      i = gp;
+    }
+  }
+
+  void unite(std::size_t i, std::size_t j)
+  {
+    for(;;)
+    {
+      i = find(i);
+      j = find(j);
+      if(i == j)
+        return;
+      if(i < j)
+        std::swap(i, j);
+      // link the larger root, unless another thread has linked it in the meantime
+      std::size_t expected = i;
+      if(m_parent[i].compare_exchange_strong(expected, j))
+        return;
+    }
+  }
+};
+
+template <typename PolygonMesh, typename FaceComponentMap,
+          typename EdgeConstraintMap, typename FaceIndexMap>
+typename boost::property_traits<FaceComponentMap>::value_type
+connected_components_impl(const PolygonMesh& pmesh,
+                          FaceComponentMap fcm,
+                          EdgeConstraintMap ecmap,
+                          FaceIndexMap fimap,
+                          const Sequential_tag&)
+{
+  typedef boost::graph_traits<PolygonMesh> GT;
+  typedef typename GT::halfedge_descriptor halfedge_descriptor;
+  typedef typename GT::face_descriptor face_descriptor;
+
+  typename boost::property_traits<FaceComponentMap>::value_type i=0;
+  std::vector<bool> handled(num_faces(pmesh), false);
+  for (face_descriptor f : faces(pmesh))
+  {
+    if (handled[get(fimap,f)]) continue;
+    std::vector<face_descriptor> queue;
+    queue.push_back(f);
+    while(!queue.empty())
+    {
+      face_descriptor fq = queue.back();
+      queue.pop_back();
+      typename boost::property_traits<FaceIndexMap>::value_type  fq_id = get(fimap,fq);
+      if ( handled[fq_id]) continue;
+      handled[fq_id]=true;
+      put(fcm, fq, i);
+      for (halfedge_descriptor h : halfedges_around_face(halfedge(fq, pmesh), pmesh))
+      {
+        if ( get(ecmap, edge(h, pmesh)) ) continue;
+        halfedge_descriptor opp = opposite(h, pmesh);
+        face_descriptor fqo = face(opp, pmesh);
+        if ( fqo != GT::null_face() )
+        {
+          if ( !handled[get(fimap,fqo)] )
+            queue.push_back(fqo);
+        }
+      }
+    }
+    ++i;
+  }
+  return i;
+}
+
+#ifdef CGAL_LINKED_WITH_TBB
+// Faces are identified by their position in `faces(pmesh)`, and the faces sharing a non-constrained edge
+// are united concurrently. As the root of a component is its first face in `faces(pmesh)`, numbering
+// the roots in this order gives the same component ids as the sequential version.
+template <typename PolygonMesh, typename FaceComponentMap,
+          typename EdgeConstraintMap, typename FaceIndexMap>
+typename boost::property_traits<FaceComponentMap>::value_type
+connected_components_impl(const PolygonMesh& pmesh,
+                          FaceComponentMap fcm,
+                          EdgeConstraintMap ecmap,
+                          FaceIndexMap fimap,
+                          const Parallel_tag&)
+{
+  typedef boost::graph_traits<PolygonMesh> GT;
+  typedef typename GT::halfedge_descriptor halfedge_descriptor;
+  typedef typename GT::face_descriptor face_descriptor;
+  typedef typename boost::property_traits<FaceComponentMap>::value_type Component_id;
+
+  const std::vector<face_descriptor> face_range(faces(pmesh).begin(), faces(pmesh).end());
+  const std::size_t nf = face_range.size();
+
+  std::vector<std::size_t> position(nf);
+  CGAL::for_each<Parallel_tag>(CGAL::make_counting_range<std::size_t>(0, nf),
+                               [&](const std::size_t i) -> bool
+                               {
+                                 position[get(fimap, face_range[i])] = i;
+                                 return true;
+                               });
+
+  Concurrent_union_find components(nf);
+  CGAL::for_each<Parallel_tag>(CGAL::make_counting_range<std::size_t>(0, nf),
+                               [&](const std::size_t i) -> bool
+                               {
+                                 for(halfedge_descriptor h : halfedges_around_face(halfedge(face_range[i], pmesh), pmesh))
+                                 {
+                                   if(get(ecmap, edge(h, pmesh)))
+                                     continue;
+                                   face_descriptor fo = face(opposite(h, pmesh), pmesh);
+                                   if(fo == GT::null_face())
+                                     continue;
+                                   // each pair of adjacent faces is handled once
+                                   const std::size_t j = position[get(fimap, fo)];
+                                   if(j < i)
+                                     components.unite(i, j);
+                                 }
+                                 return true;
+                               });
+
+  std::vector<Component_id> root_ids(nf);
+  Component_id nb_components = 0;
+  for(std::size_t i=0; i<nf; ++i)
+    if(components.is_root(i))
+      root_ids[i] = nb_components++;
+
+  CGAL::for_each<Parallel_tag>(CGAL::make_counting_range<std::size_t>(0, nf),
+                               [&](const std::size_t i) -> bool
+                               {
+                                 put(fcm, face_range[i], root_ids[components.find(i)]);
+                                 return true;
+                               });
+
+  return nb_components;
+}
+#endif
+
 } // namespace internal
 
 /*!
@@ -187,6 +355,15 @@ connected_component(typename boost::graph_traits<PolygonMesh>::face_descriptor s
  *                    as key type and `std::size_t` as value type}
  *     \cgalParamDefault{an automatically indexed internal map}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{With `CGAL::Parallel_tag`, the components are computed with a concurrent union-find
+ *                     structure, and `fcm` must support concurrent writes for different faces.
+ *                     The component ids are the same as in the sequential version.}
+ *   \cgalParamNEnd
  * \cgalNamedParamsEnd
  *
  * \returns the number of connected components.
@@ -205,10 +382,6 @@ connected_components(const PolygonMesh& pmesh,
   using parameters::choose_parameter;
   using parameters::get_parameter;
 
-  typedef boost::graph_traits<PolygonMesh> GT;
-  typedef typename GT::halfedge_descriptor halfedge_descriptor;
-  typedef typename GT::face_descriptor face_descriptor;
-
   typedef typename internal_np::Lookup_named_param_def <
     internal_np::edge_is_constrained_t,
     NamedParameters,
@@ -221,36 +394,18 @@ connected_components(const PolygonMesh& pmesh,
   typedef typename GetInitializedFaceIndexMap<PolygonMesh, NamedParameters>::const_type FaceIndexMap;
   FaceIndexMap fimap = get_initialized_face_index_map(pmesh, np);
 
-  typename boost::property_traits<FaceComponentMap>::value_type i=0;
-  std::vector<bool> handled(num_faces(pmesh), false);
-  for (face_descriptor f : faces(pmesh))
-  {
-    if (handled[get(fimap,f)]) continue;
-    std::vector<face_descriptor> queue;
-    queue.push_back(f);
-    while(!queue.empty())
-    {
-      face_descriptor fq = queue.back();
-      queue.pop_back();
-      typename boost::property_traits<FaceIndexMap>::value_type  fq_id = get(fimap,fq);
-      if ( handled[fq_id]) continue;
-      handled[fq_id]=true;
-      put(fcm, fq, i);
-      for (halfedge_descriptor h : halfedges_around_face(halfedge(fq, pmesh), pmesh))
-      {
-        if ( get(ecmap, edge(h, pmesh)) ) continue;
-        halfedge_descriptor opp = opposite(h, pmesh);
-        face_descriptor fqo = face(opp, pmesh);
-        if ( fqo != GT::null_face() )
-        {
-          if ( !handled[get(fimap,fqo)] )
-            queue.push_back(fqo);
-        }
-      }
-    }
-    ++i;
-  }
-  return i;
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParameters,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  return internal::connected_components_impl(pmesh, fcm, ecmap, fimap, Concurrency_tag());
 }
 
 
@@ -375,6 +530,13 @@ std::size_t number_of_connected_components(const PolygonMesh& pmesh,
  *     \cgalParamType{a model of `OutputIterator` with value type `face_descriptor`}
  *     \cgalParamDefault{unused}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{Only the computation of the connected components is done concurrently.}
+ *   \cgalParamNEnd
  * \cgalNamedParamsEnd
  *
  * \return the number of connected components removed (ignoring isolated vertices).
@@ -525,6 +687,13 @@ std::size_t keep_largest_connected_components(PolygonMesh& pmesh,
  *     \cgalParamType{a model of `OutputIterator` with value type `face_descriptor`}
  *     \cgalParamDefault{unused}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{Only the computation of the connected components is done concurrently.}
+ *   \cgalParamNEnd
  * \cgalNamedParamsEnd
  *
  * \return the number of connected components removed (ignoring isolated vertices).
@@ -1008,6 +1177,67 @@ void split_connected_components_impl(FIMap fim,
   using parameters::get_parameter;
   using parameters::is_default_parameter;
 
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParameters,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  if constexpr(std::is_convertible<Concurrency_tag, Parallel_tag>::value)
+  {
+    // The patch ids are stored in a vector so that they can safely be read concurrently,
+    // and the components are copied concurrently into meshes already inserted in `range`.
+    std::vector<faces_size_type> patch_ids(num_faces(tm));
+    auto vector_pidmap = boost::make_iterator_property_map(patch_ids.begin(), fim);
+
+    faces_size_type nb_patches = 0;
+    if constexpr(is_default_parameter<NamedParameters, internal_np::face_patch_t>::value)
+    {
+      nb_patches = CGAL::Polygon_mesh_processing::connected_components(
+            tm, vector_pidmap, CGAL::parameters::face_index_map(fim)
+            .edge_is_constrained_map(ecm)
+            .concurrency_tag(Concurrency_tag()));
+    }
+    else
+    {
+      Fpm pidmap = get_parameter(np, internal_np::face_patch);
+      for(const auto& f : faces(tm))
+      {
+        faces_size_type patch_id = static_cast<faces_size_type>(get(pidmap, f));
+        put(vector_pidmap, f, patch_id);
+        if(patch_id > nb_patches)
+          nb_patches = patch_id;
+      }
+      nb_patches+=1;
+    }
+
+    CGAL::internal::reserve(range, nb_patches);
+    std::vector<PolygonMesh*> new_graphs;
+    new_graphs.reserve(nb_patches);
+    for(faces_size_type i=0; i<nb_patches; ++i)
+      range.push_back(PolygonMesh());
+    for(auto it = std::prev(range.end(), nb_patches); it != range.end(); ++it)
+      new_graphs.push_back(&*it);
+
+    CGAL::for_each<Concurrency_tag>(
+      CGAL::make_counting_range<std::size_t>(0, nb_patches),
+      [&](const std::size_t i) -> bool
+      {
+        CGAL::Face_filtered_graph<PolygonMesh, FIMap, VIMap, HIMap>
+            filter_graph(tm, faces_size_type(i), vector_pidmap, CGAL::parameters::face_index_map(fim)
+                                                                              .halfedge_index_map(him)
+                                                                              .vertex_index_map(vim));
+        CGAL::copy_face_graph(filter_graph, *new_graphs[i]);
+        return true;
+      });
+    return;
+  }
+
   Fpm pidmap = choose_parameter(get_parameter(np, internal_np::face_patch),
                                 get(CGAL::dynamic_face_property_t<faces_size_type>(), tm));
 
@@ -1097,6 +1327,13 @@ void split_connected_components_impl(FIMap fim,
  *                       `edge_is_constrained_map`}
  *     \cgalParamExtra{The map is updated during the remeshing process while new faces are created.}
  *   \cgalParamNEnd
+ *
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *     \cgalParamExtra{With `CGAL::Parallel_tag`, the connected components are computed and copied concurrently.}
+ *   \cgalParamNEnd
  * \cgalNamedParamsEnd
  *
  */
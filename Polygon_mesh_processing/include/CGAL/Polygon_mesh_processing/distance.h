@@ -43,12 +43,16 @@
 #include <tbb/blocked_range.h>
 #endif // CGAL_LINKED_WITH_TBB
 
+#include <CGAL/for_each.h>
+
 #include <any>
 
 #include <unordered_set>
 #include <algorithm>
 #include <array>
+#include <atomic>
 #include <cmath>
+#include <functional>
 #include <limits>
 
 #ifdef CGAL_HAUSDORFF_DEBUG_PP
@@ -1424,7 +1428,8 @@ preprocess_bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm
   return std::make_pair(infinity_value, rebuild);
 }
 
-template <class Kernel,
+template <class Concurrency_tag,
+          class Kernel,
           class TriangleMesh1,
           class TriangleMesh2,
           class VPM1,
@@ -1443,6 +1448,7 @@ bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm1,
                                               const typename Kernel::FT sq_initial_bound,
                                               const typename Kernel::FT sq_distance_bound,
                                               const typename Kernel::FT infinity_value,
+                                              const std::function<bool(double, double)>& callback,
                                               OutputIterator& out)
 {
   using FT = typename Kernel::FT;
@@ -1530,92 +1536,33 @@ bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm1,
   std::size_t explored_candidates_count = 0;
 #endif
 
-  // See Section 5.1 in the paper.
-  while(!candidate_triangles.empty())
-  {
-#ifdef CGAL_HAUSDORFF_DEBUG_PP
-    std::cout << "===" << std::endl;
-    std::cout << candidate_triangles.size() << " candidates" << std::endl;
-    std::cout << "- infinity_value: " << infinity_value << std::endl;
-    std::cout << "- error_bound: " << error_bound << std::endl;
-    std::cout << "- sq_initial_bound: " << sq_initial_bound << std::endl;
-    std::cout << "- sq_distance_bound: " << sq_distance_bound << std::endl;
-    std::cout << "- global_bounds.lower: " << global_bounds.lower << std::endl;
-    std::cout << "- global_bounds.upper: " << global_bounds.upper << std::endl;
-    std::cout << "- diff = " << CGAL::approximate_sqrt(global_bounds.upper) -
-                                CGAL::approximate_sqrt(global_bounds.lower) << ", below bound? "
-              << ((CGAL::approximate_sqrt(global_bounds.upper) -
-                   CGAL::approximate_sqrt(global_bounds.lower)) <= error_bound) << std::endl;
-#endif
+  // Set if the subdivision stopped before the bounds are within the error bound
+  bool interrupted = false;
 
-    CGAL_assertion(global_bounds.lower >= FT(0));
-    CGAL_assertion(global_bounds.upper >= global_bounds.lower);
-
-    // @todo could cache those sqrts
-    if(CGAL::approximate_sqrt(global_bounds.upper) - CGAL::approximate_sqrt(global_bounds.lower) <= error_bound)
-      break;
+  // Candidates are refined by batches: a batch has a single candidate in the sequential version
+  // and the candidates of a batch are refined concurrently in the parallel version. The global
+  // lower bound used for culling during the TM2 traversals is shared between the concurrent
+  // tasks through an atomic double, which is a lower approximation of the actual bound
+  // (culling with a smaller bound is only more conservative).
+  const std::size_t batch_size = std::is_convertible<Concurrency_tag, Parallel_tag>::value ? 64 : 1;
 
-    // Check if we can early quit.
-    if(is_positive(sq_distance_bound)) // empty distance bound is FT(-1)
-    {
-      const bool early_quit = (sq_distance_bound <= global_bounds.lower);
-      if(early_quit)
-      {
-#ifdef CGAL_HAUSDORFF_DEBUG
-        std::cout << "Quitting early with lower bound: " << global_bounds.lower << std::endl;
-#endif
-        break;
-      }
-    }
+  using Candidate_bounds = Local_bounds<Kernel, Face_handle_1, Face_handle_2>;
+  struct Subdivision
+  {
+    bool projects_onto_single_face = false;
+    std::vector<Candidate> sub_candidates;
+  };
 
-    const Candidate triangle_and_bounds = candidate_triangles.top();
-    candidate_triangles.pop();
+  std::vector<Candidate> batch;
+  std::vector<Subdivision> subdivisions;
+  std::atomic<double> shared_lower(to_interval(global_bounds.lower).first);
 
-    // Only process the triangle if it can contribute to the Hausdorff distance,
-    // i.e., if its upper bound is higher than the currently known best lower bound
-    // and the difference between the bounds to be obtained is larger than the
-    // user-given error.
+  // Refines a candidate, either proving that its upper bound is realized or splitting it into four
+  // sub-triangles whose bounds are computed with a traversal of the TM2 tree.
+  auto subdivide = [&](const Candidate& triangle_and_bounds, Subdivision& subdivision)
+  {
     const auto& triangle_bounds = triangle_and_bounds.bounds;
 
-#ifdef CGAL_HAUSDORFF_DEBUG_PP
-    std::cout << "Candidate:" << std::endl;
-    std::cout << triangle_and_bounds.triangle.vertex(0) << std::endl;
-    std::cout << triangle_and_bounds.triangle.vertex(1) << std::endl;
-    std::cout << triangle_and_bounds.triangle.vertex(2) << std::endl;
-    std::cout << "triangle_bounds.lower: " << triangle_bounds.lower << std::endl;
-    std::cout << "triangle_bounds.upper: " << triangle_bounds.upper << std::endl;
-    std::cout << "- diff = " << CGAL::approximate_sqrt(triangle_bounds.upper) -
-                                CGAL::approximate_sqrt(triangle_bounds.lower) << ", below bound? "
-              << ((CGAL::approximate_sqrt(triangle_bounds.upper) -
-                   CGAL::approximate_sqrt(triangle_bounds.lower)) <= error_bound) << std::endl;
-#endif
-
-    CGAL_assertion(triangle_bounds.lower >= FT(0));
-    CGAL_assertion(triangle_bounds.upper >= triangle_bounds.lower);
-
-    // @todo implement the enclosing-based end criterion (Section 5.1, optional step for TM1 & TM2 closed)
-
-    // Might have been a good candidate when added to the queue, but rendered useless by later insertions
-    if(triangle_bounds.upper < global_bounds.lower)
-    {
-#ifdef CGAL_HAUSDORFF_DEBUG_PP
-      std::cout << "Upper bound is lower than global.lower" << std::endl;
-#endif
-      continue;
-    }
-
-    if((CGAL::approximate_sqrt(triangle_bounds.upper) - CGAL::approximate_sqrt(triangle_bounds.lower)) <= error_bound)
-    {
-#ifdef CGAL_HAUSDORFF_DEBUG_PP
-      std::cout << "Candidate triangle bounds are tight enough: " << triangle_bounds.lower << " " << triangle_bounds.upper << std::endl;
-#endif
-      continue;
-    }
-
-#ifdef CGAL_HAUSDORFF_DEBUG
-    ++explored_candidates_count;
-#endif
-
     // Triangle to be subdivided
     const Triangle_3& triangle_for_subdivision = triangle_and_bounds.triangle;
     const Point_3& v0 = triangle_for_subdivision.vertex(0);
@@ -1636,14 +1583,8 @@ bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm1,
 #ifdef CGAL_HAUSDORFF_DEBUG_PP
       std::cout << "Projects onto the same TM2 face" << std::endl;
 #endif
-
-      // The upper bound of this triangle is the actual Hausdorff distance of
-      // the triangle to the second mesh. Use it as new global lower bound.
-      // Here, we update the reference to the realizing triangle as this is the best current guess.
-      global_bounds.lower = triangle_bounds.upper;
-      global_bounds.lpair.second = triangle_bounds.tm2_uface;
-
-      continue;
+      subdivision.projects_onto_single_face = true;
+      return;
     }
 
     // Subdivide the triangle into four smaller triangles.
@@ -1653,6 +1594,9 @@ bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm1,
     const std::array<Triangle_3, 4> sub_triangles = { Triangle_3(v0, v01, v02), Triangle_3(v1 , v01, v12),
                                                       Triangle_3(v2, v02, v12), Triangle_3(v01, v02, v12) };
 
+    // Bounds seen by this task: the lower bound is refreshed from the shared one before each traversal.
+    Global_bounds<Kernel, Face_handle_1, Face_handle_2> task_bounds = global_bounds;
+
     // Send each of the four triangles to culling on B
     for(std::size_t i=0; i<4; ++i)
     {
@@ -1687,15 +1631,18 @@ bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm1,
       // Thus, when splitting t1 into four subtriangles, the distance at the three new vertices
       // is smaller than max_{v in t1} d(v, t2)
       // Thus, subdivision can only decrease the min, and the upper bound.
-      Local_bounds<Kernel, Face_handle_1, Face_handle_2> bounds(triangle_bounds.upper);
+      Candidate_bounds bounds(triangle_bounds.upper);
 
       // Ensure 'uface' is initialized in case the upper bound is not changed by the subdivision
       bounds.tm2_uface = triangle_bounds.tm2_uface;
 
-      TM2_hd_traits traversal_traits_tm2(sub_t1_bbox, tm2, vpm2, bounds, global_bounds, infinity_value);
+      const FT sq_shared_lower(shared_lower.load(std::memory_order_relaxed));
+      if(sq_shared_lower > task_bounds.lower)
+        task_bounds.lower = sq_shared_lower;
+
+      TM2_hd_traits traversal_traits_tm2(sub_t1_bbox, tm2, vpm2, bounds, task_bounds, infinity_value);
       tm2_tree.traversal_with_priority(sub_triangles[i], traversal_traits_tm2);
 
-      // Update global lower Hausdorff bound according to the obtained local bounds.
       const auto& sub_triangle_bounds = traversal_traits_tm2.get_local_bounds();
 
 #ifdef CGAL_HAUSDORFF_DEBUG_PP
@@ -1707,22 +1654,190 @@ bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm1,
       CGAL_assertion(sub_triangle_bounds.tm2_lface != boost::graph_traits<TriangleMesh2>::null_face());
       CGAL_assertion(sub_triangle_bounds.tm2_uface != boost::graph_traits<TriangleMesh2>::null_face());
 
-      // The global lower bound is the max of the per-face lower bounds
-      if(sub_triangle_bounds.lower > global_bounds.lower)
+      // Publish the new lower bound to the other tasks
+      if(sub_triangle_bounds.lower > task_bounds.lower)
       {
-        global_bounds.lower = sub_triangle_bounds.lower;
-        global_bounds.lpair.first = triangle_and_bounds.tm1_face;
-        global_bounds.lpair.second = sub_triangle_bounds.tm2_lface;
+        task_bounds.lower = sub_triangle_bounds.lower;
+
+        const double sq_lower_approx = to_interval(sub_triangle_bounds.lower).first;
+        double sq_current = shared_lower.load(std::memory_order_relaxed);
+        while(sq_current < sq_lower_approx &&
+              !shared_lower.compare_exchange_weak(sq_current, sq_lower_approx, std::memory_order_relaxed)) { }
       }
 
-      // The global upper bound is:
-      //   max_{query in TM1} min_{primitive in TM2} max_{v in query} (d(v, primitive))
-      // which can go down, so it is only recomputed once splitting is finished,
-      // using the top value of the PQ
+      subdivision.sub_candidates.emplace_back(sub_triangles[i], sub_triangle_bounds, triangle_and_bounds.tm1_face);
+    }
+  };
 
-      candidate_triangles.emplace(sub_triangles[i], sub_triangle_bounds, triangle_and_bounds.tm1_face);
+  // See Section 5.1 in the paper.
+  while(!candidate_triangles.empty())
+  {
+#ifdef CGAL_HAUSDORFF_DEBUG_PP
+    std::cout << "===" << std::endl;
+    std::cout << candidate_triangles.size() << " candidates" << std::endl;
+    std::cout << "- infinity_value: " << infinity_value << std::endl;
+    std::cout << "- error_bound: " << error_bound << std::endl;
+    std::cout << "- sq_initial_bound: " << sq_initial_bound << std::endl;
+    std::cout << "- sq_distance_bound: " << sq_distance_bound << std::endl;
+    std::cout << "- global_bounds.lower: " << global_bounds.lower << std::endl;
+    std::cout << "- global_bounds.upper: " << global_bounds.upper << std::endl;
+    std::cout << "- diff = " << CGAL::approximate_sqrt(global_bounds.upper) -
+                                CGAL::approximate_sqrt(global_bounds.lower) << ", below bound? "
+              << ((CGAL::approximate_sqrt(global_bounds.upper) -
+                   CGAL::approximate_sqrt(global_bounds.lower)) <= error_bound) << std::endl;
+#endif
+
+    CGAL_assertion(global_bounds.lower >= FT(0));
+    CGAL_assertion(global_bounds.upper >= global_bounds.lower);
+
+    if(callback && !callback(to_double(CGAL::approximate_sqrt(global_bounds.lower)),
+                             to_double(CGAL::approximate_sqrt(global_bounds.upper))))
+    {
+#ifdef CGAL_HAUSDORFF_DEBUG
+      std::cout << "Interrupted by the callback with bounds: " << global_bounds.lower << " " << global_bounds.upper << std::endl;
+#endif
+      interrupted = true;
+      break;
+    }
+
+    // @todo could cache those sqrts
+    if(CGAL::approximate_sqrt(global_bounds.upper) - CGAL::approximate_sqrt(global_bounds.lower) <= error_bound)
+      break;
+
+    // Check if we can early quit.
+    if(is_positive(sq_distance_bound)) // empty distance bound is FT(-1)
+    {
+      const bool early_quit = (sq_distance_bound <= global_bounds.lower);
+      if(early_quit)
+      {
+#ifdef CGAL_HAUSDORFF_DEBUG
+        std::cout << "Quitting early with lower bound: " << global_bounds.lower << std::endl;
+#endif
+        interrupted = true;
+        break;
+      }
+
+      // The distance is known to be smaller than the bound: no need to be more precise.
+      if(global_bounds.upper < sq_distance_bound)
+      {
+#ifdef CGAL_HAUSDORFF_DEBUG
+        std::cout << "Quitting early with upper bound: " << global_bounds.upper << std::endl;
+#endif
+        interrupted = true;
+        break;
+      }
+    }
+
+    batch.clear();
+    while(batch.size() < batch_size && !candidate_triangles.empty())
+    {
+      const Candidate triangle_and_bounds = candidate_triangles.top();
+      candidate_triangles.pop();
+
+      // Only process the triangle if it can contribute to the Hausdorff distance,
+      // i.e., if its upper bound is higher than the currently known best lower bound
+      // and the difference between the bounds to be obtained is larger than the
+      // user-given error.
+      const auto& triangle_bounds = triangle_and_bounds.bounds;
+
+#ifdef CGAL_HAUSDORFF_DEBUG_PP
+      std::cout << "Candidate:" << std::endl;
+      std::cout << triangle_and_bounds.triangle.vertex(0) << std::endl;
+      std::cout << triangle_and_bounds.triangle.vertex(1) << std::endl;
+      std::cout << triangle_and_bounds.triangle.vertex(2) << std::endl;
+      std::cout << "triangle_bounds.lower: " << triangle_bounds.lower << std::endl;
+      std::cout << "triangle_bounds.upper: " << triangle_bounds.upper << std::endl;
+      std::cout << "- diff = " << CGAL::approximate_sqrt(triangle_bounds.upper) -
+                                  CGAL::approximate_sqrt(triangle_bounds.lower) << ", below bound? "
+                << ((CGAL::approximate_sqrt(triangle_bounds.upper) -
+                     CGAL::approximate_sqrt(triangle_bounds.lower)) <= error_bound) << std::endl;
+#endif
+
+      CGAL_assertion(triangle_bounds.lower >= FT(0));
+      CGAL_assertion(triangle_bounds.upper >= triangle_bounds.lower);
+
+      // @todo implement the enclosing-based end criterion (Section 5.1, optional step for TM1 & TM2 closed)
+
+      // Might have been a good candidate when added to the queue, but rendered useless by later insertions
+      if(triangle_bounds.upper < global_bounds.lower)
+      {
+#ifdef CGAL_HAUSDORFF_DEBUG_PP
+        std::cout << "Upper bound is lower than global.lower" << std::endl;
+#endif
+        continue;
+      }
+
+      if((CGAL::approximate_sqrt(triangle_bounds.upper) - CGAL::approximate_sqrt(triangle_bounds.lower)) <= error_bound)
+      {
+#ifdef CGAL_HAUSDORFF_DEBUG_PP
+        std::cout << "Candidate triangle bounds are tight enough: " << triangle_bounds.lower << " " << triangle_bounds.upper << std::endl;
+#endif
+        continue;
+      }
+
+      batch.push_back(triangle_and_bounds);
+    }
+
+    if(batch.empty())
+      continue;
+
+#ifdef CGAL_HAUSDORFF_DEBUG
+    explored_candidates_count += batch.size();
+#endif
+
+    subdivisions.assign(batch.size(), Subdivision());
+    CGAL::for_each<Concurrency_tag>(CGAL::make_counting_range<std::size_t>(0, batch.size()),
+                                    [&](const std::size_t i) -> bool
+                                    {
+                                      subdivide(batch[i], subdivisions[i]);
+                                      return true;
+                                    });
+
+    bool has_subdivided = false;
+    for(std::size_t bi=0; bi<batch.size(); ++bi)
+    {
+      const Candidate& triangle_and_bounds = batch[bi];
+      const auto& triangle_bounds = triangle_and_bounds.bounds;
+
+      if(subdivisions[bi].projects_onto_single_face)
+      {
+        // The upper bound of this triangle is the actual Hausdorff distance of
+        // the triangle to the second mesh. Use it as new global lower bound.
+        // Here, we update the reference to the realizing triangle as this is the best current guess.
+        if(triangle_bounds.upper >= global_bounds.lower)
+        {
+          global_bounds.lower = triangle_bounds.upper;
+          global_bounds.lpair.second = triangle_bounds.tm2_uface;
+        }
+        continue;
+      }
+
+      has_subdivided = true;
+      for(const Candidate& sub_candidate : subdivisions[bi].sub_candidates)
+      {
+        // Update global lower Hausdorff bound according to the obtained local bounds.
+        const auto& sub_triangle_bounds = sub_candidate.bounds;
+
+        // The global lower bound is the max of the per-face lower bounds
+        if(sub_triangle_bounds.lower > global_bounds.lower)
+        {
+          global_bounds.lower = sub_triangle_bounds.lower;
+          global_bounds.lpair.first = triangle_and_bounds.tm1_face;
+          global_bounds.lpair.second = sub_triangle_bounds.tm2_lface;
+        }
+
+        // The global upper bound is:
+        //   max_{query in TM1} min_{primitive in TM2} max_{v in query} (d(v, primitive))
+        // which can go down, so it is only recomputed once splitting is finished,
+        // using the top value of the PQ
+
+        candidate_triangles.push(sub_candidate);
+      }
     }
 
+    if(!has_subdivided)
+      continue;
+
     // Update global upper Hausdorff bound after subdivision.
     const Candidate& top_candidate = candidate_triangles.top();
     const FT current_upmost = top_candidate.bounds.upper;
@@ -1774,7 +1889,8 @@ bounded_error_squared_Hausdorff_distance_impl(const TriangleMesh1& tm1,
 
   CGAL_assertion(global_bounds.lower >= FT(0));
   CGAL_assertion(global_bounds.upper >= global_bounds.lower);
-  CGAL_assertion(CGAL::approximate_sqrt(global_bounds.upper) - CGAL::approximate_sqrt(global_bounds.lower) <= error_bound);
+  CGAL_assertion(interrupted ||
+                 CGAL::approximate_sqrt(global_bounds.upper) - CGAL::approximate_sqrt(global_bounds.lower) <= error_bound);
 
   // Get realizing triangles.
   CGAL_assertion(global_bounds.lpair.first != boost::graph_traits<TriangleMesh1>::null_face());
@@ -1950,10 +2066,10 @@ struct Bounded_error_squared_distance_computation
 
       // TODO: add distance_bound (now it is FT(-1)) in case we use parallel
       // for checking if two meshes are close.
-      const FT sqd = bounded_error_squared_Hausdorff_distance_impl<Kernel>(
+      const FT sqd = bounded_error_squared_Hausdorff_distance_impl<Sequential_tag, Kernel>(
                        tm1, tm2, vpm1, vpm2, tm1_tree, tm2_tree,
                        error_bound, sq_initial_bound, FT(-1) /*sq_distance_bound*/, infinity_value,
-                       stub);
+                       std::function<bool(double, double)>(), stub);
       if(sqd > sq_dist)
         sq_dist = sqd;
     }
@@ -1996,13 +2112,19 @@ bounded_error_squared_one_sided_Hausdorff_distance_impl(const TriangleMesh1& tm1
                                                         const NamedParameters2& np2,
                                                         OutputIterator& out)
 {
-#if !defined(CGAL_LINKED_WITH_TBB) || !defined(CGAL_METIS_ENABLED)
+#ifndef CGAL_LINKED_WITH_TBB
   static_assert(!std::is_convertible<Concurrency_tag, CGAL::Parallel_tag>::value,
-                                      "Parallel_tag is enabled but at least TBB or METIS is unavailable.");
+                "Parallel_tag is enabled but TBB is unavailable.");
 #endif
 
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
   using FT = typename Kernel::FT;
 
+  const std::function<bool(double, double)>& callback =
+    choose_parameter(get_parameter(np1, internal_np::callback), std::function<bool(double, double)>());
+
   using TM1 = TriangleMesh1;
   using TM2 = TriangleMesh2;
 
@@ -2231,9 +2353,9 @@ bounded_error_squared_one_sided_Hausdorff_distance_impl(const TriangleMesh1& tm1
 #ifdef CGAL_HAUSDORFF_DEBUG
     std::cout << "* executing sequential version" << std::endl;
 #endif
-    sq_hdist = bounded_error_squared_Hausdorff_distance_impl<Kernel>(
+    sq_hdist = bounded_error_squared_Hausdorff_distance_impl<Concurrency_tag, Kernel>(
                  tm1, tm2, vpm1, vpm2, tm1_tree, tm2_tree,
-                 error_bound, sq_initial_bound, sq_distance_bound, infinity_value, out);
+                 error_bound, sq_initial_bound, sq_distance_bound, infinity_value, callback, out);
   }
 
 #ifdef CGAL_HAUSDORFF_DEBUG
@@ -2271,9 +2393,9 @@ bounded_error_squared_symmetric_Hausdorff_distance_impl(const TriangleMesh1& tm1
                                                         OutputIterator1& out1,
                                                         OutputIterator2& out2)
 {
-#if !defined(CGAL_LINKED_WITH_TBB) || !defined(CGAL_METIS_ENABLED)
+#ifndef CGAL_LINKED_WITH_TBB
   static_assert(!std::is_convertible<Concurrency_tag, CGAL::Parallel_tag>::value,
-                "Parallel_tag is enabled but at least TBB or METIS is unavailable.");
+                "Parallel_tag is enabled but TBB is unavailable.");
 #endif
 
   // Optimized version.
@@ -2297,6 +2419,12 @@ bounded_error_squared_symmetric_Hausdorff_distance_impl(const TriangleMesh1& tm1
   std::vector<Face_handle_1> tm1_only;
   std::vector<Face_handle_2> tm2_only;
 
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  const std::function<bool(double, double)>& callback =
+    choose_parameter(get_parameter(np1, internal_np::callback), std::function<bool(double, double)>());
+
   const FT sq_error_bound = square(FT(error_bound));
   FT infinity_value = FT(-1);
 
@@ -2332,9 +2460,9 @@ bounded_error_squared_symmetric_Hausdorff_distance_impl(const TriangleMesh1& tm1
 
   if(!compare_meshes || (compare_meshes && tm1_only.size() > 0))
   {
-    sq_dista = bounded_error_squared_Hausdorff_distance_impl<Kernel>(
+    sq_dista = bounded_error_squared_Hausdorff_distance_impl<Concurrency_tag, Kernel>(
                  tm1, tm2, vpm1, vpm2, tm1_tree, tm2_tree,
-                 error_bound, sq_initial_bound, sq_distance_bound, infinity_value, out1);
+                 error_bound, sq_initial_bound, sq_distance_bound, infinity_value, callback, out1);
   }
 
   // In case this is true, we need to rebuild trees in order to accelerate
@@ -2356,9 +2484,9 @@ bounded_error_squared_symmetric_Hausdorff_distance_impl(const TriangleMesh1& tm1
 
   if(!compare_meshes || (compare_meshes && tm2_only.size() > 0))
   {
-    sq_distb = bounded_error_squared_Hausdorff_distance_impl<Kernel>(
+    sq_distb = bounded_error_squared_Hausdorff_distance_impl<Concurrency_tag, Kernel>(
                  tm2, tm1, vpm2, vpm1, tm2_tree, tm1_tree,
-                 error_bound, sq_initial_bound, sq_distance_bound, infinity_value, out2);
+                 error_bound, sq_initial_bound, sq_distance_bound, infinity_value, callback, out2);
   }
 
   return (CGAL::max)(sq_dista, sq_distb);
@@ -2463,9 +2591,9 @@ bounded_error_squared_Hausdorff_distance_naive_impl(const TriangleMesh1& tm1,
  * is at most `error_bound` away from the actual Hausdorff distance from `tm1` to `tm2`.
  *
  * @tparam Concurrency_tag enables sequential versus parallel algorithm.
- *                         Possible values are `Sequential_tag` and `Parallel_tag`.
- *                         Currently, the parallel version is not implemented and the
- *                         sequential version is always used whatever tag is chosen!
+ *                         Possible values are `Sequential_tag`, `Parallel_if_available_tag`, and `Parallel_tag`.
+ *                         With parallelism enabled, the candidate triangles of `tm1` that might realize
+ *                         the distance are refined concurrently.
  *
  * @tparam TriangleMesh1 a model of the concept `FaceListGraph`
  * @tparam TriangleMesh2 a model of the concept `FaceListGraph`
@@ -2497,11 +2625,22 @@ bounded_error_squared_Hausdorff_distance_naive_impl(const TriangleMesh1& tm1,
  *     \cgalParamDefault{true}
  *     \cgalParamExtra{Both `np1` and `np2` must have this tag set to `true` in order to activate this preprocessing.}
  *   \cgalParamNEnd
+ *   \cgalParamNBegin{callback}
+ *     \cgalParamDescription{a mechanism to get feedback on the advancement of the algorithm
+ *                           while it's running and to interrupt it if needed}
+ *     \cgalParamType{an instance of `std::function<bool(double, double)>`.}
+ *     \cgalParamDefault{unused}
+ *     \cgalParamExtra{It is called regularly with the current lower and upper bounds on the distance.
+ *                     If it returns `false`, the algorithm is interrupted and the current lower bound is returned.
+ *                     This can be used to stop as soon as the distance is known to be below or above
+ *                     a given threshold.}
+ *     \cgalParamExtra{This parameter is only read from `np1`.}
+ *   \cgalParamNEnd
  * \cgalNamedParamsEnd
  *
  * @pre `tm1` and `tm2` are non-empty triangle meshes.
  *
- * @return the one-sided Hausdorff distance
+ * @return the one-sided Hausdorff distance, or its current lower bound if the computation is interrupted
  */
 template <class Concurrency_tag,
           class TriangleMesh1,
@@ -2552,6 +2691,8 @@ double bounded_error_Hausdorff_distance(const TriangleMesh1& tm1,
  *
  * This function optimizes all internal calls to shared data structures in order to
  * speed up the computation.
+ * If a `callback` is passed in `np1`, the bounds it receives are those of the one-sided distance
+ * being computed.
  *
  * See the function `CGAL::Polygon_mesh_processing::bounded_error_Hausdorff_distance()`
  * for a complete description of the parameters and requirements.
@@ -2607,8 +2748,8 @@ double bounded_error_symmetric_Hausdorff_distance(const TriangleMesh1& tm1,
  *
  * The distance used to compute the proximity of the meshes is the bounded-error Hausdorff distance.
  * Instead of computing the full distance and checking it against the user-provided
- * value, this function returns early if certain criteria show that the meshes
- * do not satisfy the provided `distance_bound`.
+ * value, this function returns as soon as the lower bound on the distance is larger than
+ * `distance_bound`, or the upper bound on the distance is smaller than `distance_bound`.
  *
  * See the function `CGAL::Polygon_mesh_processing::bounded_error_Hausdorff_distance()`
  * for a complete description of the parameters and requirements. The following extra named parameter
@@ -21,11 +21,14 @@
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/Weights/cotangent_weights.h>
+#include <CGAL/Default.h>
+#include <CGAL/tags.h>
 
 #if defined(CGAL_EIGEN3_ENABLED)
 #include <CGAL/Eigen_solver_traits.h>  // for sparse linear system solver
 #endif
 
+#include <memory>
 #include <type_traits>
 
 namespace CGAL {
@@ -33,10 +36,26 @@ namespace CGAL {
 namespace Polygon_mesh_processing {
 
 namespace internal {
+
+#if defined(CGAL_EIGEN3_ENABLED)
+  #if EIGEN_VERSION_AT_LEAST(3,2,0)
+  typedef CGAL::Eigen_solver_traits<Eigen::SparseLU<
+    CGAL::Eigen_sparse_matrix<double>::EigenType, Eigen::COLAMDOrdering<int> >  >
+    Default_fairing_solver;
+  #else
+  typedef bool Default_fairing_solver;//compilation should crash
+    //if no solver is provided and Eigen version < 3.2
+  #endif
+#else
+  typedef bool Default_fairing_solver;//compilation should crash
+    //if no solver is provided and Eigen version < 3.2
+#endif
+
   // use non-default weight calculator and non-default solver
   // WeightCalculator a model of `FairWeightCalculator`, can be omitted to use default Cotangent weights
   // weight_calculator a function object to calculate weights, defaults to Cotangent weights and can be omitted
-  template<typename SparseLinearSolver,
+  template<typename ConcurrencyTag,
+           typename SparseLinearSolver,
            typename WeightCalculator,
            typename TriangleMesh,
            typename VertexRange,
@@ -51,7 +70,7 @@ bool fair(TriangleMesh& tmesh,
   CGAL::Polygon_mesh_processing::internal::Fair_Polyhedron_3
      <TriangleMesh, SparseLinearSolver, WeightCalculator, VertexPointMap>
      fair_functor(tmesh, vpmap, weight_calculator);
-  return fair_functor.fair(vertices, solver, continuity);
+  return fair_functor.template fair<ConcurrencyTag>(vertices, solver, continuity);
 }
 
 } //end namespace internal
@@ -114,10 +133,19 @@ bool fair(TriangleMesh& tmesh,
                         is provided as default value:\n
                         `CGAL::Eigen_solver_traits<Eigen::SparseLU<CGAL::Eigen_sparse_matrix<double>::%EigenType, Eigen::COLAMDOrdering<int> > >`}
     \cgalParamNEnd
+
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamExtra{Only the construction of the linear system is done concurrently.}
+    \cgalParamNEnd
   \cgalNamedParamsEnd
 
   @return `true` if fairing is successful, otherwise no vertices are relocated.
 
+  \sa `Fairing_system`
+
   @pre `is_triangle_mesh(tmesh)`
 
   @warning This function involves linear algebra, that is computed using non-exact, floating-point arithmetic.
@@ -136,18 +164,17 @@ bool fair(TriangleMesh& tmesh,
 
     CGAL_precondition(is_triangle_mesh(tmesh));
 
-#if defined(CGAL_EIGEN3_ENABLED)
-  #if EIGEN_VERSION_AT_LEAST(3,2,0)
-    typedef CGAL::Eigen_solver_traits<Eigen::SparseLU<
-      CGAL::Eigen_sparse_matrix<double>::EigenType, Eigen::COLAMDOrdering<int> >  >
-      Default_solver;
-  #else
-    typedef bool Default_solver;//compilation should crash
-      //if no solver is provided and Eigen version < 3.2
-  #endif
-#else
-    typedef bool Default_solver;//compilation should crash
-      //if no solver is provided and Eigen version < 3.2
+    typedef internal::Default_fairing_solver Default_solver;
+
+    typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      NamedParameters,
+      Sequential_tag
+    > ::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
 #endif
 
 #if defined(CGAL_EIGEN3_ENABLED)
@@ -172,13 +199,172 @@ bool fair(TriangleMesh& tmesh,
     // the issue #4706 - https://github.com/CGAL/cgal/issues/4706.
     typedef CGAL::Weights::Secure_cotangent_weight_with_voronoi_area<TriangleMesh, VPMap, GT> Default_weight_calculator;
 
-    return internal::fair(tmesh, vertices,
+    return internal::fair<Concurrency_tag>(tmesh, vertices,
       choose_parameter<Default_solver>(get_parameter(np, internal_np::sparse_linear_solver)),
       choose_parameter(get_parameter(np, internal_np::weight_calculator), Default_weight_calculator(tmesh, vpmap, gt)),
       choose_parameter(get_parameter(np, internal_np::fairing_continuity), 1),
       vpmap);
   }
 
+  /*!
+  \ingroup PMP_meshing_grp
+
+  @brief fairs a fixed region of a triangle mesh repeatedly, for different positions of the vertices
+  that are not in the region.
+
+  The linear system solved by `fair()` only depends on the region and on the weights of its edges,
+  the positions of the fixed vertices around the region appearing in its right-hand side only.
+  This class builds and factorizes the system once, at construction, using the current positions
+  of the vertices to compute the weights. Each call to `fair()` then only solves the factorized
+  system for the current positions of the fixed vertices, which is much cheaper than calling
+  the free function `CGAL::Polygon_mesh_processing::fair()`. This is typically useful in interactive
+  applications, where the fixed vertices are moved, for example when dragging a handle.
+
+  Note that the connectivity of the mesh, and the positions of the vertices of the region
+  and of the vertices incident to it must not be changed between the construction
+  and the calls to `fair()`, apart from the changes made by `fair()` itself.
+
+  @tparam TriangleMesh a model of `FaceGraph` and `MutableFaceGraph`
+  @tparam VertexPointMap a model of `ReadWritePropertyMap` with `boost::graph_traits<TriangleMesh>::%vertex_descriptor`
+          as key type and `%Point_3` as value type. The default is the type of the internal property map
+          for `CGAL::vertex_point_t` of `TriangleMesh`.
+  @tparam SparseLinearSolver a model of `SparseLinearAlgebraWithFactorTraits_d`. If \ref thirdpartyEigen "Eigen" 3.2
+          (or greater) is available and `CGAL_EIGEN3_ENABLED` is defined, the default is
+          `CGAL::Eigen_solver_traits<Eigen::SparseLU<CGAL::Eigen_sparse_matrix<double>::%EigenType, Eigen::COLAMDOrdering<int> > >`.
+
+  \sa `CGAL::Polygon_mesh_processing::fair()`
+  */
+  template<typename TriangleMesh,
+           typename VertexPointMap = Default,
+           typename SparseLinearSolver = Default>
+  class Fairing_system
+  {
+    typedef typename boost::property_map<TriangleMesh, vertex_point_t>::type Default_vpm;
+    typedef typename Default::Get<VertexPointMap, Default_vpm>::type          VPM;
+    typedef typename Default::Get<SparseLinearSolver,
+                                  internal::Default_fairing_solver>::type    Solver;
+    typedef typename Kernel_traits<
+      typename boost::property_traits<VPM>::value_type>::Kernel               GT;
+    typedef CGAL::Weights::Secure_cotangent_weight_with_voronoi_area<TriangleMesh, VPM, GT> Weight_calculator;
+    typedef internal::Fair_Polyhedron_3<TriangleMesh, Solver, Weight_calculator, VPM>       Fair_functor;
+
+#if defined(CGAL_EIGEN3_ENABLED)
+    static_assert(!std::is_same<Solver, bool>::value || EIGEN_VERSION_AT_LEAST(3, 2, 0),
+                  "The class `Fairing_system` requires Eigen3 version 3.2 or later.");
+#else
+    static_assert(!std::is_same<Solver, bool>::value,
+                  "The class `Fairing_system` requires Eigen3 version 3.2 or later.");
+#endif
+
+  public:
+    /*!
+    builds and factorizes the linear system used to fair the region formed by `vertices`.
+
+    @tparam VertexRange a range of vertex descriptors of `TriangleMesh`, model of `Range`.
+            Its iterator type is `InputIterator`.
+    @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+    @param tmesh the triangle mesh with the region to be faired
+    @param vertices the vertices of the region (the positions of only those vertices will be changed)
+    @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+    \cgalNamedParamsBegin
+      \cgalParamNBegin{vertex_point_map}
+        \cgalParamDescription{a property map associating points to the vertices of `tmesh`}
+        \cgalParamType{`VertexPointMap`}
+        \cgalParamDefault{`boost::get(CGAL::vertex_point, tmesh)`}
+      \cgalParamNEnd
+
+      \cgalParamNBegin{geom_traits}
+        \cgalParamDescription{an instance of a geometric traits class}
+        \cgalParamType{a class model of `Kernel`}
+        \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+      \cgalParamNEnd
+
+      \cgalParamNBegin{fairing_continuity}
+        \cgalParamDescription{A value controlling the tangential continuity of the output surface patch.
+                              The possible values are 0, 1 and 2, referring to the  C<sup>0</sup>, C<sup>1</sup>
+                              and C<sup>2</sup> continuity.}
+        \cgalParamType{unsigned int}
+        \cgalParamDefault{`1`}
+      \cgalParamNEnd
+
+      \cgalParamNBegin{sparse_linear_solver}
+        \cgalParamDescription{an instance of the sparse linear solver used for fairing}
+        \cgalParamType{`SparseLinearSolver`}
+        \cgalParamDefault{`SparseLinearSolver()`}
+      \cgalParamNEnd
+
+      \cgalParamNBegin{concurrency_tag}
+        \cgalParamDescription{a tag indicating if the construction of the linear system should be done
+                              using one or several threads.}
+        \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+        \cgalParamDefault{`CGAL::Sequential_tag`}
+      \cgalParamNEnd
+    \cgalNamedParamsEnd
+
+    @pre `is_triangle_mesh(tmesh)`
+    */
+    template<typename VertexRange,
+             typename NamedParameters = parameters::Default_named_parameters>
+    Fairing_system(TriangleMesh& tmesh,
+                   const VertexRange& vertices,
+                   const NamedParameters& np = parameters::default_values())
+      : m_solver(parameters::choose_parameter<Solver>(parameters::get_parameter(np, internal_np::sparse_linear_solver)))
+    {
+      using parameters::get_parameter;
+      using parameters::choose_parameter;
+
+      CGAL_precondition(is_triangle_mesh(tmesh));
+
+      typedef typename internal_np::Lookup_named_param_def <
+        internal_np::concurrency_tag_t,
+        NamedParameters,
+        Sequential_tag
+      > ::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+      static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                     "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+      VPM vpmap = choose_parameter(get_parameter(np, internal_np::vertex_point),
+                                   get_property_map(vertex_point, tmesh));
+      GT gt = choose_parameter<GT>(get_parameter(np, internal_np::geom_traits));
+
+      m_fair_functor.reset(new Fair_functor(tmesh, vpmap, Weight_calculator(tmesh, vpmap, gt)));
+      m_is_factorized =
+        m_fair_functor->template setup_system<Concurrency_tag>(vertices,
+          choose_parameter(get_parameter(np, internal_np::fairing_continuity), 1)) &&
+        m_fair_functor->factor(m_solver);
+    }
+
+    /*!
+    returns `true` if the linear system could be factorized, and `false` otherwise,
+    in which case `fair()` always fails.
+    */
+    bool is_factorized() const
+    {
+      return m_is_factorized;
+    }
+
+    /*!
+    relocates the vertices of the region, using the current positions of the fixed vertices
+    as boundary conditions.
+
+    @return `true` if fairing is successful, otherwise no vertices are relocated.
+    */
+    bool fair()
+    {
+      return m_is_factorized && m_fair_functor->solve(m_solver);
+    }
+
+  private:
+    Solver m_solver;
+    std::unique_ptr<Fair_functor> m_fair_functor;
+    bool m_is_factorized;
+  };
+
 } // namespace Polygon_mesh_processing
 
 } // namespace CGAL
@@ -466,9 +466,15 @@ template <class TriangleMesh,
           class Kernel_ = Default,
           class EdgeMarkMapBind_  = Default,
           class EdgeMarkMapTuple_ = Default,
-          class UserVisitor_      = Default>
+          class UserVisitor_      = Default,
+          class ConcurrencyTag    = Sequential_tag>
 class Face_graph_output_builder
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
 //Default typedefs
   typedef typename Default::Get<
     Kernel_,
@@ -1820,6 +1826,9 @@ public:
       VPM_helper::build_tree(tm2, tree, vertex_to_node_id2, fids2, vpm2, nodes);
       Side_of_triangle_mesh<TriangleMesh, Exact_kernel, SOTM_vpm2, Tree_type> inside_tm2(tree);
 
+      // one point per patch to be located, the location tests being done
+      // afterwards, possibly concurrently
+      std::vector<std::pair<std::size_t, typename Exact_kernel::Point_3> > patch_queries;
       for(face_descriptor f : faces(tm1))
       {
         const std::size_t f_id = get(fids1, f);
@@ -1852,28 +1861,33 @@ public:
             }
             else
             {
-              typename Exact_kernel::Point_3 e_centroid =
-                centroid(nodes.exact_node(fnids[0]),
-                         nodes.exact_node(fnids[1]),
-                         nodes.exact_node(fnids[2]));
-
-              Bounded_side position = inside_tm2(e_centroid);
-
-              CGAL_assertion( position != ON_BOUNDARY);
-              if ( position == in_tm2 )
-                is_patch_inside_tm2.set(patch_id);
+              patch_queries.emplace_back(patch_id,
+                                         centroid(nodes.exact_node(fnids[0]),
+                                                  nodes.exact_node(fnids[1]),
+                                                  nodes.exact_node(fnids[2])));
             }
           }
           else
-          {
-            Bounded_side position = inside_tm2( nodes.to_exact(get(vpm1, target(h, tm1))));
-            CGAL_assertion( position != ON_BOUNDARY);
-            if ( position == in_tm2 )
-              is_patch_inside_tm2.set(patch_id);
-          }
+            patch_queries.emplace_back(patch_id, nodes.to_exact(get(vpm1, target(h, tm1))));
           if ( patch_status_not_set_tm1.none() ) break;
         }
       }
+
+      std::vector<Bounded_side> positions(patch_queries.size());
+      CGAL::for_each<ConcurrencyTag>(
+        CGAL::make_counting_range<std::size_t>(0, patch_queries.size()),
+        [&](const std::size_t i) -> bool
+        {
+          positions[i] = inside_tm2(patch_queries[i].second);
+          return true;
+        });
+
+      for(std::size_t i=0; i<patch_queries.size(); ++i)
+      {
+        CGAL_assertion( positions[i] != ON_BOUNDARY);
+        if ( positions[i] == in_tm2 )
+          is_patch_inside_tm2.set(patch_queries[i].first);
+      }
     }
 
     if (used_to_clip_a_surface) patch_status_not_set_tm2.reset();
@@ -1897,6 +1911,9 @@ public:
       VPM_helper::build_tree(tm1, tree, vertex_to_node_id1, fids1, vpm1, nodes);
       Side_of_triangle_mesh<TriangleMesh, Exact_kernel, SOTM_vpm1, Tree_type> inside_tm1(tree);
 
+      // one point per patch to be located, the location tests being done
+      // afterwards, possibly concurrently
+      std::vector<std::pair<std::size_t, typename Exact_kernel::Point_3> > patch_queries;
       for(face_descriptor f : faces(tm2))
       {
         const std::size_t f_id = get(fids2, f);
@@ -1928,26 +1945,33 @@ public:
             }
             else
             {
-              typename Exact_kernel::Point_3 e_centroid =
-                centroid(nodes.exact_node(fnids[0]),
-                         nodes.exact_node(fnids[1]),
-                         nodes.exact_node(fnids[2]));
-              Bounded_side position = inside_tm1(e_centroid);
-              CGAL_assertion( position != ON_BOUNDARY);
-              if ( position == in_tm1 )
-                is_patch_inside_tm1.set(patch_id);
+              patch_queries.emplace_back(patch_id,
+                                         centroid(nodes.exact_node(fnids[0]),
+                                                  nodes.exact_node(fnids[1]),
+                                                  nodes.exact_node(fnids[2])));
             }
           }
           else
-          {
-            Bounded_side position = inside_tm1( nodes.to_exact(get(vpm2, target(h, tm2))));
-            CGAL_assertion( position != ON_BOUNDARY);
-            if ( position == in_tm1 )
-              is_patch_inside_tm1.set(patch_id);
-          }
+            patch_queries.emplace_back(patch_id, nodes.to_exact(get(vpm2, target(h, tm2))));
           if ( patch_status_not_set_tm2.none() ) break;
         }
       }
+
+      std::vector<Bounded_side> positions(patch_queries.size());
+      CGAL::for_each<ConcurrencyTag>(
+        CGAL::make_counting_range<std::size_t>(0, patch_queries.size()),
+        [&](const std::size_t i) -> bool
+        {
+          positions[i] = inside_tm1(patch_queries[i].second);
+          return true;
+        });
+
+      for(std::size_t i=0; i<patch_queries.size(); ++i)
+      {
+        CGAL_assertion( positions[i] != ON_BOUNDARY);
+        if ( positions[i] == in_tm1 )
+          is_patch_inside_tm1.set(patch_queries[i].first);
+      }
     }
 
     CGAL_assertion(patch_status_not_set_tm1.none());
@@ -21,6 +21,9 @@
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/face_graph_utils.h>
 #include <CGAL/utility.h>
 #include <CGAL/Default.h>
+#include <CGAL/for_each.h>
+#include <CGAL/iterator.h>
+#include <CGAL/tags.h>
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/Constrained_Delaunay_triangulation_2.h>
 #include <CGAL/Projection_traits_3.h>
@@ -29,6 +32,8 @@
 #include <boost/container/flat_map.hpp>
 #include <boost/container/small_vector.hpp>
 
+#include <memory>
+
 namespace CGAL{
 namespace Polygon_mesh_processing {
 namespace Corefinement{
@@ -440,8 +445,13 @@ template< class TriangleMesh,
           class EdgeMarkMapBind_ = Default,
           class UserVisitor_ = Default,
           bool doing_autorefinement = false,
-          bool handle_non_manifold_features = false >
+          bool handle_non_manifold_features = false,
+          class ConcurrencyTag = Sequential_tag >
 class Surface_intersection_visitor_for_corefinement{
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
 //default template parameters
   typedef typename Default::Get<EdgeMarkMapBind_,
     Ecm_bind<TriangleMesh, No_mark<TriangleMesh> > >::type      EdgeMarkMapBind;
@@ -1188,6 +1198,221 @@ public:
     }
   }
 
+  // the data used to import in a face the constrained triangulation of
+  // the intersection points and intersection edges of that face
+  struct Face_triangulation
+  {
+    std::unique_ptr<CDT> cdt;
+    std::map<Node_id,CDT_Vertex_handle> id_to_CDT_vh;
+    //associate an edge of the triangulation to a halfedge in a given polyhedron
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor> edge_to_hedge;
+    std::vector<std::pair<Node_id,Node_id> > constrained_edges;
+    // the vertices of f
+    std::array<vertex_descriptor,3> f_vertices;
+    // the node_id of an input vertex or a fake id (>=nb_nodes)
+    std::array<Node_id,3> f_indices;
+  };
+
+  // collects the vertices of `f` and their node ids
+  void init_face_triangulation(face_descriptor f,
+                               TriangleMesh& tm,
+                               Face_boundary* f_boundary_ptr,
+                               Vertex_to_node_id& vertex_to_node_id,
+                               const Node_id nb_nodes,
+                               Face_triangulation& ft)
+  {
+    std::array<vertex_descriptor,3>& f_vertices = ft.f_vertices;
+    std::array<Node_id,3>& f_indices = ft.f_indices;
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor>& edge_to_hedge = ft.edge_to_hedge;
+
+    f_indices = {{nb_nodes,nb_nodes+1,nb_nodes+2}};
+    if (f_boundary_ptr!=nullptr){ //the boundary of the triangle face was refined
+      f_vertices[0]=f_boundary_ptr->vertices[0];
+      f_vertices[1]=f_boundary_ptr->vertices[1];
+      f_vertices[2]=f_boundary_ptr->vertices[2];
+      update_face_indices(f_vertices,f_indices,vertex_to_node_id);
+    }
+    else{
+      CGAL_assertion( is_triangle(halfedge(f,tm),tm) );
+      halfedge_descriptor h0=halfedge(f,tm), h1=next(h0,tm), h2=next(h1,tm);
+      f_vertices[0]=target(h0,tm); //nb_nodes
+      f_vertices[1]=target(h1,tm); //nb_nodes+1
+      f_vertices[2]=target(h2,tm); //nb_nodes+2
+
+      update_face_indices(f_vertices,f_indices,vertex_to_node_id);
+      edge_to_hedge[std::make_pair( f_indices[2],f_indices[0] )] = h0;
+      edge_to_hedge[std::make_pair( f_indices[0],f_indices[1] )] = h1;
+      edge_to_hedge[std::make_pair( f_indices[1],f_indices[2] )] = h2;
+    }
+  }
+
+  // returns `true` if the triangulation of the face uses or provides the
+  // constrained edges ensuring that triangulations of coplanar faces are
+  // compatible (see XSL_TAG_CPL_VERT), and thus depends on the order in
+  // which faces are triangulated
+  bool involves_coplanar_vertices(const Face_triangulation& ft,
+                                  const Node_ids& node_ids,
+                                  const Face_boundary* f_boundary_ptr) const
+  {
+    if (number_coplanar_vertices == 0) return false;
+    for (Node_id id : ft.f_indices)
+      if (id < number_coplanar_vertices) return true;
+    for (Node_id id : node_ids)
+      if (id < number_coplanar_vertices) return true;
+    if (f_boundary_ptr != nullptr)
+      for (int i=0;i<3;++i)
+        for (Node_id id : f_boundary_ptr->node_ids_array[i])
+          if (id < number_coplanar_vertices) return true;
+    return false;
+  }
+
+  // builds the constrained triangulation of the face `ft` was initialized with.
+  // Only intersection nodes and the halfedges of the face are accessed, so that
+  // independent faces can be processed concurrently.
+  template <class VPM>
+  void build_face_triangulation(Face_triangulation& ft,
+                                Node_ids& node_ids,
+                                Face_boundary* f_boundary_ptr,
+                                TriangleMesh& tm,
+                                const VPM& vpm,
+                                const INodes& nodes,
+                                const Node_id nb_nodes)
+  {
+    const std::array<vertex_descriptor,3>& f_vertices = ft.f_vertices;
+    const std::array<Node_id,3>& f_indices = ft.f_indices;
+    std::map<Node_id,CDT_Vertex_handle>& id_to_CDT_vh = ft.id_to_CDT_vh;
+    std::map<std::pair<Node_id,Node_id>,halfedge_descriptor>& edge_to_hedge = ft.edge_to_hedge;
+    std::vector<std::pair<Node_id,Node_id> >& constrained_edges = ft.constrained_edges;
+
+    typename EK::Point_3 p = nodes.to_exact(get(vpm,f_vertices[0])),
+                         q = nodes.to_exact(get(vpm,f_vertices[1])),
+                         r = nodes.to_exact(get(vpm,f_vertices[2]));
+///TODO use a positive normal and remove all workaround to guarantee that triangulation of coplanar patches are compatible
+    CDT_traits traits(typename EK::Construct_normal_3()(p,q,r));
+    ft.cdt.reset(new CDT(traits));
+    CDT& cdt = *ft.cdt;
+
+    // insert triangle points
+    std::array<CDT_Vertex_handle,3> triangle_vertices;
+    //we can do this to_exact because these are supposed to be input points.
+    triangle_vertices[0]=cdt.insert_outside_affine_hull(p);
+    triangle_vertices[1]=cdt.insert_outside_affine_hull(q);
+    triangle_vertices[2]=cdt.tds().insert_dim_up(cdt.infinite_vertex(), false);
+    triangle_vertices[2]->set_point(r);
+
+    triangle_vertices[0]->info()=f_indices[0];
+    triangle_vertices[1]->info()=f_indices[1];
+    triangle_vertices[2]->info()=f_indices[2];
+
+    //if one of the triangle input vertex is also a node
+    for (int ik=0;ik<3;++ik){
+      if ( f_indices[ik]<nb_nodes )
+        id_to_CDT_vh.insert(
+            std::make_pair(f_indices[ik],triangle_vertices[ik]));
+    }
+    //insert points on edges
+    if (f_boundary_ptr!=nullptr) //if f not a triangle?
+    {
+      // collect infinite faces incident to the initial triangle
+      typename CDT::Face_handle infinite_faces[3];
+      for (int i=0;i<3;++i)
+      {
+        int oi=-1;
+        CGAL_assertion_code(bool is_edge = )
+        cdt.is_edge(triangle_vertices[i], triangle_vertices[(i+1)%3], infinite_faces[i], oi);
+        CGAL_assertion(is_edge);
+        CGAL_assertion( cdt.is_infinite( infinite_faces[i]->vertex(oi) ) );
+      }
+
+      // In this loop, for each original edge of the triangle, we insert
+      // the constrained edges and we recover the halfedge_descriptor
+      // corresponding to these constrained (they are already in tm)
+      Face_boundary& f_boundary=*f_boundary_ptr;
+      for (int i=0;i<3;++i){
+        //handle case of halfedge starting at triangle_vertices[i]
+        // and ending at triangle_vertices[(i+1)%3]
+
+        const Node_ids& ids_on_edge=f_boundary.node_ids_array[i];
+        CDT_Vertex_handle previous=triangle_vertices[i];
+        Node_id prev_index=f_indices[i];// node-id of the mesh vertex
+        halfedge_descriptor hedge = next(f_boundary.halfedges[(i+2)%3],tm);
+        CGAL_assertion( source(hedge,tm)==f_boundary.vertices[i] );
+        if (!ids_on_edge.empty()){ //is there at least one node on this edge?
+          // fh must be an infinite face
+          // The points must be ordered from fh->vertex(cw(infinite_vertex)) to fh->vertex(ccw(infinite_vertex))
+          for(Node_id id : ids_on_edge)
+          {
+            CDT_Vertex_handle vh=insert_point_on_ch_edge(cdt,infinite_faces[i],nodes.exact_node(id));
+            vh->info()=id;
+            id_to_CDT_vh.insert(std::make_pair(id,vh));
+            edge_to_hedge[std::make_pair(prev_index,id)]=hedge;
+            previous=vh;
+            hedge=next(hedge,tm);
+            prev_index=id;
+          }
+        }
+        else{
+        CGAL_assertion_code(halfedge_descriptor hd=f_boundary.halfedges[i]);
+          CGAL_assertion( target(hd,tm) == f_boundary.vertices[(i+1)%3] );
+          CGAL_assertion( source(hd,tm) == f_boundary.vertices[ i ] );
+        }
+        CGAL_assertion(hedge==f_boundary.halfedges[i]);
+        edge_to_hedge[std::make_pair(prev_index,f_indices[(i+1)%3])] =
+          f_boundary.halfedges[i];
+      }
+    }
+
+    //insert point inside face
+    for(Node_id node_id : node_ids)
+    {
+      CDT_Vertex_handle vh=cdt.insert(nodes.exact_node(node_id));
+      vh->info()=node_id;
+      id_to_CDT_vh.insert(std::make_pair(node_id,vh));
+    }
+
+    // insert constraints that are interior to the triangle (in the case
+    // no edges are collinear in the meshes)
+    insert_constrained_edges(node_ids,cdt,id_to_CDT_vh,constrained_edges);
+
+    // insert constraints between points that are on the boundary
+    // (not a constrained on the triangle boundary)
+    if (f_boundary_ptr!=nullptr) //is f not a triangle ?
+    {
+      for (int i=0;i<3;++i)
+      {
+        Node_ids& ids=f_boundary_ptr->node_ids_array[i];
+        insert_constrained_edges(ids,cdt,id_to_CDT_vh,constrained_edges,1);
+      }
+    }
+
+    //insert coplanar edges for endpoints of triangles
+    for (int i=0;i<3;++i){
+      Node_id nindex=triangle_vertices[i]->info();
+      if ( nindex < nb_nodes )
+        insert_constrained_edges_coplanar_case(nindex,cdt,id_to_CDT_vh);
+    }
+  }
+
+  void set_temporary_vertices_for_retriangulation(const Face_triangulation& ft,
+                                                  Node_id_to_vertex& node_id_to_vertex,
+                                                  const Node_id nb_nodes)
+  {
+    node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes, ft.f_vertices[0]);
+    node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+1, ft.f_vertices[1]);
+    node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+2, ft.f_vertices[2]);
+
+    //if one of the triangle input vertex is also a node
+    if (doing_autorefinement || handle_non_manifold_features)
+      for (int ik=0;ik<3;++ik)
+        if ( ft.f_indices[ik]<nb_nodes )
+          // update the current vertex in node_id_to_vertex
+          // to match the one of the face
+          node_id_to_vertex.set_temporary_vertex_for_retriangulation(ft.f_indices[ik], ft.f_vertices[ik]);
+          // Note on set_temporary_vertex instead of set_vertex: here since the point is an input point
+          // it is OK not to store all vertices corresponding to this id as the approximate version
+          // is already tight and the call in Intersection_nodes::finalize() will not fix anything
+  }
+
   template <class OnFaceMapIterator, class VPM>
   void triangulate_intersected_faces(OnFaceMapIterator it,
                                      const VPM& vpm,
@@ -1204,46 +1429,70 @@ public:
 
     const Node_id nb_nodes = nodes.size();
 
+    // The triangulations of the faces that do not depend on the triangulation
+    // of other faces are built beforehand, possibly concurrently.
+    std::vector<std::unique_ptr<Face_triangulation> > prebuilt_triangulations;
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      std::vector<typename On_face_map::iterator> face_its;
+      face_its.reserve(on_face_map.size());
+      for (typename On_face_map::iterator it=on_face_map.begin();
+            it!=on_face_map.end();++it)
+        face_its.push_back(it);
+
+      prebuilt_triangulations.resize(face_its.size());
+      CGAL::for_each<ConcurrencyTag>(
+        CGAL::make_counting_range<std::size_t>(0, face_its.size()),
+        [&](const std::size_t i) -> bool
+        {
+          face_descriptor f = face_its[i]->first;
+          typename Face_boundaries::iterator it_fb=face_boundaries.find(f);
+          Face_boundary* f_boundary_ptr = it_fb!=face_boundaries.end() ? &it_fb->second : nullptr;
+
+          std::unique_ptr<Face_triangulation> ft(new Face_triangulation());
+          init_face_triangulation(f, tm, f_boundary_ptr, vertex_to_node_id, nb_nodes, *ft);
+          if ( (const_mesh_ptr && collinear( get(vpm,ft->f_vertices[0]),
+                                             get(vpm,ft->f_vertices[1]),
+                                             get(vpm,ft->f_vertices[2]) ) ) ||
+               involves_coplanar_vertices(*ft, face_its[i]->second, f_boundary_ptr) )
+            return true;
+
+          build_face_triangulation(*ft, face_its[i]->second, f_boundary_ptr, tm, vpm, nodes, nb_nodes);
+          prebuilt_triangulations[i] = std::move(ft);
+          return true;
+        });
+    }
+
+    std::size_t face_rank = 0;
     for (typename On_face_map::iterator it=on_face_map.begin();
-          it!=on_face_map.end();++it)
+          it!=on_face_map.end();++it, ++face_rank)
     {
       user_visitor.triangulating_faces_step();
       face_descriptor f = it->first; //the face to be triangulated
       Node_ids& node_ids  = it->second; // ids of nodes in the interior of f
       typename Face_boundaries::iterator it_fb=face_boundaries.find(f);
+      Face_boundary* f_boundary_ptr = it_fb!=face_boundaries.end() ? &it_fb->second : nullptr;
 
-      std::map<Node_id,typename CDT::Vertex_handle> id_to_CDT_vh;
-
-      //associate an edge of the triangulation to a halfedge in a given polyhedron
-      std::map<std::pair<Node_id,Node_id>,halfedge_descriptor> edge_to_hedge;
-
-      // the vertices of f
-      std::array<vertex_descriptor,3> f_vertices;
-      // the node_id of an input vertex or a fake id (>=nb_nodes)
-      std::array<Node_id,3> f_indices = {{nb_nodes,nb_nodes+1,nb_nodes+2}};
-      if (it_fb!=face_boundaries.end()){ //the boundary of the triangle face was refined
-        f_vertices[0]=it_fb->second.vertices[0];
-        f_vertices[1]=it_fb->second.vertices[1];
-        f_vertices[2]=it_fb->second.vertices[2];
-        update_face_indices(f_vertices,f_indices,vertex_to_node_id);
-        if (doing_autorefinement || handle_non_manifold_features)
-          it_fb->second.update_node_id_to_vertex_map(node_id_to_vertex, tm);
-      }
-      else{
-        CGAL_assertion( is_triangle(halfedge(f,tm),tm) );
-        halfedge_descriptor h0=halfedge(f,tm), h1=next(h0,tm), h2=next(h1,tm);
-        f_vertices[0]=target(h0,tm); //nb_nodes
-        f_vertices[1]=target(h1,tm); //nb_nodes+1
-        f_vertices[2]=target(h2,tm); //nb_nodes+2
-
-        update_face_indices(f_vertices,f_indices,vertex_to_node_id);
-        edge_to_hedge[std::make_pair( f_indices[2],f_indices[0] )] = h0;
-        edge_to_hedge[std::make_pair( f_indices[0],f_indices[1] )] = h1;
-        edge_to_hedge[std::make_pair( f_indices[1],f_indices[2] )] = h2;
+      std::unique_ptr<Face_triangulation> ft_ptr;
+      if (!prebuilt_triangulations.empty())
+        ft_ptr = std::move(prebuilt_triangulations[face_rank]);
+      const bool is_prebuilt = (ft_ptr != nullptr);
+      if (!is_prebuilt)
+      {
+        ft_ptr.reset(new Face_triangulation());
+        init_face_triangulation(f, tm, f_boundary_ptr, vertex_to_node_id, nb_nodes, *ft_ptr);
       }
+      Face_triangulation& ft = *ft_ptr;
+      const std::array<vertex_descriptor,3>& f_vertices = ft.f_vertices;
+      const std::array<Node_id,3>& f_indices = ft.f_indices;
+      std::map<std::pair<Node_id,Node_id>,halfedge_descriptor>& edge_to_hedge = ft.edge_to_hedge;
+      std::vector<std::pair<Node_id,Node_id> >& constrained_edges = ft.constrained_edges;
+
+      if (f_boundary_ptr!=nullptr && (doing_autorefinement || handle_non_manifold_features))
+        f_boundary_ptr->update_node_id_to_vertex_map(node_id_to_vertex, tm);
 
       // handle possible presence of degenerate faces
-      if (const_mesh_ptr && collinear( get(vpm,f_vertices[0]), get(vpm,f_vertices[1]), get(vpm,f_vertices[2]) ) )
+      if (!is_prebuilt && const_mesh_ptr && collinear( get(vpm,f_vertices[0]), get(vpm,f_vertices[1]), get(vpm,f_vertices[2]) ) )
       {
         Node_ids face_vertex_nids;
 
@@ -1333,127 +1582,11 @@ public:
         continue;
       }
 
-      typename EK::Point_3 p = nodes.to_exact(get(vpm,f_vertices[0])),
-                           q = nodes.to_exact(get(vpm,f_vertices[1])),
-                           r = nodes.to_exact(get(vpm,f_vertices[2]));
-///TODO use a positive normal and remove all workaround to guarantee that triangulation of coplanar patches are compatible
-      CDT_traits traits(typename EK::Construct_normal_3()(p,q,r));
-      CDT cdt(traits);
-
-      // insert triangle points
-      std::array<CDT_Vertex_handle,3> triangle_vertices;
-      //we can do this to_exact because these are supposed to be input points.
-      triangle_vertices[0]=cdt.insert_outside_affine_hull(p);
-      triangle_vertices[1]=cdt.insert_outside_affine_hull(q);
-      triangle_vertices[2]=cdt.tds().insert_dim_up(cdt.infinite_vertex(), false);
-      triangle_vertices[2]->set_point(r);
-
-      triangle_vertices[0]->info()=f_indices[0];
-      triangle_vertices[1]->info()=f_indices[1];
-      triangle_vertices[2]->info()=f_indices[2];
-
-      node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes, f_vertices[0]);
-      node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+1, f_vertices[1]);
-      node_id_to_vertex.set_temporary_vertex_for_retriangulation(nb_nodes+2, f_vertices[2]);
-
-      //if one of the triangle input vertex is also a node
-      for (int ik=0;ik<3;++ik){
-        if ( f_indices[ik]<nb_nodes )
-        {
-          id_to_CDT_vh.insert(
-              std::make_pair(f_indices[ik],triangle_vertices[ik]));
-          if (doing_autorefinement || handle_non_manifold_features)
-            // update the current vertex in node_id_to_vertex
-            // to match the one of the face
-            node_id_to_vertex.set_temporary_vertex_for_retriangulation(f_indices[ik], f_vertices[ik]);
-            // Note on set_temporary_vertex instead of set_vertex: here since the point is an input point
-            // it is OK not to store all vertices corresponding to this id as the approximate version
-            // is already tight and the call in Intersection_nodes::finalize() will not fix anything
-        }
-      }
-      //insert points on edges
-      if (it_fb!=face_boundaries.end()) //if f not a triangle?
-      {
-        // collect infinite faces incident to the initial triangle
-        typename CDT::Face_handle infinite_faces[3];
-        for (int i=0;i<3;++i)
-        {
-          int oi=-1;
-          CGAL_assertion_code(bool is_edge = )
-          cdt.is_edge(triangle_vertices[i], triangle_vertices[(i+1)%3], infinite_faces[i], oi);
-          CGAL_assertion(is_edge);
-          CGAL_assertion( cdt.is_infinite( infinite_faces[i]->vertex(oi) ) );
-        }
-
-        // In this loop, for each original edge of the triangle, we insert
-        // the constrained edges and we recover the halfedge_descriptor
-        // corresponding to these constrained (they are already in tm)
-        Face_boundary& f_boundary=it_fb->second;
-        for (int i=0;i<3;++i){
-          //handle case of halfedge starting at triangle_vertices[i]
-          // and ending at triangle_vertices[(i+1)%3]
-
-          const Node_ids& ids_on_edge=f_boundary.node_ids_array[i];
-          CDT_Vertex_handle previous=triangle_vertices[i];
-          Node_id prev_index=f_indices[i];// node-id of the mesh vertex
-          halfedge_descriptor hedge = next(f_boundary.halfedges[(i+2)%3],tm);
-          CGAL_assertion( source(hedge,tm)==f_boundary.vertices[i] );
-          if (!ids_on_edge.empty()){ //is there at least one node on this edge?
-            // fh must be an infinite face
-            // The points must be ordered from fh->vertex(cw(infinite_vertex)) to fh->vertex(ccw(infinite_vertex))
-            for(Node_id id : ids_on_edge)
-            {
-              CDT_Vertex_handle vh=insert_point_on_ch_edge(cdt,infinite_faces[i],nodes.exact_node(id));
-              vh->info()=id;
-              id_to_CDT_vh.insert(std::make_pair(id,vh));
-              edge_to_hedge[std::make_pair(prev_index,id)]=hedge;
-              previous=vh;
-              hedge=next(hedge,tm);
-              prev_index=id;
-            }
-          }
-          else{
-          CGAL_assertion_code(halfedge_descriptor hd=f_boundary.halfedges[i]);
-            CGAL_assertion( target(hd,tm) == f_boundary.vertices[(i+1)%3] );
-            CGAL_assertion( source(hd,tm) == f_boundary.vertices[ i ] );
-          }
-          CGAL_assertion(hedge==f_boundary.halfedges[i]);
-          edge_to_hedge[std::make_pair(prev_index,f_indices[(i+1)%3])] =
-            it_fb->second.halfedges[i];
-        }
-      }
-
-      //insert point inside face
-      for(Node_id node_id : node_ids)
-      {
-        CDT_Vertex_handle vh=cdt.insert(nodes.exact_node(node_id));
-        vh->info()=node_id;
-        id_to_CDT_vh.insert(std::make_pair(node_id,vh));
-      }
-
-      std::vector<std::pair<Node_id,Node_id> > constrained_edges;
-
-      // insert constraints that are interior to the triangle (in the case
-      // no edges are collinear in the meshes)
-      insert_constrained_edges(node_ids,cdt,id_to_CDT_vh,constrained_edges);
-
-      // insert constraints between points that are on the boundary
-      // (not a constrained on the triangle boundary)
-      if (it_fb!=face_boundaries.end()) //is f not a triangle ?
-      {
-        for (int i=0;i<3;++i)
-        {
-          Node_ids& ids=it_fb->second.node_ids_array[i];
-          insert_constrained_edges(ids,cdt,id_to_CDT_vh,constrained_edges,1);
-        }
-      }
+      if (!is_prebuilt)
+        build_face_triangulation(ft, node_ids, f_boundary_ptr, tm, vpm, nodes, nb_nodes);
+      CDT& cdt = *ft.cdt;
 
-      //insert coplanar edges for endpoints of triangles
-      for (int i=0;i<3;++i){
-        Node_id nindex=triangle_vertices[i]->info();
-        if ( nindex < nb_nodes )
-          insert_constrained_edges_coplanar_case(nindex,cdt,id_to_CDT_vh);
-      }
+      set_temporary_vertices_for_retriangulation(ft, node_id_to_vertex, nb_nodes);
 
       //XSL_TAG_CPL_VERT
       //collect edges incident to a point that is the intersection of two
@@ -25,12 +25,20 @@
 #include <CGAL/Polygon_mesh_processing/internal/Corefinement/intersect_triangle_and_segment_3.h>
 #include <CGAL/Polygon_mesh_processing/Non_manifold_feature_map.h>
 #include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/for_each.h>
+#include <CGAL/iterator.h>
+#include <CGAL/tags.h>
 #include <CGAL/utility.h>
 
 #include <boost/dynamic_bitset.hpp>
 #include <boost/container/flat_set.hpp>
 #include <boost/functional/hash.hpp>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/concurrent_vector.h>
+#endif
+
+#include <algorithm>
 #include <stdexcept>
 #include <unordered_map>
 #include <unordered_set>
@@ -194,10 +202,16 @@ struct Node_id_set {
 
 template< class TriangleMesh,
           class VertexPointMap1, class VertexPointMap2,
-          class Node_visitor=Default_surface_intersection_visitor<TriangleMesh>
+          class Node_visitor=Default_surface_intersection_visitor<TriangleMesh>,
+          class ConcurrencyTag=Sequential_tag
          >
 class Intersection_of_triangle_meshes
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   typedef boost::graph_traits<TriangleMesh> graph_traits;
   typedef typename graph_traits::face_descriptor face_descriptor;
   typedef typename graph_traits::edge_descriptor edge_descriptor;
@@ -242,6 +256,41 @@ class Intersection_of_triangle_meshes
   CGAL_assertion_code(bool doing_autorefinement;)
 
 // member functions
+  // reports to `callback` the pairs of intersecting boxes. When running
+  // concurrently, the pairs are collected concurrently and then reported
+  // sequentially as callbacks update the data members.
+  template <class Callback>
+  void report_box_intersections(std::vector<Box*>& face_boxes_ptr,
+                                std::vector<Box*>& edge_boxes_ptr,
+                                Callback callback,
+                                std::ptrdiff_t cutoff)
+  {
+#ifdef CGAL_LINKED_WITH_TBB
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      typedef std::pair<const Box*, const Box*> Box_pair;
+      tbb::concurrent_vector<Box_pair> concurrent_box_pairs;
+      auto collect = [&concurrent_box_pairs](const Box* fb, const Box* eb)
+      {
+        concurrent_box_pairs.emplace_back(fb, eb);
+      };
+      CGAL::box_intersection_d<ConcurrencyTag>(face_boxes_ptr.begin(), face_boxes_ptr.end(),
+                                               edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
+                                               collect, cutoff);
+
+      // boxes are stored in vectors, sorting the pairs makes the order deterministic
+      std::vector<Box_pair> box_pairs(concurrent_box_pairs.begin(), concurrent_box_pairs.end());
+      std::sort(box_pairs.begin(), box_pairs.end());
+      for (const Box_pair& bp : box_pairs)
+        callback(bp.first, bp.second);
+      return;
+    }
+#endif
+    CGAL::box_intersection_d(face_boxes_ptr.begin(), face_boxes_ptr.end(),
+                             edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
+                             callback, cutoff);
+  }
+
   template <class VPMF, class VPME>
   void filter_intersections(const TriangleMesh& tm_f,
                             const TriangleMesh& tm_e,
@@ -350,9 +399,7 @@ class Intersection_of_triangle_meshes
           if (!callback.is_face_degenerated(fb->info()))
             callback(fb, eb);
         };
-        CGAL::box_intersection_d( face_boxes_ptr.begin(), face_boxes_ptr.end(),
-                                  edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
-                                  filtered_callback, cutoff );
+        report_box_intersections(face_boxes_ptr, edge_boxes_ptr, filtered_callback, cutoff);
       }
       else
       {
@@ -388,14 +435,10 @@ class Intersection_of_triangle_meshes
               }
             }
           };
-          CGAL::box_intersection_d( face_boxes_ptr.begin(), face_boxes_ptr.end(),
-                                    edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
-                                    filtered_callback, cutoff );
+          report_box_intersections(face_boxes_ptr, edge_boxes_ptr, filtered_callback, cutoff);
         }
         else
-          CGAL::box_intersection_d( face_boxes_ptr.begin(), face_boxes_ptr.end(),
-                                    edge_boxes_ptr.begin(), edge_boxes_ptr.end(),
-                                    callback, cutoff );
+          report_box_intersections(face_boxes_ptr, edge_boxes_ptr, callback, cutoff);
       }
     }
   }
@@ -946,8 +989,43 @@ class Intersection_of_triangle_meshes
 
     visitor.start_handling_edge_face_intersections(tm1_edge_to_tm2_faces.size());
 
+    // When running concurrently, the intersection types of all the pairs (edge, face)
+    // are computed beforehand, the loop below only removing some of these pairs.
+    std::vector<std::unordered_map<face_descriptor, Inter_type> > precomputed_types;
+    if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
+    {
+      std::vector<std::size_t> pair_edge_ranks;
+      std::vector<halfedge_descriptor> pair_halfedges;
+      std::vector<face_descriptor> pair_faces;
+      std::size_t edge_rank = 0;
+      for(typename Edge_to_faces::iterator it=tm1_edge_to_tm2_faces.begin();
+                                           it!=tm1_edge_to_tm2_faces.end();++it, ++edge_rank)
+      {
+        for(face_descriptor f_2 : it->second)
+        {
+          pair_edge_ranks.push_back(edge_rank);
+          pair_halfedges.push_back(halfedge(it->first,tm1));
+          pair_faces.push_back(f_2);
+        }
+      }
+
+      std::vector<Inter_type> pair_types(pair_faces.size());
+      CGAL::for_each<ConcurrencyTag>(
+        CGAL::make_counting_range<std::size_t>(0, pair_faces.size()),
+        [&](const std::size_t i) -> bool
+        {
+          pair_types[i] = intersection_type(pair_halfedges[i],pair_faces[i],tm1,tm2,vpm1,vpm2);
+          return true;
+        });
+
+      precomputed_types.resize(edge_rank);
+      for (std::size_t i=0; i<pair_faces.size(); ++i)
+        precomputed_types[pair_edge_ranks[i]].emplace(pair_faces[i], pair_types[i]);
+    }
+
+    std::size_t edge_rank = 0;
     for(typename Edge_to_faces::iterator it=tm1_edge_to_tm2_faces.begin();
-                                         it!=tm1_edge_to_tm2_faces.end();++it)
+                                         it!=tm1_edge_to_tm2_faces.end();++it, ++edge_rank)
     {
       visitor.edge_face_intersections_step();
       edge_descriptor e_1=it->first;
@@ -957,7 +1035,9 @@ class Intersection_of_triangle_meshes
       while (!fset.empty()){
         face_descriptor f_2=*fset.begin();
 
-        Inter_type res=intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2);
+        Inter_type res = precomputed_types.empty()
+                       ? intersection_type(h_1,f_2,tm1,tm2,vpm1,vpm2)
+                       : precomputed_types[edge_rank].find(f_2)->second;
         Intersection_type type=std::get<0>(res);
 
     //handle degenerate case: one extremity of edge belong to f_2
@@ -22,7 +22,13 @@
 #endif
 #include <CGAL/boost/graph/iterator.h>
 #include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/bounding_box.h>
+#include <CGAL/for_each.h>
 #include <CGAL/use.h>
+
+#include <array>
+#include <limits>
+#include <map>
 #include <vector>
 
 namespace CGAL {
@@ -94,39 +100,26 @@ struct Tracer_polyhedron
   std::vector<halfedge_descriptor>& P;
 };
 
-// This function is used in test cases (since it returns not just OutputIterator but also Weight)
-template<class PolygonMesh, class OutputIterator, class VertexPointMap, class Kernel, class Visitor>
-std::pair<OutputIterator, CGAL::internal::Weight_min_max_dihedral_and_area>
-triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
-            typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
-            OutputIterator out,
-            VertexPointMap vpmap,
-            bool use_delaunay_triangulation,
-            const Kernel& k,
-            const bool use_cdt,
-            const bool skip_cubic_algorithm,
-            Visitor& visitor,
-            const typename Kernel::FT max_squared_distance)
+// Collects the points of the hole incident to `border_halfedge` (`P`), the third points of the
+// triangles incident to its border edges (`Q`), its border halfedges (`P_edges`), and the edges
+// joining two non-consecutive vertices of its boundary (`existing_edges`).
+// Returns `false` if a non-manifold vertex is found on the boundary.
+template<class PolygonMesh, class VertexPointMap, class Point_3>
+bool
+collect_hole_boundary(const PolygonMesh& pmesh,
+                      typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
+                      VertexPointMap vpmap,
+                      std::vector<Point_3>& P,
+                      std::vector<Point_3>& Q,
+                      std::vector<typename boost::graph_traits<PolygonMesh>::halfedge_descriptor>& P_edges,
+                      std::vector<std::pair<int, int> >& existing_edges)
 {
-#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
-  CGAL_USE(use_cdt);
-  CGAL_USE(max_squared_distance);
-#endif
-
   typedef Halfedge_around_face_circulator<PolygonMesh>   Hedge_around_face_circulator;
   typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor vertex_descriptor;
-  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
-  typedef typename Kernel::Point_3 Point_3;
 
   typedef std::map<vertex_descriptor, int>    Vertex_map;
   typedef typename Vertex_map::iterator       Vertex_map_it;
 
-#ifdef CGAL_PMP_HOLE_FILLING_DEBUG
-  CGAL::Timer timer; timer.start();
-#endif
-
-  std::vector<Point_3> P, Q;
-  std::vector<halfedge_descriptor> P_edges;
   Vertex_map vertex_map;
 
   int id = 0;
@@ -143,14 +136,13 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
 #else
       std::cerr << "W: Returning no output. Non-manifold vertex is found on boundary!\n";
 #endif
-      return std::make_pair(out, CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID());
+      return false;
     }
   } while (++circ != done);
 
   // existing_edges contains neighborhood information between boundary vertices
   // more precisely if v_i is neighbor to any other vertex than v_(i-1) and v_(i+1),
   // this edge is put into existing_edges
-  std::vector<std::pair<int, int> > existing_edges;
   for(Vertex_map_it v_it = vertex_map.begin(); v_it != vertex_map.end(); ++v_it)
   {
     int v_it_id = v_it->second;
@@ -178,6 +170,31 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
     } while(++circ_vertex != done_vertex);
   }
 
+  return true;
+}
+
+// Triangulates the hole described by `P`, `Q` and `existing_edges` (see `collect_hole_boundary()`),
+// passing the result to `tracer`. Holes with more than `large_hole_threshold` vertices are first
+// filled using `triangulate_large_hole_polyline()`.
+template<class Point_3, class Tracer, class Kernel, class Visitor>
+CGAL::internal::Weight_min_max_dihedral_and_area
+triangulate_hole_boundary(const std::vector<Point_3>& P,
+                          const std::vector<Point_3>& Q,
+                          std::vector<std::pair<int, int> >& existing_edges,
+                          Tracer& tracer,
+                          bool use_delaunay_triangulation,
+                          const Kernel& k,
+                          const bool use_cdt,
+                          const bool skip_cubic_algorithm,
+                          Visitor& visitor,
+                          const typename Kernel::FT max_squared_distance,
+                          const std::size_t large_hole_threshold)
+{
+#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
+  CGAL_USE(use_cdt);
+  CGAL_USE(max_squared_distance);
+#endif
+
 //#define CGAL_USE_WEIGHT_INCOMPLETE
 #ifdef CGAL_USE_WEIGHT_INCOMPLETE
   typedef CGAL::internal::Weight_calculator<CGAL::internal::Weight_incomplete<CGAL::internal::Weight_min_max_dihedral_and_area>,
@@ -187,14 +204,17 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
         CGAL::internal::Is_valid_existing_edges_and_degenerate_triangle> WC;
 #endif
 
-  CGAL::internal::Is_valid_existing_edges_and_degenerate_triangle is_valid(existing_edges);
+  if(P.size() > large_hole_threshold &&
+     triangulate_large_hole_polyline(P, Q, existing_edges, tracer, visitor,
+                                     use_delaunay_triangulation, skip_cubic_algorithm,
+                                     large_hole_threshold, k))
+    return CGAL::internal::Weight_min_max_dihedral_and_area(0,0);
 
-  // fill hole using polyline function, with custom tracer for PolygonMesh
-  Tracer_polyhedron<PolygonMesh, OutputIterator> tracer(out, pmesh, P_edges);
+  CGAL::internal::Is_valid_existing_edges_and_degenerate_triangle is_valid(existing_edges);
 
 #ifndef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
   if(use_cdt && triangulate_hole_polyline_with_cdt(P, tracer, visitor, is_valid, k, max_squared_distance))
-    return std::make_pair(tracer.out, CGAL::internal::Weight_min_max_dihedral_and_area(0,0));
+    return CGAL::internal::Weight_min_max_dihedral_and_area(0,0);
 #endif
   CGAL::internal::Weight_min_max_dihedral_and_area weight =
 #ifndef CGAL_USE_WEIGHT_INCOMPLETE
@@ -204,6 +224,45 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
   triangulate_hole_polyline(P, Q, tracer, WC(is_valid), visitor, use_delaunay_triangulation, skip_cubic_algorithm, k).weight;
 #endif
 
+  return weight;
+}
+
+// This function is used in test cases (since it returns not just OutputIterator but also Weight)
+template<class PolygonMesh, class OutputIterator, class VertexPointMap, class Kernel, class Visitor>
+std::pair<OutputIterator, CGAL::internal::Weight_min_max_dihedral_and_area>
+triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
+            typename boost::graph_traits<PolygonMesh>::halfedge_descriptor border_halfedge,
+            OutputIterator out,
+            VertexPointMap vpmap,
+            bool use_delaunay_triangulation,
+            const Kernel& k,
+            const bool use_cdt,
+            const bool skip_cubic_algorithm,
+            Visitor& visitor,
+            const typename Kernel::FT max_squared_distance,
+            const std::size_t large_hole_threshold = (std::numeric_limits<std::size_t>::max)())
+{
+  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
+  typedef typename Kernel::Point_3 Point_3;
+
+#ifdef CGAL_PMP_HOLE_FILLING_DEBUG
+  CGAL::Timer timer; timer.start();
+#endif
+
+  std::vector<Point_3> P, Q;
+  std::vector<halfedge_descriptor> P_edges;
+  std::vector<std::pair<int, int> > existing_edges;
+  if(!collect_hole_boundary(pmesh, border_halfedge, vpmap, P, Q, P_edges, existing_edges))
+    return std::make_pair(out, CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID());
+
+  // fill hole using polyline function, with custom tracer for PolygonMesh
+  Tracer_polyhedron<PolygonMesh, OutputIterator> tracer(out, pmesh, P_edges);
+
+  CGAL::internal::Weight_min_max_dihedral_and_area weight =
+    triangulate_hole_boundary(P, Q, existing_edges, tracer, use_delaunay_triangulation, k,
+                              use_cdt, skip_cubic_algorithm, visitor, max_squared_distance,
+                              large_hole_threshold);
+
 #ifdef CGAL_PMP_HOLE_FILLING_DEBUG
   std::cerr << "Hole filling: " << timer.time() << " sc." << std::endl; timer.reset();
 #endif
@@ -211,6 +270,120 @@ triangulate_hole_polygon_mesh(PolygonMesh& pmesh,
   return std::make_pair(tracer.out, weight);
 }
 
+// Triangulates the holes incident to the halfedges of `border_halfedges`. The triangulations
+// of the holes are computed independently (in parallel if `ConcurrencyTag` is `Parallel_tag`),
+// and the faces are then added to `pmesh` sequentially. If a triangulation would create an edge
+// that was added while filling another hole (which is possible only if the holes share vertices),
+// the hole is triangulated again. Returns the number of holes filled.
+// If `threshold_distance` is negative, the default threshold for using the 2D constrained
+// Delaunay triangulation (one quarter of the height of the bounding box of the hole) is used.
+// A default constructed `Visitor` is used for each hole.
+template<class ConcurrencyTag, class Visitor, class PolygonMesh, class OutputIterator, class VertexPointMap, class Kernel>
+std::size_t
+triangulate_holes_polygon_mesh(PolygonMesh& pmesh,
+            const std::vector<typename boost::graph_traits<PolygonMesh>::halfedge_descriptor>& border_halfedges,
+            OutputIterator& out,
+            VertexPointMap vpmap,
+            bool use_delaunay_triangulation,
+            const Kernel& k,
+            const bool use_cdt,
+            const bool skip_cubic_algorithm,
+            const typename Kernel::FT threshold_distance,
+            const std::size_t large_hole_threshold)
+{
+  typedef typename boost::graph_traits<PolygonMesh>::vertex_descriptor vertex_descriptor;
+  typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
+  typedef typename Kernel::FT FT;
+  typedef typename Kernel::Point_3 Point_3;
+
+  struct Hole
+  {
+    std::vector<halfedge_descriptor> P_edges;
+    CGAL::internal::Tracer_triangle_recorder recorder;
+    FT max_squared_distance;
+    bool valid;
+  };
+
+  auto compute_max_squared_distance = [&](const std::vector<Point_3>& P)
+  {
+    if(threshold_distance >= FT(0))
+      return FT(threshold_distance * threshold_distance);
+    const typename Kernel::Iso_cuboid_3 bbox = CGAL::bounding_box(P.begin(), P.end());
+    return FT(CGAL::abs(CGAL::squared_distance(bbox.vertex(0), bbox.vertex(5))) / FT(16));
+  };
+
+  // compute the triangulations of the holes, without modifying the mesh
+  const std::size_t nb_holes = border_halfedges.size();
+  std::vector<Hole> holes(nb_holes);
+  CGAL::for_each<ConcurrencyTag>(
+    CGAL::make_counting_range<std::size_t>(0, nb_holes),
+    [&](const std::size_t hi) -> bool
+    {
+      Hole& hole = holes[hi];
+      std::vector<Point_3> P, Q;
+      std::vector<std::pair<int, int> > existing_edges;
+      hole.valid = collect_hole_boundary(pmesh, border_halfedges[hi], vpmap, P, Q, hole.P_edges, existing_edges);
+      if(!hole.valid)
+        return true;
+
+      hole.max_squared_distance = use_cdt ? compute_max_squared_distance(P) : FT(-1);
+      Visitor visitor;
+      hole.valid = triangulate_hole_boundary(P, Q, existing_edges, hole.recorder, use_delaunay_triangulation, k,
+                                             use_cdt, skip_cubic_algorithm, visitor, hole.max_squared_distance,
+                                             large_hole_threshold)
+                     != CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID();
+      return true;
+    });
+
+  // add the faces to the mesh
+  std::size_t nb_filled = 0;
+  for(Hole& hole : holes)
+  {
+    if(!hole.valid)
+      continue;
+
+    const int n = static_cast<int>(hole.P_edges.size());
+    auto vertex_of = [&](int i) -> vertex_descriptor { return target(hole.P_edges[i], pmesh); };
+    auto is_new_edge = [&](int i, int j)
+    {
+      return j == i + 1 || (i == 0 && j == n - 1) || !halfedge(vertex_of(i), vertex_of(j), pmesh).second;
+    };
+
+    bool conflict = false;
+    CGAL::internal::Lookup_table_map<int> lambda(n, -1);
+    for(const std::array<int, 3>& t : hole.recorder.triangles)
+    {
+      if(!is_new_edge(t[0], t[1]) || !is_new_edge(t[1], t[2]) || !is_new_edge(t[0], t[2]))
+      {
+        conflict = true;
+        break;
+      }
+      lambda.put(t[0], t[2], t[1]);
+    }
+
+    if(conflict)
+    {
+      Visitor visitor;
+      std::pair<OutputIterator, CGAL::internal::Weight_min_max_dihedral_and_area> res =
+        triangulate_hole_polygon_mesh(pmesh, hole.P_edges.front(), out, vpmap, use_delaunay_triangulation, k,
+                                      use_cdt, skip_cubic_algorithm, visitor, hole.max_squared_distance,
+                                      large_hole_threshold);
+      out = res.first;
+      if(res.second == CGAL::internal::Weight_min_max_dihedral_and_area::NOT_VALID())
+        continue;
+    }
+    else
+    {
+      Tracer_polyhedron<PolygonMesh, OutputIterator> tracer(out, pmesh, hole.P_edges);
+      tracer(lambda, 0, n - 1);
+      out = tracer.out;
+    }
+    ++nb_filled;
+  }
+
+  return nb_filled;
+}
+
 } // namespace internal
 } // namespace Polygon_mesh_processing
 } // namespace CGAL
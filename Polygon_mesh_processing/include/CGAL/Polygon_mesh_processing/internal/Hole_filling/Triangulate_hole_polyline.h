@@ -44,6 +44,9 @@
 #include <CGAL/Kernel/global_functions_3.h>
 #include <CGAL/squared_distance_3.h>
 
+#include <algorithm>
+#include <array>
+#include <limits>
 #include <vector>
 #include <stack>
 #include <map>
@@ -1589,6 +1592,192 @@ triangulate_hole_polyline(const PointRange1& points,
   return w;
 }
 
+/*******************************************************************************
+ * Triangulation of large holes
+ ***********************************************************************************/
+// Records the triangles (as indices in the polyline) described by a lookup table.
+struct Tracer_triangle_recorder
+{
+  template <class LookupTable>
+  void operator()(const LookupTable& lambda, int i, int k, bool = true)
+  {
+    if(i + 1 >= k) { return; }
+    int la = (i + 2 == k) ? i + 1 : lambda.get(i, k);
+    triangles.push_back(CGAL::make_array(i, la, k));
+    operator()(lambda, i, la, false);
+    operator()(lambda, la, k, false);
+  }
+
+  std::vector<std::array<int, 3> > triangles;
+};
+
+// Triangulates a hole with many vertices by recursively splitting it along the shortest diagonal
+// joining two vertices at half the boundary length, until the sub-holes have at most
+// `max_sub_hole_size` vertices. Each sub-hole is then filled using `triangulate_hole_polyline()`.
+// `P` and `Q` are not closed, and `existing_edges` are the pairs of boundary vertices already
+// joined by an edge. Returns `false` if a sub-hole could not be split or filled, in which case
+// `tracer` is not called.
+template <
+  typename Tracer,
+  typename Visitor,
+  typename Kernel
+>
+bool
+triangulate_hole_polyline_by_splitting(const std::vector<typename Kernel::Point_3>& P,
+                                       const std::vector<typename Kernel::Point_3>& Q,
+                                       const std::vector<std::pair<int, int> >& existing_edges,
+                                       Tracer& tracer,
+                                       Visitor& visitor,
+                                       bool use_delaunay_triangulation,
+                                       bool skip_cubic_algorithm,
+                                       std::size_t max_sub_hole_size,
+                                       const Kernel& k)
+{
+  typedef typename Kernel::Point_3 Point_3;
+  typedef Weight_calculator<Weight_min_max_dihedral_and_area,
+                            Is_valid_existing_edges_and_degenerate_triangle> WC;
+  typedef std::pair<int, int> Edge;
+
+  const int n = static_cast<int>(P.size());
+  CGAL_assertion(n >= 3);
+  max_sub_hole_size = (std::max)(max_sub_hole_size, std::size_t(3));
+
+  std::vector<std::vector<int> > existing_neighbors(n);
+  for(const Edge& e : existing_edges)
+  {
+    existing_neighbors[e.first].push_back(e.second);
+    existing_neighbors[e.second].push_back(e.first);
+  }
+  auto is_existing_edge = [&](int a, int b)
+  {
+    return std::find(existing_neighbors[a].begin(), existing_neighbors[a].end(), b) != existing_neighbors[a].end();
+  };
+
+  // the third point used for the dihedral angle of the diagonals, once these are boundary edges of sub-holes
+  std::map<Edge, int> diagonal_third_points;
+  typename Kernel::Compute_squared_distance_3 squared_distance = k.compute_squared_distance_3_object();
+
+  Lookup_table_map<int> lambda(n, -1);
+  std::vector<int> position(n, -1);
+
+  std::vector<std::vector<int> > sub_holes(1);
+  sub_holes[0].reserve(n);
+  for(int i = 0; i < n; ++i) { sub_holes[0].push_back(i); }
+
+  while(!sub_holes.empty())
+  {
+    std::vector<int> S;
+    S.swap(sub_holes.back());
+    sub_holes.pop_back();
+    const int s = static_cast<int>(S.size());
+
+    if(static_cast<std::size_t>(s) > max_sub_hole_size)
+    {
+      // split along the shortest diagonal between vertices at half the boundary length
+      const int half = s / 2;
+      int best = -1;
+      double best_sq_length = (std::numeric_limits<double>::max)();
+      for(int t = 0; t < s - half; ++t)
+      {
+        const int a = S[t], b = S[t + half];
+        if(is_existing_edge(a, b) || P[a] == P[b]) { continue; }
+        const double sq_length = to_double(squared_distance(P[a], P[b]));
+        if(sq_length < best_sq_length)
+        {
+          best_sq_length = sq_length;
+          best = t;
+        }
+      }
+      if(best == -1) { return false; }
+
+      const int u = best + half;
+      std::vector<int> S1(S.begin() + best, S.begin() + u + 1);
+      std::vector<int> S2(S.begin() + u, S.end());
+      S2.insert(S2.end(), S.begin(), S.begin() + best + 1);
+
+      diagonal_third_points[Edge(S1.back(), S1.front())] = S2[S2.size() / 2];
+      diagonal_third_points[Edge(S2.back(), S2.front())] = S1[S1.size() / 2];
+      sub_holes.push_back(std::move(S1));
+      sub_holes.push_back(std::move(S2));
+      continue;
+    }
+
+    // fill the sub-hole
+    std::vector<Point_3> P_sub, Q_sub;
+    P_sub.reserve(s);
+    for(int j = 0; j < s; ++j)
+    {
+      position[S[j]] = j;
+      P_sub.push_back(P[S[j]]);
+    }
+    if(!Q.empty())
+    {
+      Q_sub.reserve(s);
+      for(int j = 0; j < s; ++j)
+      {
+        const int a = S[j], b = S[(j + 1) % s];
+        if(b == (a + 1) % n) { Q_sub.push_back(Q[a]); }
+        else { Q_sub.push_back(P[diagonal_third_points[Edge(a, b)]]); }
+      }
+    }
+
+    std::vector<Edge> existing_edges_sub;
+    for(int j = 0; j < s; ++j)
+      for(int nb : existing_neighbors[S[j]])
+        if(position[nb] > j) { existing_edges_sub.push_back(Edge(j, position[nb])); }
+
+    Tracer_triangle_recorder recorder;
+    Is_valid_existing_edges_and_degenerate_triangle is_valid_sub(existing_edges_sub);
+    const Weight_min_max_dihedral_and_area w =
+      triangulate_hole_polyline(P_sub, Q_sub, recorder, WC(is_valid_sub), visitor,
+                                use_delaunay_triangulation, skip_cubic_algorithm, k);
+    for(int j = 0; j < s; ++j) { position[S[j]] = -1; }
+    if(w == Weight_min_max_dihedral_and_area::NOT_VALID()) { return false; }
+
+    for(const std::array<int, 3>& t : recorder.triangles)
+    {
+      std::array<int, 3> is = CGAL::make_array(S[t[0]], S[t[1]], S[t[2]]);
+      std::sort(is.begin(), is.end());
+      lambda.put(is[0], is[2], is[1]);
+    }
+  }
+
+  tracer(lambda, 0, n - 1);
+  return true;
+}
+
+// Triangulates a hole with many vertices in a near-linear time. The hole is triangulated in
+// the plane fitting its boundary if the projection of the boundary onto this plane is simple
+// (whatever the planarity of the boundary is), and using `triangulate_hole_polyline_by_splitting()`
+// otherwise. `P` and `Q` are not closed.
+template <
+  typename Tracer,
+  typename Visitor,
+  typename Kernel
+>
+bool
+triangulate_large_hole_polyline(const std::vector<typename Kernel::Point_3>& P,
+                                const std::vector<typename Kernel::Point_3>& Q,
+                                std::vector<std::pair<int, int> >& existing_edges,
+                                Tracer& tracer,
+                                Visitor& visitor,
+                                bool use_delaunay_triangulation,
+                                bool skip_cubic_algorithm,
+                                std::size_t max_sub_hole_size,
+                                const Kernel& k)
+{
+#ifndef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
+  Is_valid_existing_edges_and_degenerate_triangle is_valid(existing_edges);
+  if(triangulate_hole_polyline_with_cdt(P, tracer, visitor, is_valid, k,
+                                        typename Kernel::FT((std::numeric_limits<double>::max)())))
+    return true;
+#endif
+
+  return triangulate_hole_polyline_by_splitting(P, Q, existing_edges, tracer, visitor,
+                                                use_delaunay_triangulation, skip_cubic_algorithm,
+                                                max_sub_hole_size, k);
+}
+
 } // namespace internal
 
 } // namespace CGAL
@@ -30,6 +30,7 @@
 
 #include <CGAL/property_map.h>
 #include <CGAL/Dynamic_property_map.h>
+#include <CGAL/for_each.h>
 #include <CGAL/iterator.h>
 #include <CGAL/boost/graph/Euler_operations.h>
 #include <CGAL/boost/graph/properties.h>
@@ -262,9 +263,15 @@ namespace internal {
          , typename VertexIsConstrainedMap
          , typename FacePatchMap
          , typename FaceIndexMap
+         , typename ConcurrencyTag = Sequential_tag
   >
   class Incremental_remesher
   {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     typedef PolygonMesh PM;
     typedef typename boost::graph_traits<PM>::halfedge_descriptor halfedge_descriptor;
     typedef typename boost::graph_traits<PM>::edge_descriptor     edge_descriptor;
@@ -282,6 +289,7 @@ namespace internal {
                                , VertexIsConstrainedMap
                                , FacePatchMap
                                , FaceIndexMap
+                               , ConcurrencyTag
                                > Self;
 
   private:
@@ -297,6 +305,8 @@ namespace internal {
 
     typedef typename boost::property_map<
       PM, CGAL::dynamic_halfedge_property_t<Halfedge_status> >::type Halfedge_status_pmap;
+    typedef typename boost::property_map<
+      PM, CGAL::dynamic_vertex_property_t<int> >::type Vertex_degree;
 
   public:
     Incremental_remesher(PolygonMesh& pmesh
@@ -320,6 +330,7 @@ namespace internal {
       , ecmap_(ecmap)
       , vcmap_(vcmap)
       , fimap_(fimap)
+      , in_concurrent_section_(false)
     {
       halfedge_status_pmap_ = get(CGAL::dynamic_halfedge_property_t<Halfedge_status>(),
                                   pmesh);
@@ -495,14 +506,24 @@ namespace internal {
         { return p1.second > p2.second; }
       );
 
-      for(edge_descriptor e : edges(mesh_))
+      const std::vector<edge_descriptor> all_edges(edges(mesh_).begin(), edges(mesh_).end());
+      std::vector<std::optional<double> > sqlengths(all_edges.size());
+      CGAL::for_each<ConcurrencyTag>(
+        CGAL::make_counting_range<std::size_t>(0, all_edges.size()),
+        [&](const std::size_t i) -> bool
+        {
+          const edge_descriptor e = all_edges[i];
+          if (is_split_allowed(e))
+          {
+            const halfedge_descriptor he = halfedge(e, mesh_);
+            sqlengths[i] = sizing.is_too_long(source(he, mesh_), target(he, mesh_), mesh_);
+          }
+          return true;
+        });
+      for(std::size_t i = 0; i < all_edges.size(); ++i)
       {
-        if (!is_split_allowed(e))
-          continue;
-        const halfedge_descriptor he = halfedge(e, mesh_);
-        std::optional<double> sqlen = sizing.is_too_long(source(he, mesh_), target(he, mesh_), mesh_);
-        if(sqlen != std::nullopt)
-          long_edges.emplace(halfedge(e, mesh_), sqlen.value());
+        if(sqlengths[i] != std::nullopt)
+          long_edges.emplace(halfedge(all_edges[i], mesh_), sqlengths[i].value());
       }
 
       //split long edges
@@ -646,12 +667,25 @@ namespace internal {
 #endif
 
       Boost_bimap short_edges;
-      for(edge_descriptor e : edges(mesh_))
+      const std::vector<edge_descriptor> all_edges(edges(mesh_).begin(), edges(mesh_).end());
+      std::vector<std::optional<double> > sqlengths(all_edges.size());
+      in_concurrent_section_ = std::is_convertible<ConcurrencyTag, Parallel_tag>::value;
+      CGAL::for_each<ConcurrencyTag>(
+        CGAL::make_counting_range<std::size_t>(0, all_edges.size()),
+        [&](const std::size_t i) -> bool
+        {
+          const edge_descriptor e = all_edges[i];
+          std::optional<double> sqlen = sizing.is_too_short(halfedge(e, mesh_), mesh_);
+          if(sqlen != std::nullopt
+            && is_collapse_allowed(e, collapse_constraints))
+            sqlengths[i] = sqlen;
+          return true;
+        });
+      in_concurrent_section_ = false;
+      for(std::size_t i = 0; i < all_edges.size(); ++i)
       {
-        std::optional<double> sqlen = sizing.is_too_short(halfedge(e, mesh_), mesh_);
-        if(sqlen != std::nullopt
-          && is_collapse_allowed(e, collapse_constraints))
-          short_edges.insert(short_edge(halfedge(e, mesh_), sqlen.value()));
+        if(sqlengths[i] != std::nullopt)
+          short_edges.insert(short_edge(halfedge(all_edges[i], mesh_), sqlengths[i].value()));
       }
 #ifdef CGAL_PMP_REMESHING_VERBOSE_PROGRESS
       std::cout << "done." << std::endl;
@@ -848,7 +882,6 @@ namespace internal {
       std::cout << "Equalize valences..." << std::endl;
 #endif
 
-      typedef typename boost::property_map<PM, CGAL::dynamic_vertex_property_t<int> >::type Vertex_degree;
       Vertex_degree degree = get(CGAL::dynamic_vertex_property_t<int>(), mesh_);
 
       for(vertex_descriptor v : vertices(mesh_)){
@@ -860,154 +893,263 @@ namespace internal {
         put(degree, t, get(degree,t)+1);
       }
 
-      const double cap_threshold = std::cos(160. / 180 * CGAL_PI);
-
 #ifdef CGAL_PMP_REMESHING_VERBOSE
       unsigned int nb_flips = 0;
 #endif
-      for(edge_descriptor e : edges(mesh_))
+
+      if (std::is_convertible<ConcurrencyTag, Parallel_tag>::value)
       {
-        //only the patch edges are allowed to be flipped
-        if (!is_flip_allowed(e))
-          continue;
-        //add geometric test to avoid axe cuts
-        if (!internal::should_flip(e, mesh_, vpmap_, gt_))
-          continue;
+#ifdef CGAL_PMP_REMESHING_VERBOSE
+        nb_flips =
+#endif
+        flip_edges_in_independent_batches(degree);
+      }
+      else
+      {
+        for(edge_descriptor e : edges(mesh_))
+        {
+          //only the patch edges are allowed to be flipped
+          if (!is_flip_allowed(e))
+            continue;
+          //add geometric test to avoid axe cuts
+          if (!internal::should_flip(e, mesh_, vpmap_, gt_))
+            continue;
+
+          halfedge_descriptor he = halfedge(e, mesh_);
+#ifdef CGAL_PMP_REMESHING_VERBOSE
+          if (flip_for_valence_and_shape(he, degree))
+            ++nb_flips;
+#else
+          flip_for_valence_and_shape(he, degree);
+#endif
+#ifdef CGAL_PMP_REMESHING_VERBOSE_PROGRESS
+          std::cout << "\r\t(" << nb_flips << " flips)";
+          std::cout.flush();
+#endif
+
+          Patch_id pid = get_patch_id(face(he, mesh_));
+          set_patch_id(face(he, mesh_), pid);
+          set_patch_id(face(opposite(he, mesh_), mesh_), pid);
+        }
+      }
 
-        halfedge_descriptor he = halfedge(e, mesh_);
+#ifdef CGAL_PMP_REMESHING_VERBOSE
+      std::cout << "\r\tdone ("<< nb_flips << " flips)" << std::endl;
+#endif
+
+#ifdef CGAL_PMP_REMESHING_DEBUG
+      debug_status_map();
+      CGAL_assertion(remove_degenerate_faces(mesh_, parameters::vertex_point_map(vpmap_).geom_traits(gt_)));
+      debug_self_intersections();
+#endif
 
-        std::array<halfedge_descriptor, 2> r1 = internal::is_badly_shaped(
-            face(he, mesh_),
-            mesh_, vpmap_, vcmap_, ecmap_, gt_,
-            cap_threshold, // bound on the angle: above 160 deg => cap
-            4, // bound on shortest/longest edge above 4 => needle
-            0,// collapse length threshold : not needed here
-            0); // flip triangle height threshold
+#ifdef CGAL_DUMP_REMESHING_STEPS
+      dump("3-edge_flips.off");
+#endif
+    }
 
-        std::array<halfedge_descriptor, 2> r2 = internal::is_badly_shaped(
-            face(opposite(he, mesh_), mesh_),
-            mesh_, vpmap_, vcmap_, ecmap_, gt_, cap_threshold, 4, 0, 0);
+    // flips `he` if it improves the valences of the four vertices of
+    // the two incident faces, or the shape of these faces, and updates
+    // `degree`. Returns `true` if `he` has been flipped.
+    // Only the two faces incident to `he` and the one-rings of their
+    // vertices are read or modified.
+    bool flip_for_valence_and_shape(const halfedge_descriptor he, Vertex_degree& degree)
+    {
+      const double cap_threshold = std::cos(160. / 180 * CGAL_PI);
 
-        const bool badly_shaped = (r1[0] != boost::graph_traits<PolygonMesh>::null_halfedge()//needle
-                                || r1[1] != boost::graph_traits<PolygonMesh>::null_halfedge()//cap
-                                || r2[0] != boost::graph_traits<PolygonMesh>::null_halfedge()//needle
-                                || r2[1] != boost::graph_traits<PolygonMesh>::null_halfedge());//cap
+      std::array<halfedge_descriptor, 2> r1 = internal::is_badly_shaped(
+          face(he, mesh_),
+          mesh_, vpmap_, vcmap_, ecmap_, gt_,
+          cap_threshold, // bound on the angle: above 160 deg => cap
+          4, // bound on shortest/longest edge above 4 => needle
+          0,// collapse length threshold : not needed here
+          0); // flip triangle height threshold
+
+      std::array<halfedge_descriptor, 2> r2 = internal::is_badly_shaped(
+          face(opposite(he, mesh_), mesh_),
+          mesh_, vpmap_, vcmap_, ecmap_, gt_, cap_threshold, 4, 0, 0);
+
+      const bool badly_shaped = (r1[0] != boost::graph_traits<PolygonMesh>::null_halfedge()//needle
+                              || r1[1] != boost::graph_traits<PolygonMesh>::null_halfedge()//cap
+                              || r2[0] != boost::graph_traits<PolygonMesh>::null_halfedge()//needle
+                              || r2[1] != boost::graph_traits<PolygonMesh>::null_halfedge());//cap
+
+      vertex_descriptor va = source(he, mesh_);
+      vertex_descriptor vb = target(he, mesh_);
+      vertex_descriptor vc = target(next(he, mesh_), mesh_);
+      vertex_descriptor vd = target(next(opposite(he, mesh_), mesh_), mesh_);
+
+      int vva = get(degree,va), tvva = target_valence(va);
+      int vvb = get(degree, vb), tvvb = target_valence(vb);
+      int vvc = get(degree,vc), tvvc = target_valence(vc);
+      int vvd = get(degree,vd), tvvd = target_valence(vd);
+
+      int deviation_pre = CGAL::abs(vva - tvva)
+                        + CGAL::abs(vvb - tvvb)
+                        + CGAL::abs(vvc - tvvc)
+                        + CGAL::abs(vvd - tvvd);
+
+      CGAL_assertion_code(Halfedge_status s1 = status(he));
+      CGAL_assertion_code(Halfedge_status s1o = status(opposite(he, mesh_)));
+
+      CGAL_assertion( is_flip_topologically_allowed(edge(he, mesh_)) );
+      CGAL_assertion( !get(ecmap_, edge(he, mesh_)) );
+      CGAL::Euler::flip_edge(he, mesh_);
+
+      if (!badly_shaped)
+      {
+        vva -= 1;
+        vvb -= 1;
+        vvc += 1;
+        vvd += 1;
+      }
 
-        vertex_descriptor va = source(he, mesh_);
-        vertex_descriptor vb = target(he, mesh_);
-        vertex_descriptor vc = target(next(he, mesh_), mesh_);
-        vertex_descriptor vd = target(next(opposite(he, mesh_), mesh_), mesh_);
+      put(degree, va, vva);
+      put(degree, vb, vvb);
+      put(degree, vc, vvc);
+      put(degree, vd, vvd);
 
-        int vva = get(degree,va), tvva = target_valence(va);
-        int vvb = get(degree, vb), tvvb = target_valence(vb);
-        int vvc = get(degree,vc), tvvc = target_valence(vc);
-        int vvd = get(degree,vd), tvvd = target_valence(vd);
+      CGAL_assertion_code(Halfedge_status s2 = status(he));
+      CGAL_assertion_code(Halfedge_status s2o = status(opposite(he, mesh_)));
+      CGAL_assertion(s1 == s2   && s1 == PATCH);
+      CGAL_assertion(s1o == s2o && s1o == PATCH);
+      CGAL_assertion(!is_border(he, mesh_));
 
-        int deviation_pre = CGAL::abs(vva - tvva)
-                          + CGAL::abs(vvb - tvvb)
-                          + CGAL::abs(vvc - tvvc)
-                          + CGAL::abs(vvd - tvvd);
+      CGAL_assertion(
+           (vc == target(he, mesh_) && vd == source(he, mesh_))
+        || (vd == target(he, mesh_) && vc == source(he, mesh_)));
 
-        CGAL_assertion_code(Halfedge_status s1 = status(he));
-        CGAL_assertion_code(Halfedge_status s1o = status(opposite(he, mesh_)));
+      int deviation_post;
+      if(!badly_shaped)
+      {
+        deviation_post = CGAL::abs(vva - tvva)
+                         + CGAL::abs(vvb - tvvb)
+                         + CGAL::abs(vvc - tvvc)
+                         + CGAL::abs(vvd - tvvd);
+      }
 
+      //check that mesh does not become non-triangle,
+      //nor has inverted faces
+      if ((!badly_shaped && deviation_pre <= deviation_post)
+        || !check_normals(he)
+        || incident_to_degenerate(he)
+        || incident_to_degenerate(opposite(he, mesh_))
+        || !is_on_triangle(he)
+        || !is_on_triangle(opposite(he, mesh_))
+        || !check_normals(target(he, mesh_))
+        || !check_normals(source(he, mesh_)))
+      {
         CGAL_assertion( is_flip_topologically_allowed(edge(he, mesh_)) );
         CGAL_assertion( !get(ecmap_, edge(he, mesh_)) );
         CGAL::Euler::flip_edge(he, mesh_);
 
-        if (!badly_shaped)
-        {
-          vva -= 1;
-          vvb -= 1;
-          vvc += 1;
-          vvd += 1;
-        }
+        vva += 1;
+        vvb += 1;
+        vvc -= 1;
+        vvd -= 1;
 
         put(degree, va, vva);
         put(degree, vb, vvb);
         put(degree, vc, vvc);
         put(degree, vd, vvd);
 
-#ifdef CGAL_PMP_REMESHING_VERBOSE
-        ++nb_flips;
-#endif
-#ifdef CGAL_PMP_REMESHING_VERBOSE_PROGRESS
-        std::cout << "\r\t(" << nb_flips << " flips)";
-        std::cout.flush();
-#endif
-        CGAL_assertion_code(Halfedge_status s2 = status(he));
-        CGAL_assertion_code(Halfedge_status s2o = status(opposite(he, mesh_)));
-        CGAL_assertion(s1 == s2   && s1 == PATCH);
-        CGAL_assertion(s1o == s2o && s1o == PATCH);
+        CGAL_assertion_code(Halfedge_status s3 = status(he));
+        CGAL_assertion(s1 == s3);
         CGAL_assertion(!is_border(he, mesh_));
-
         CGAL_assertion(
-             (vc == target(he, mesh_) && vd == source(he, mesh_))
-          || (vd == target(he, mesh_) && vc == source(he, mesh_)));
+             (va == source(he, mesh_) && vb == target(he, mesh_))
+          || (vb == source(he, mesh_) && va == target(he, mesh_)));
+        return false;
+      }
+      return true;
+    }
 
-        int deviation_post;
-        if(!badly_shaped)
-        {
-          deviation_post = CGAL::abs(vva - tvva)
-                           + CGAL::abs(vvb - tvvb)
-                           + CGAL::abs(vvc - tvvc)
-                           + CGAL::abs(vvd - tvvd);
-        }
+    // Concurrent version of the flips: the edges are flipped by batches
+    // in which the one-rings of the vertices of the faces incident to
+    // two edges never share a vertex, so that the edges of a batch can
+    // be flipped independently.
+    unsigned int flip_edges_in_independent_batches(Vertex_degree& degree)
+    {
+      unsigned int nb_flips = 0;
+      typedef typename boost::property_map<PM, CGAL::dynamic_vertex_property_t<bool> >::type Vertex_mark;
+      Vertex_mark marked = get(CGAL::dynamic_vertex_property_t<bool>(), mesh_);
+      for(vertex_descriptor v : vertices(mesh_))
+        put(marked, v, false);
+
+      std::vector<halfedge_descriptor> pending;
+      for(edge_descriptor e : edges(mesh_))
+        if (is_flip_allowed(e))
+          pending.push_back(halfedge(e, mesh_));
 
-        //check that mesh does not become non-triangle,
-        //nor has inverted faces
-        if ((!badly_shaped && deviation_pre <= deviation_post)
-          || !check_normals(he)
-          || incident_to_degenerate(he)
-          || incident_to_degenerate(opposite(he, mesh_))
-          || !is_on_triangle(he)
-          || !is_on_triangle(opposite(he, mesh_))
-          || !check_normals(target(he, mesh_))
-          || !check_normals(source(he, mesh_)))
+      std::vector<halfedge_descriptor> batch, deferred;
+      std::vector<char> flipped;
+      std::vector<vertex_descriptor> closure;
+      while (!pending.empty())
+      {
+        batch.clear();
+        deferred.clear();
+        std::vector<vertex_descriptor> batch_closure;
+        for(const halfedge_descriptor he : pending)
         {
-          CGAL_assertion( is_flip_topologically_allowed(edge(he, mesh_)) );
-          CGAL_assertion( !get(ecmap_, edge(he, mesh_)) );
-          CGAL::Euler::flip_edge(he, mesh_);
+          const edge_descriptor e = edge(he, mesh_);
+          if (!is_flip_allowed(e) || !internal::should_flip(e, mesh_, vpmap_, gt_))
+            continue;
 
-          vva += 1;
-          vvb += 1;
-          vvc -= 1;
-          vvd -= 1;
+          // vertices of the two incident faces and their neighbors
+          closure.clear();
+          for(const vertex_descriptor v : { source(he, mesh_), target(he, mesh_),
+                                            target(next(he, mesh_), mesh_),
+                                            target(next(opposite(he, mesh_), mesh_), mesh_) })
+          {
+            closure.push_back(v);
+            for(halfedge_descriptor h : halfedges_around_target(v, mesh_))
+              closure.push_back(source(h, mesh_));
+          }
 
-          put(degree, va, vva);
-          put(degree, vb, vvb);
-          put(degree, vc, vvc);
-          put(degree, vd, vvd);
+          bool independent = true;
+          for(const vertex_descriptor v : closure)
+            if (get(marked, v))
+            {
+              independent = false;
+              break;
+            }
 
-#ifdef CGAL_PMP_REMESHING_VERBOSE
-          --nb_flips;
-#endif
-          CGAL_assertion_code(Halfedge_status s3 = status(he));
-          CGAL_assertion(s1 == s3);
-          CGAL_assertion(!is_border(he, mesh_));
-          CGAL_assertion(
-               (va == source(he, mesh_) && vb == target(he, mesh_))
-            || (vb == source(he, mesh_) && va == target(he, mesh_)));
-        }
+          if (!independent)
+          {
+            deferred.push_back(he);
+            continue;
+          }
 
-        Patch_id pid = get_patch_id(face(he, mesh_));
-        set_patch_id(face(he, mesh_), pid);
-        set_patch_id(face(opposite(he, mesh_), mesh_), pid);
-      }
+          for(const vertex_descriptor v : closure)
+            put(marked, v, true);
+          batch_closure.insert(batch_closure.end(), closure.begin(), closure.end());
+          batch.push_back(he);
+        }
 
-#ifdef CGAL_PMP_REMESHING_VERBOSE
-      std::cout << "\r\tdone ("<< nb_flips << " flips)" << std::endl;
-#endif
+        flipped.assign(batch.size(), false);
+        CGAL::for_each<ConcurrencyTag>(
+          CGAL::make_counting_range<std::size_t>(0, batch.size()),
+          [&](const std::size_t i) -> bool
+          {
+            flipped[i] = flip_for_valence_and_shape(batch[i], degree);
+            return true;
+          });
 
-#ifdef CGAL_PMP_REMESHING_DEBUG
-      debug_status_map();
-      CGAL_assertion(remove_degenerate_faces(mesh_, parameters::vertex_point_map(vpmap_).geom_traits(gt_)));
-      debug_self_intersections();
-#endif
+        for(std::size_t i = 0; i < batch.size(); ++i)
+        {
+          const halfedge_descriptor he = batch[i];
+          if (flipped[i])
+            ++nb_flips;
+          Patch_id pid = get_patch_id(face(he, mesh_));
+          set_patch_id(face(he, mesh_), pid);
+          set_patch_id(face(opposite(he, mesh_), mesh_), pid);
+        }
+        for(const vertex_descriptor v : batch_closure)
+          put(marked, v, false);
 
-#ifdef CGAL_DUMP_REMESHING_STEPS
-      dump("3-edge_flips.off");
-#endif
+        pending.swap(deferred);
+      }
+      return nb_flips;
     }
 
     // PMP book :
@@ -1065,6 +1207,7 @@ namespace internal {
             .vertex_is_constrained_map(constrained_vertices_pmap)
             .relax_constraints(relax_constraints)
             .allow_move_functor(shall_move)
+            .concurrency_tag(ConcurrencyTag())
         );
       }
       else
@@ -1084,6 +1227,7 @@ namespace internal {
             .relax_constraints(relax_constraints)
             .sizing_function(sizing)
             .allow_move_functor(shall_move)
+            .concurrency_tag(ConcurrencyTag())
         );
       }
 
@@ -1110,15 +1254,26 @@ namespace internal {
       std::cout.flush();
 #endif
 
+      // the patch of each vertex is found sequentially, as the patch map
+      // might not allow concurrent accesses
+      std::vector<std::pair<vertex_descriptor, const AABB_tree*> > to_project;
       for(vertex_descriptor v : vertices(mesh_))
       {
         if (is_constrained(v) || is_isolated(v) || !is_on_patch(v))
           continue;
         //note if v is constrained, it has not moved
 
-        Point proj = trees[patch_id_to_index_map[get_patch_id(face(halfedge(v, mesh_), mesh_))]]->closest_point(get(vpmap_, v));
-        put(vpmap_, v, proj);
+        to_project.emplace_back(v, trees[patch_id_to_index_map[get_patch_id(face(halfedge(v, mesh_), mesh_))]]);
       }
+
+      CGAL::for_each<ConcurrencyTag>(
+        to_project,
+        [&](const std::pair<vertex_descriptor, const AABB_tree*>& vt) -> bool
+        {
+          Point proj = vt.second->closest_point(get(vpmap_, vt.first));
+          put(vpmap_, vt.first, proj);
+          return true;
+        });
       CGAL_assertion(!input_mesh_is_valid_ || is_valid_polygon_mesh(mesh_));
 #ifdef CGAL_PMP_REMESHING_DEBUG
       debug_self_intersections();
@@ -1163,11 +1318,20 @@ namespace internal {
 private:
   Patch_id get_patch_id(const face_descriptor& f) const
   {
+    CGAL_precondition(!in_concurrent_section_);
     if (f == boost::graph_traits<PM>::null_face())
       return Patch_id(-1);
     return get(patch_ids_map_, f);
   }
 
+  // The patch map might not allow concurrent accesses (the default one
+  // may insert on read), so patch ids are never read while candidate
+  // edges are searched concurrently.
+  bool can_read_patch_ids() const
+  {
+    return !in_concurrent_section_;
+  }
+
   void set_patch_id(const face_descriptor& f, const Patch_id& i)
   {
     put(patch_ids_map_, f, i);
@@ -1405,7 +1569,7 @@ private:
     halfedge_descriptor next_on_patch_border(const halfedge_descriptor& h) const
     {
       CGAL_precondition(is_on_patch_border(h));
-      CGAL_assertion_code(const Patch_id& pid = get_patch_id(face(h, mesh_)));
+      CGAL_assertion_code(const Patch_id pid = can_read_patch_ids() ? get_patch_id(face(h, mesh_)) : Patch_id(-1));
 
       halfedge_descriptor end = opposite(h, mesh_);
       halfedge_descriptor nxt = next(h, mesh_);
@@ -1413,14 +1577,14 @@ private:
       {
         if (is_on_patch_border(nxt))
         {
-          CGAL_assertion(get_patch_id(face(nxt, mesh_)) == pid);
+          CGAL_assertion(!can_read_patch_ids() || get_patch_id(face(nxt, mesh_)) == pid);
           return nxt;
         }
         nxt = next(opposite(nxt, mesh_), mesh_);
       }
       while (end != nxt);
 
-      CGAL_assertion(get_patch_id(face(nxt, mesh_)) == pid);
+      CGAL_assertion(!can_read_patch_ids() || get_patch_id(face(nxt, mesh_)) == pid);
       CGAL_assertion(is_on_patch_border(end));
       return end;
     }
@@ -1428,7 +1592,7 @@ private:
     halfedge_descriptor prev_on_patch_border(const halfedge_descriptor& h) const
     {
       CGAL_precondition(is_on_patch_border(h));
-      CGAL_assertion_code(const Patch_id& pid = get_patch_id(face(h, mesh_)));
+      CGAL_assertion_code(const Patch_id pid = can_read_patch_ids() ? get_patch_id(face(h, mesh_)) : Patch_id(-1));
 
       halfedge_descriptor end = opposite(h, mesh_);
       halfedge_descriptor prv = prev(h, mesh_);
@@ -1436,7 +1600,7 @@ private:
       {
         if (is_on_patch_border(prv))
         {
-          CGAL_assertion(get_patch_id(face(prv, mesh_)) == pid);
+          CGAL_assertion(!can_read_patch_ids() || get_patch_id(face(prv, mesh_)) == pid);
           return prv;
         }
         prv = prev(opposite(prv, mesh_), mesh_);
@@ -1444,7 +1608,7 @@ private:
       while (end != prv);
 
       CGAL_assertion(is_on_patch_border(end));
-      CGAL_assertion(get_patch_id(face(prv, mesh_)) == pid);
+      CGAL_assertion(!can_read_patch_ids() || get_patch_id(face(prv, mesh_)) == pid);
       return end;
     }
 
@@ -2047,6 +2211,8 @@ private:
     EdgeIsConstrainedMap ecmap_;
     VertexIsConstrainedMap vcmap_;
     FaceIndexMap fimap_;
+    // true while the mesh is read by several threads
+    bool in_concurrent_section_;
     CGAL_assertion_code(bool input_mesh_is_valid_;)
 
   };//end class Incremental_remesher
@@ -21,6 +21,9 @@
 #include <CGAL/boost/graph/named_params_helper.h>
 #include <CGAL/Weights/cotangent_weights.h>
 #include <CGAL/Dynamic_property_map.h>
+#include <CGAL/for_each.h>
+#include <CGAL/iterator.h>
+#include <CGAL/tags.h>
 #include <CGAL/utility.h>
 
 #if defined(CGAL_EIGEN3_ENABLED)
@@ -44,7 +47,8 @@ template<typename TriangleMesh,
          typename VertexPointMap,
          typename VertexConstraintMap,
          typename SparseLinearSolver,
-         typename GeomTraits>
+         typename GeomTraits,
+         typename ConcurrencyTag = Sequential_tag>
 class Shape_smoother
 {
   typedef typename GeomTraits::FT                                                 FT;
@@ -156,12 +160,12 @@ public:
     CGAL_assertion(stiffness_elements.empty());
     stiffness_elements.reserve(8 * vrange_.size());
 
-    std::unordered_map<std::size_t, double> diag_coeff;
+    // Get a single canonical non-border halfedge per edge with a non-constrained vertex
+    std::vector<halfedge_descriptor> hedges;
     for(face_descriptor f : frange_)
     {
       for(halfedge_descriptor hi : halfedges_around_face(halfedge(f, mesh_), mesh_))
       {
-        // Get a single canonical non-border halfedge per edge
         if(is_border(hi, mesh_))
           continue;
 
@@ -169,33 +173,46 @@ public:
         if(!is_border(hi_opp, mesh_) && hi < hi_opp)
           continue;
 
-        const vertex_descriptor v_source = source(hi, mesh_);
-        const vertex_descriptor v_target = target(hi, mesh_);
+        if(is_constrained(source(hi, mesh_)) && is_constrained(target(hi, mesh_)))
+          continue;
 
-        const bool is_source_constrained = is_constrained(v_source);
-        const bool is_target_constrained = is_constrained(v_target);
+        hedges.push_back(hi);
+      }
+    }
 
-        if(is_source_constrained && is_target_constrained)
-          continue;
+    // Cotangent_weight returns (cot(beta) + cot(gamma)) / 2
+    std::vector<double> weights(hedges.size());
+    CGAL::for_each<ConcurrencyTag>(
+      CGAL::make_counting_range<std::size_t>(0, hedges.size()),
+      [&](const std::size_t i) -> bool
+      {
+        weights[i] = CGAL::to_double(FT(2) * weight_calculator_(hedges[i]));
+        return true;
+      });
 
-        // Cotangent_weight returns (cot(beta) + cot(gamma)) / 2
-        const FT Lij = FT(2) * weight_calculator_(hi);
+    std::unordered_map<std::size_t, double> diag_coeff;
+    for(std::size_t i=0; i<hedges.size(); ++i)
+    {
+      const halfedge_descriptor hi = hedges[i];
+      const vertex_descriptor v_source = source(hi, mesh_);
+      const vertex_descriptor v_target = target(hi, mesh_);
 
-        const std::size_t i_source = get(vimap_, v_source);
-        const std::size_t i_target = get(vimap_, v_target);
+      const double Lij = weights[i];
 
-        // note that these constraints create asymmetry in the matrix
-        if(!is_source_constrained)
-        {
-          stiffness_elements.emplace_back(i_source, i_target, Lij);
-          diag_coeff.emplace(i_source, 0).first->second -= Lij;
-        }
+      const std::size_t i_source = get(vimap_, v_source);
+      const std::size_t i_target = get(vimap_, v_target);
 
-        if(!is_target_constrained)
-        {
-          stiffness_elements.emplace_back(i_target, i_source, Lij);
-          diag_coeff.emplace(i_target, 0).first->second -= Lij;
-        }
+      // note that these constraints create asymmetry in the matrix
+      if(!is_constrained(v_source))
+      {
+        stiffness_elements.emplace_back(i_source, i_target, Lij);
+        diag_coeff.emplace(i_source, 0).first->second -= Lij;
+      }
+
+      if(!is_constrained(v_target))
+      {
+        stiffness_elements.emplace_back(i_target, i_source, Lij);
+        diag_coeff.emplace(i_target, 0).first->second -= Lij;
       }
     }
 
@@ -326,14 +343,21 @@ private:
         diagonal_[index] = 0.;
     }
 
-    for(face_descriptor f : frange_)
-    {
-      const double area = face_area(f, mesh_, parameters::vertex_point_map(vpmap_).geom_traits(traits_));
+    std::vector<double> areas(frange_.size());
+    CGAL::for_each<ConcurrencyTag>(
+      CGAL::make_counting_range<std::size_t>(0, frange_.size()),
+      [&](const std::size_t i) -> bool
+      {
+        areas[i] = CGAL::to_double(face_area(frange_[i], mesh_, parameters::vertex_point_map(vpmap_).geom_traits(traits_)));
+        return true;
+      });
 
-      for(vertex_descriptor v : vertices_around_face(halfedge(f, mesh_), mesh_))
+    for(std::size_t i=0; i<frange_.size(); ++i)
+    {
+      for(vertex_descriptor v : vertices_around_face(halfedge(frange_[i], mesh_), mesh_))
       {
         if(!is_constrained(v))
-          diagonal_[get(vimap_, v)] += area / 6.;
+          diagonal_[get(vimap_, v)] += areas[i] / 6.;
       }
     }
   }
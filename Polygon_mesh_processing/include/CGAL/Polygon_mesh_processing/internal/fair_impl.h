@@ -16,10 +16,16 @@
 #include <CGAL/license/Polygon_mesh_processing/meshing_hole_filling.h>
 
 
+#include <algorithm>
 #include <map>
+#include <memory>
 #include <set>
+#include <vector>
 #include <CGAL/assertions.h>
 #include <CGAL/boost/graph/helpers.h>
+#include <CGAL/for_each.h>
+#include <CGAL/iterator.h>
+#include <CGAL/tags.h>
 #ifdef CGAL_PMP_FAIR_DEBUG
 #include <CGAL/Timer.h>
 #endif
@@ -32,6 +38,9 @@ namespace Polygon_mesh_processing {
 namespace internal {
 
 // [On Linear Variational Surface Deformation Methods-2008]
+// The system is built by `setup_system()` and factorized by `factor()`. As the matrix only depends
+// on the weights, `solve()` can then be called several times to fair the region after the fixed
+// vertices, used as boundary conditions, have been moved.
 template<class PolygonMesh,
          class SparseLinearSolver,
          class WeightCalculator,
@@ -46,11 +55,22 @@ class Fair_Polyhedron_3 {
   typedef typename Sparse_linear_solver::Matrix Solver_matrix;
   typedef typename Sparse_linear_solver::Vector Solver_vector;
 
+  // coefficients of a row of the system: the ones of the free vertices stay in the
+  // left-hand side, and the ones of the fixed vertices are transferred to the right-hand side
+  struct Row {
+    std::vector<std::pair<int, double> > free_coefficients;
+    std::vector<std::pair<vertex_descriptor, double> > fixed_coefficients;
+  };
+
 // members
   PolygonMesh& pmesh;
   WeightCalculator weight_calculator;
   VertexPointMap ppmap;
 
+  std::vector<vertex_descriptor> interior_vertices;
+  std::vector<Row> rows;
+  std::unique_ptr<Solver_matrix> A;
+
 public:
   Fair_Polyhedron_3(PolygonMesh& pmesh
       , VertexPointMap vpmap
@@ -74,9 +94,7 @@ private:
   // Equation 6 in [On Linear Variational Surface Deformation Methods]
   void compute_row(
     vertex_descriptor v,
-    int row_id,                            // which row to insert in [ frees stay left-hand side ]
-    Solver_matrix& matrix,
-    double& x, double& y, double& z,               // constants transferred to right-hand side
+    Row& row,
     double multiplier,
     const std::map<vertex_descriptor, std::size_t>& vertex_id_map,
     unsigned int depth)
@@ -85,13 +103,10 @@ private:
       typename std::map<vertex_descriptor, std::size_t>::const_iterator vertex_id_it = vertex_id_map.find(v);
       if(vertex_id_it != vertex_id_map.end()) {
         int col_id = static_cast<int>(vertex_id_it->second);
-        matrix.add_coef(row_id, col_id, multiplier);
+        row.free_coefficients.push_back(std::make_pair(col_id, multiplier));
       }
       else {
-        typename boost::property_traits<VertexPointMap>::reference p = get(ppmap, v);
-        x += multiplier * - to_double(p.x());
-        y += multiplier * - to_double(p.y());
-        z += multiplier * - to_double(p.z());
+        row.fixed_coefficients.push_back(std::make_pair(v, multiplier));
       }
     }
     else {
@@ -102,18 +117,34 @@ private:
         double w_i_w_ij = w_i * CGAL::to_double(weight_calculator.w_ij(*circ)) ;
 
         vertex_descriptor nv = target(opposite(*circ,pmesh),pmesh);
-        compute_row(nv, row_id, matrix, x, y, z, -w_i_w_ij*multiplier, vertex_id_map, depth-1);
+        compute_row(nv, row, -w_i_w_ij*multiplier, vertex_id_map, depth-1);
       } while(++circ != done);
 
       double w_i_w_ij_sum = w_i * sum_weight(v);
-      compute_row(v, row_id, matrix, x, y, z, w_i_w_ij_sum*multiplier, vertex_id_map, depth-1);
+      compute_row(v, row, w_i_w_ij_sum*multiplier, vertex_id_map, depth-1);
+    }
+  }
+
+  // merges the coefficients of a same fixed vertex
+  static void merge_fixed_coefficients(Row& row)
+  {
+    std::vector<std::pair<vertex_descriptor, double> >& fixed = row.fixed_coefficients;
+    if(fixed.empty()) { return; }
+    std::sort(fixed.begin(), fixed.end(),
+              [](const std::pair<vertex_descriptor, double>& a, const std::pair<vertex_descriptor, double>& b)
+              { return a.first < b.first; });
+    std::size_t last = 0;
+    for(std::size_t i = 1; i < fixed.size(); ++i) {
+      if(fixed[i].first == fixed[last].first) { fixed[last].second += fixed[i].second; }
+      else { fixed[++last] = fixed[i]; }
     }
+    fixed.resize(last + 1);
   }
 
 public:
-  template<class VertexRange>
-  bool fair(const VertexRange& vertices
-    , SparseLinearSolver solver
+  // builds the matrix of the system, the rows being computed concurrently if `ConcurrencyTag` is `Parallel_tag`
+  template<class ConcurrencyTag, class VertexRange>
+  bool setup_system(const VertexRange& vertices
     , unsigned int fc)
   {
     int depth = static_cast<int>(fc) + 1;
@@ -122,18 +153,13 @@ public:
       return false;
     }
 
-    std::set<vertex_descriptor> interior_vertices(std::begin(vertices),
-                                                  std::end(vertices));
+    std::set<vertex_descriptor> vertex_set(std::begin(vertices), std::end(vertices));
+    interior_vertices.assign(vertex_set.begin(), vertex_set.end());
+    rows.clear();
+    A.reset();
     if(interior_vertices.empty()) { return true; }
 
-    #ifdef CGAL_PMP_FAIR_DEBUG
-    CGAL::Timer timer; timer.start();
-    #endif
     const std::size_t nb_vertices = interior_vertices.size();
-    Solver_vector X(nb_vertices), Bx(nb_vertices);
-    Solver_vector Y(nb_vertices), By(nb_vertices);
-    Solver_vector Z(nb_vertices), Bz(nb_vertices);
-
     std::map<vertex_descriptor, std::size_t> vertex_id_map;
     std::size_t id = 0;
     for(vertex_descriptor vd : interior_vertices)
@@ -145,58 +171,119 @@ public:
       ++id;
     }
 
-    Solver_matrix A(nb_vertices);
+    rows.resize(nb_vertices);
+    CGAL::for_each<ConcurrencyTag>(
+      CGAL::make_counting_range<std::size_t>(0, nb_vertices),
+      [&](const std::size_t v_id) -> bool
+      {
+        compute_row(interior_vertices[v_id], rows[v_id], 1, vertex_id_map, depth);
+        merge_fixed_coefficients(rows[v_id]);
+        return true;
+      });
 
-    for(vertex_descriptor vd : interior_vertices)
-    {
-      int v_id = static_cast<int>(vertex_id_map[vd]);
-      compute_row(vd, v_id, A, Bx[v_id], By[v_id], Bz[v_id], 1, vertex_id_map, depth);
-    }
-    #ifdef CGAL_PMP_FAIR_DEBUG
-    std::cerr << "**Timer** System construction: " << timer.time() << std::endl; timer.reset();
-    #endif
+    A.reset(new Solver_matrix(nb_vertices));
+    for(std::size_t v_id = 0; v_id < nb_vertices; ++v_id)
+      for(const std::pair<int, double>& c : rows[v_id].free_coefficients)
+        A->add_coef(static_cast<int>(v_id), c.first, c.second);
+
+    return true;
+  }
+
+  bool factor(SparseLinearSolver& solver)
+  {
+    if(interior_vertices.empty()) { return true; }
+    if(A == nullptr) { return false; }
 
-    // factorize
     double D;
-    bool prefactor_ok = solver.factor(A, D);
+    bool prefactor_ok = solver.factor(*A, D);
     if(!prefactor_ok) {
       CGAL_warning_msg(false, "pre_factor failed!");
       return false;
     }
-    #ifdef CGAL_PMP_FAIR_DEBUG
-    std::cerr << "**Timer** System factorization: " << timer.time() << std::endl; timer.reset();
-    #endif
+    return true;
+  }
+
+  // solves the factorized system, using the current positions of the fixed vertices
+  bool solve(SparseLinearSolver& solver)
+  {
+    const std::size_t nb_vertices = interior_vertices.size();
+    if(nb_vertices == 0) { return true; }
+
+    Solver_vector X(nb_vertices), Bx(nb_vertices);
+    Solver_vector Y(nb_vertices), By(nb_vertices);
+    Solver_vector Z(nb_vertices), Bz(nb_vertices);
+
+    for(std::size_t v_id = 0; v_id < nb_vertices; ++v_id)
+    {
+      double x = 0, y = 0, z = 0;
+      for(const std::pair<vertex_descriptor, double>& c : rows[v_id].fixed_coefficients)
+      {
+        typename boost::property_traits<VertexPointMap>::reference p = get(ppmap, c.first);
+        x += c.second * - to_double(p.x());
+        y += c.second * - to_double(p.y());
+        z += c.second * - to_double(p.z());
+      }
+      Bx[v_id] = x;
+      By[v_id] = y;
+      Bz[v_id] = z;
+    }
 
-    // solve
     bool is_all_solved = solver.linear_solver(Bx, X) && solver.linear_solver(By, Y) && solver.linear_solver(Bz, Z);
     if(!is_all_solved) {
       CGAL_warning_msg(false, "linear_solver failed!");
       return false;
     }
-    #ifdef CGAL_PMP_FAIR_DEBUG
-    std::cerr << "**Timer** System solver: " << timer.time() << std::endl; timer.reset();
-    #endif
-
 
     /* This relative error is to large for cases that the results are not good */
     /*
-    double rel_err_x = (A.eigen_object()*X - Bx).norm() / Bx.norm();
-    double rel_err_y = (A.eigen_object()*Y - By).norm() / By.norm();
-    double rel_err_z = (A.eigen_object()*Z - Bz).norm() / Bz.norm();
+    double rel_err_x = (A->eigen_object()*X - Bx).norm() / Bx.norm();
+    double rel_err_y = (A->eigen_object()*Y - By).norm() / By.norm();
+    double rel_err_z = (A->eigen_object()*Z - Bz).norm() / Bz.norm();
     CGAL_TRACE_STREAM << "rel error: " << rel_err_x
                                 << " " << rel_err_y
                                 << " " << rel_err_z << std::endl;
                                 */
 
     // update
-    id = 0;
-    for(vertex_descriptor vd : interior_vertices)
-    {
-      put(ppmap, vd, Point_3(X[id], Y[id], Z[id]));
-      ++id;
-    }
+    for(std::size_t id = 0; id < nb_vertices; ++id)
+      put(ppmap, interior_vertices[id], Point_3(X[id], Y[id], Z[id]));
     return true;
   }
+
+  template<class VertexRange>
+  bool fair(const VertexRange& vertices
+    , SparseLinearSolver solver
+    , unsigned int fc)
+  {
+    return fair<Sequential_tag>(vertices, solver, fc);
+  }
+
+  template<class ConcurrencyTag, class VertexRange>
+  bool fair(const VertexRange& vertices
+    , SparseLinearSolver solver
+    , unsigned int fc)
+  {
+    #ifdef CGAL_PMP_FAIR_DEBUG
+    CGAL::Timer timer; timer.start();
+    #endif
+    if(!setup_system<ConcurrencyTag>(vertices, fc)) { return false; }
+    #ifdef CGAL_PMP_FAIR_DEBUG
+    std::cerr << "**Timer** System construction: " << timer.time() << std::endl; timer.reset();
+    #endif
+
+    // factorize
+    if(!factor(solver)) { return false; }
+    #ifdef CGAL_PMP_FAIR_DEBUG
+    std::cerr << "**Timer** System factorization: " << timer.time() << std::endl; timer.reset();
+    #endif
+
+    // solve
+    bool solved = solve(solver);
+    #ifdef CGAL_PMP_FAIR_DEBUG
+    std::cerr << "**Timer** System solver: " << timer.time() << std::endl; timer.reset();
+    #endif
+    return solved;
+  }
 };
 
 }//namespace internal
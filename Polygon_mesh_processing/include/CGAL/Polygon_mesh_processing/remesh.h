@@ -193,6 +193,17 @@ namespace Polygon_mesh_processing {
 *                    of the vertex point map.}
 *     \cgalParamDefault{If not provided, vertices are projected on the input surface mesh.}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{With `CGAL::Parallel_tag`, the search for edges to split or collapse, the projection onto
+*                     the input surface, and the relaxation are done concurrently, while edge flips are done by
+*                     batches of edges with disjoint neighborhoods. The result may thus differ from the one
+*                     obtained with `CGAL::Sequential_tag`. The property maps and the functors passed to the
+*                     function must support concurrent calls on distinct simplices.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * @sa `split_long_edges()`
@@ -301,7 +312,13 @@ void isotropic_remeshing(const FaceRange& faces
   t.reset(); t.start();
 #endif
 
-  typename internal::Incremental_remesher<PM, VPMap, GT, ECMap, VCMap, FPMap, FIMap>
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParameters,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
+  typename internal::Incremental_remesher<PM, VPMap, GT, ECMap, VCMap, FPMap, FIMap, Concurrency_tag>
     remesher(pmesh, vpmap, gt, protect, ecmap, vcmap, fpmap, fimap, need_aabb_tree);
   remesher.init_remeshing(faces);
 
@@ -104,6 +104,13 @@ namespace Polygon_mesh_processing {
 *                       is provided as default value:
 *                       `CGAL::Eigen_solver_traits<Eigen::BiCGSTAB<CGAL::Eigen_sparse_matrix<double>::%EigenType, Eigen::IncompleteLUT<double> > >`}
 *   \cgalParamNEnd
+*
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{Only the computation of the coefficients of the linear systems is done concurrently.}
+*   \cgalParamNEnd
 * \cgalNamedParamsEnd
 *
 * @warning This function involves linear algebra, that is computed using non-exact, floating-point arithmetic.
@@ -127,6 +134,15 @@ void smooth_shape(const FaceRange& faces,
                      internal_np::vertex_is_constrained_t,
                      NamedParameters,
                      Static_boolean_property_map<vertex_descriptor, false> >::type  VCMap;
+  typedef typename internal_np::Lookup_named_param_def<
+                     internal_np::concurrency_tag_t,
+                     NamedParameters,
+                     Sequential_tag>::type                                          Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
 
   using parameters::choose_parameter;
   using parameters::get_parameter;
@@ -174,7 +190,7 @@ void smooth_shape(const FaceRange& faces,
   Eigen_vector bx(n), by(n), bz(n), Xx(n), Xy(n), Xz(n);
   std::vector<CGAL::Triple<std::size_t, std::size_t, double> > stiffness;
 
-  internal::Shape_smoother<TriangleMesh, VertexPointMap, VCMap, Sparse_solver, GeomTraits> smoother(tmesh, vpmap, vcmap, scale_after_smoothing, gt);
+  internal::Shape_smoother<TriangleMesh, VertexPointMap, VCMap, Sparse_solver, GeomTraits, Concurrency_tag> smoother(tmesh, vpmap, vcmap, scale_after_smoothing, gt);
 
   smoother.init_smoothing(faces);
 
@@ -18,14 +18,20 @@
 
 #include <CGAL/Polygon_mesh_processing/compute_normal.h>
 #include <CGAL/Polygon_mesh_processing/Uniform_sizing_field.h>
+#include <CGAL/for_each.h>
+#include <CGAL/iterator.h>
 #include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 
 #include <CGAL/Named_function_parameters.h>
 #include <CGAL/boost/graph/named_params_helper.h>
 
+#include <algorithm>
+#include <optional>
 #include <tuple>
 #include <type_traits>
 #include <unordered_map>
+#include <vector>
 
 namespace CGAL {
 namespace Polygon_mesh_processing {
@@ -123,6 +129,16 @@ struct Allow_all_moves{
 *     \cgalParamDefault{If not provided, smoothing weights are the same for all vertices.}
 *   \cgalParamNEnd
 *
+*   \cgalParamNBegin{concurrency_tag}
+*     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.
+*                           With `CGAL::Parallel_tag`, the target positions are computed concurrently,
+*                           and the vertices are then moved concurrently by groups of non-adjacent vertices:
+*                           the result may differ from the sequential one, as the vertices are not moved in the same order.}
+*     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+*     \cgalParamDefault{`CGAL::Sequential_tag`}
+*     \cgalParamExtra{With `CGAL::Parallel_tag`, `allow_move_functor` and `sizing_function` must be thread-safe.}
+*   \cgalParamNEnd
+*
 * \cgalNamedParamsEnd
 *
 * \todo check if it should really be a triangle mesh or if a polygon mesh is fine
@@ -177,6 +193,18 @@ void tangential_relaxation(const VertexRange& vertices,
   const bool relax_constraints = choose_parameter(get_parameter(np, internal_np::relax_constraints), false);
   const unsigned int nb_iterations = choose_parameter(get_parameter(np, internal_np::number_of_iterations), 1);
 
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    CGAL_NP_CLASS,
+    Sequential_tag
+  > ::type Concurrency_tag;
+  constexpr bool parallel_execution = std::is_convertible_v<Concurrency_tag, Parallel_tag>;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!parallel_execution,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   typedef typename GT::Vector_3 Vector_3;
   typedef typename GT::Point_3 Point_3;
 
@@ -239,15 +267,11 @@ void tangential_relaxation(const VertexRange& vertices,
     auto gt_barycenter = gt.construct_barycenter_3_object();
     auto gt_project = gt.construct_projected_point_3_object();
 
-    // at each vertex, compute vertex normal
-    std::unordered_map<vertex_descriptor, Vector_3> vnormals;
-    compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
-
     // at each vertex, compute barycenter of neighbors
-    for(vertex_descriptor v : vertices)
+    auto compute_barycenter = [&](vertex_descriptor v, const auto& vertex_normal) -> std::optional<VNP>
     {
       if (get(vcm, v) || CGAL::internal::is_isolated(v, tm))
-        continue;
+        return std::nullopt;
 
       // collect hedges to detect if we have to handle boundary cases
       std::vector<halfedge_descriptor> interior_hedges, border_halfedges;
@@ -261,7 +285,7 @@ void tangential_relaxation(const VertexRange& vertices,
 
       if (border_halfedges.empty())
       {
-        const Vector_3& vn = vnormals.at(v);
+        const Vector_3 vn = vertex_normal(v);
         Vector_3 move = CGAL::NULL_VECTOR;
         if constexpr (std::is_same_v<SizingFunction, Uniform_sizing_field<TriangleMesh, VPMap>>)
         {
@@ -298,11 +322,11 @@ void tangential_relaxation(const VertexRange& vertices,
           }
           move = move / weight; //todo ip: what if weight ends up being close to 0?
         }
-        barycenters.emplace_back(v, vn, get(vpm, v) + move);
+        return VNP(v, vn, get(vpm, v) + move);
       }
       else
       {
-        if (!relax_constraints) continue;
+        if (!relax_constraints) return std::nullopt;
         Vector_3 vn(NULL_VECTOR);
 
         if (border_halfedges.size() == 2)// corners are constrained
@@ -324,10 +348,42 @@ void tangential_relaxation(const VertexRange& vertices,
             typename GT::Point_3 p1 = gt_project(s1, bary), p2 = gt_project(s2, bary);
 
             bary = squared_distance(p1, bary)<squared_distance(p2,bary)? p1:p2;
-            barycenters.emplace_back(v, vn, bary);
+            return VNP(v, vn, bary);
           }
         }
       }
+      return std::nullopt;
+    };
+
+    if constexpr (parallel_execution)
+    {
+      const std::vector<vertex_descriptor> vertex_range(std::begin(vertices), std::end(vertices));
+      std::vector<std::optional<VNP> > results(vertex_range.size());
+      CGAL::for_each<Concurrency_tag>(
+        CGAL::make_counting_range<std::size_t>(0, vertex_range.size()),
+        [&](const std::size_t i) -> bool
+        {
+          results[i] = compute_barycenter(vertex_range[i], [&](vertex_descriptor vd)
+                                          { return compute_vertex_normal(vd, tm, np); });
+          return true;
+        });
+      for (const std::optional<VNP>& r : results)
+        if (r)
+          barycenters.push_back(*r);
+    }
+    else
+    {
+      // at each vertex, compute vertex normal
+      std::unordered_map<vertex_descriptor, Vector_3> vnormals;
+      compute_vertex_normals(tm, boost::make_assoc_property_map(vnormals), np);
+
+      for(vertex_descriptor v : vertices)
+      {
+        std::optional<VNP> r = compute_barycenter(v, [&](vertex_descriptor vd)
+                                                  { return vnormals.at(vd); });
+        if (r)
+          barycenters.push_back(*r);
+      }
     }
 
     // compute moves
@@ -345,7 +401,7 @@ void tangential_relaxation(const VertexRange& vertices,
     }
 
     // perform moves
-    for(const VP_pair& vp : new_locations)
+    auto perform_move = [&](const VP_pair& vp)
     {
       const Point_3 initial_pos = get(vpm, vp.first); // make a copy on purpose
       const Vector_3 move(initial_pos, vp.second);
@@ -363,6 +419,46 @@ void tangential_relaxation(const VertexRange& vertices,
       }
       if (frac <= 0.02)
         put(vpm, vp.first, initial_pos);//cancel move
+    };
+
+    if constexpr (parallel_execution)
+    {
+      // the check of a move reads the positions of the neighbors:
+      // adjacent vertices are never moved concurrently
+      std::unordered_map<vertex_descriptor, std::size_t> colors;
+      for(const VP_pair& vp : new_locations)
+        colors.emplace(vp.first, 0);
+
+      std::vector<std::vector<std::size_t> > groups;
+      std::vector<bool> used;
+      for(std::size_t i = 0; i < new_locations.size(); ++i)
+      {
+        used.assign(groups.size() + 1, false);
+        for(halfedge_descriptor h : halfedges_around_target(new_locations[i].first, tm))
+        {
+          auto it = colors.find(source(h, tm));
+          if(it != colors.end() && it->second != 0)
+            used[it->second - 1] = true;
+        }
+        const std::size_t color = std::size_t(std::find(used.begin(), used.end(), false) - used.begin());
+        colors[new_locations[i].first] = color + 1;
+        if(color == groups.size())
+          groups.emplace_back();
+        groups[color].push_back(i);
+      }
+
+      for(const std::vector<std::size_t>& group : groups)
+        CGAL::for_each<Concurrency_tag>(group,
+                                        [&](const std::size_t i) -> bool
+                                        {
+                                          perform_move(new_locations[i]);
+                                          return true;
+                                        });
+    }
+    else
+    {
+      for(const VP_pair& vp : new_locations)
+        perform_move(vp);
     }
   }//end for loop (nit == nb_iterations)
 
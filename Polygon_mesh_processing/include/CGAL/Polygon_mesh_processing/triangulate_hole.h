@@ -27,8 +27,8 @@
 
 #include <CGAL/boost/graph/helpers.h>
 
+#include <limits>
 #include <tuple>
-
 #include <vector>
 
 namespace CGAL {
@@ -143,6 +143,18 @@ namespace Polygon_mesh_processing {
                       otherwise nothing will be done.}
     \cgalParamNEnd
 
+    \cgalParamNBegin{large_hole_threshold}
+      \cgalParamDescription{The number of vertices above which a hole is considered as large. A large hole is
+                            triangulated in the fitting plane of its boundary if the projection of its boundary
+                            onto this plane is simple, whatever the planarity of the boundary. Otherwise, it is
+                            recursively split along short diagonals into holes with at most this number of vertices,
+                            which are then filled independently. The running time is then almost linear in the size of the hole,
+                            at the expense of the quality of the triangulation compared to the one obtained with the general algorithm.}
+      \cgalParamType{`std::size_t`}
+      \cgalParamDefault{`std::numeric_limits<std::size_t>::max()`}
+      \cgalParamExtra{If the triangulation of a large hole fails, the general algorithm is used.}
+    \cgalParamNEnd
+
     \cgalParamNBegin{visitor}
       \cgalParamDescription{a visitor used to track when entering a given phase of the algorithm}
       \cgalParamType{A model of PMPHolefillingVisitor}
@@ -231,7 +243,9 @@ namespace Polygon_mesh_processing {
         use_cdt,
         choose_parameter(get_parameter(np, internal_np::do_not_use_cubic_algorithm), false),
         choose_parameter(get_parameter_reference(np, internal_np::visitor), default_visitor),
-        max_squared_distance).first;
+        max_squared_distance,
+        choose_parameter(get_parameter(np, internal_np::large_hole_threshold),
+                         (std::numeric_limits<std::size_t>::max)())).first;
   }
 
 #ifndef CGAL_NO_DEPRECATED_CODE
@@ -264,6 +278,172 @@ namespace Polygon_mesh_processing {
   }
 #endif // CGAL_NO_DEPRECATED_CODE
 
+  /*!
+  \ingroup PMP_hole_filling_grp
+
+  triangulates several holes in a polygon mesh.
+
+  The triangulations of the holes are computed independently, possibly in parallel,
+  and are then added to `pmesh`. The result is the same as the one obtained by calling
+  `triangulate_hole()` for each hole, except for holes sharing vertices with previously filled holes,
+  which are triangulated again if their triangulation would create an edge already added to `pmesh`.
+
+  @tparam PolygonMesh a model of `MutableFaceGraph`
+  @tparam HalfedgeRange a range of border halfedges, model of `Range`.
+          Its iterator type is `InputIterator` with value type `boost::graph_traits<PolygonMesh>::%halfedge_descriptor`
+  @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+
+  @param pmesh polygon mesh containing the holes
+  @param border_halfedges a range of border halfedges, each incident to a different hole
+  @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+
+  \cgalNamedParamsBegin
+
+    \cgalParamNBegin{concurrency_tag}
+      \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+      \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+      \cgalParamDefault{`CGAL::Sequential_tag`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{face_output_iterator}
+      \cgalParamDescription{iterator over patch faces}
+      \cgalParamType{a model of `OutputIterator`
+    holding `boost::graph_traits<PolygonMesh>::%face_descriptor` for patch faces}
+      \cgalParamDefault{`Emptyset_iterator`}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{vertex_point_map}
+      \cgalParamDescription{a property map associating points to the vertices of `pmesh`}
+      \cgalParamType{a class model of `ReadWritePropertyMap` with `boost::graph_traits<PolygonMesh>::%vertex_descriptor`
+                     as key type and `%Point_3` as value type}
+      \cgalParamDefault{`boost::get(CGAL::vertex_point, pmesh)`}
+      \cgalParamExtra{If this parameter is omitted, an internal property map for `CGAL::vertex_point_t`
+                      must be available in `PolygonMesh`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{geom_traits}
+      \cgalParamDescription{an instance of a geometric traits class}
+      \cgalParamType{a class model of `Kernel`}
+      \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+      \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_delaunay_triangulation}
+      \cgalParamDescription{If `true`, use the Delaunay triangulation facet search space.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`true`}
+      \cgalParamExtra{If no valid triangulation can be found in this search space, the algorithm
+                      falls back to the non-Delaunay triangulations search space to find a solution.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{use_2d_constrained_delaunay_triangulation}
+      \cgalParamDescription{If `true`, the points of the boundary of each hole are used
+                            to estimate a fitting plane and a 2D constrained Delaunay triangulation
+                            is then used to fill the hole projected in the fitting plane.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`true`}
+      \cgalParamExtra{If the boundary of the hole is not planar (according to the
+                      parameter `threshold_distance`) or if no valid 2D triangulation
+                      can be found, the algorithm falls back to the method using
+                      the 3D Delaunay triangulation. This parameter is a good choice for near planar holes.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{threshold_distance}
+      \cgalParamDescription{The maximum distance between the vertices of
+                            the boundary of a hole and the least squares plane fitted to this boundary.}
+      \cgalParamType{double}
+      \cgalParamDefault{one quarter of the height of the bounding box of the hole}
+      \cgalParamExtra{This parameter is used only in conjunction with
+                      the parameter `use_2d_constrained_delaunay_triangulation`.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{do_not_use_cubic_algorithm}
+      \cgalParamDescription{Set this parameter to `true` if you only want to use the Delaunay based versions of the algorithm,
+                            skipping the cubic search space one in case of failure.}
+      \cgalParamType{Boolean}
+      \cgalParamDefault{`false`}
+      \cgalParamExtra{If `true`, `use_2d_constrained_delaunay_triangulation` or `use_delaunay_triangulation` must be set to `true`
+                      otherwise nothing will be done.}
+    \cgalParamNEnd
+
+    \cgalParamNBegin{large_hole_threshold}
+      \cgalParamDescription{the number of vertices above which a hole is filled with the faster method for large holes, as in `triangulate_hole()`}
+      \cgalParamType{`std::size_t`}
+      \cgalParamDefault{`std::numeric_limits<std::size_t>::max()`}
+    \cgalParamNEnd
+
+  \cgalNamedParamsEnd
+
+  @return the number of holes that have been filled
+
+  \sa `triangulate_hole()`
+  */
+  template<typename PolygonMesh,
+           typename HalfedgeRange,
+           typename CGAL_NP_TEMPLATE_PARAMETERS>
+  std::size_t
+  triangulate_holes(PolygonMesh& pmesh,
+                    const HalfedgeRange& border_halfedges,
+                    const CGAL_NP_CLASS& np = parameters::default_values())
+  {
+    using parameters::choose_parameter;
+    using parameters::get_parameter;
+
+    typedef typename GetGeomTraits<PolygonMesh,CGAL_NP_CLASS>::type         GeomTraits;
+    typedef typename boost::graph_traits<PolygonMesh>::halfedge_descriptor halfedge_descriptor;
+
+    typedef typename internal_np::Lookup_named_param_def<internal_np::face_output_iterator_t,
+                                                         CGAL_NP_CLASS,
+                                                         Emptyset_iterator>::type Face_output_iterator;
+
+    typedef typename internal_np::Lookup_named_param_def <
+      internal_np::concurrency_tag_t,
+      CGAL_NP_CLASS,
+      Sequential_tag
+    > ::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    Face_output_iterator out = choose_parameter<Emptyset_iterator>(get_parameter(np, internal_np::face_output_iterator));
+
+    bool use_dt3 =
+#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_DT3
+      false;
+#else
+      choose_parameter(get_parameter(np, internal_np::use_delaunay_triangulation), true);
+#endif
+
+    bool use_cdt =
+#ifdef CGAL_HOLE_FILLING_DO_NOT_USE_CDT2
+        false;
+#else
+        choose_parameter(get_parameter(np, internal_np::use_2d_constrained_delaunay_triangulation), false);
+#endif
+
+    std::vector<halfedge_descriptor> hedges;
+    for(halfedge_descriptor h : border_halfedges)
+    {
+      CGAL_precondition(face(h, pmesh) == boost::graph_traits<PolygonMesh>::null_face());
+      hedges.push_back(h);
+    }
+
+    return internal::triangulate_holes_polygon_mesh<Concurrency_tag, Hole_filling::Default_visitor>(
+      pmesh,
+      hedges,
+      out,
+      choose_parameter(get_parameter(np, internal_np::vertex_point), get_property_map(vertex_point, pmesh)),
+      use_dt3,
+      choose_parameter<GeomTraits>(get_parameter(np, internal_np::geom_traits)),
+      use_cdt,
+      choose_parameter(get_parameter(np, internal_np::do_not_use_cubic_algorithm), false),
+      choose_parameter(get_parameter(np, internal_np::threshold_distance), typename GeomTraits::FT(-1)),
+      choose_parameter(get_parameter(np, internal_np::large_hole_threshold),
+                       (std::numeric_limits<std::size_t>::max)()));
+  }
+
   /*!
   \ingroup PMP_hole_filling_grp
   @brief triangulates and refines a hole in a polygon mesh.
@@ -345,6 +525,12 @@ namespace Polygon_mesh_processing {
                       otherwise nothing will be done.}
     \cgalParamNEnd
 
+    \cgalParamNBegin{large_hole_threshold}
+      \cgalParamDescription{the number of vertices above which a hole is filled with the faster method for large holes, as in `triangulate_hole()`}
+      \cgalParamType{`std::size_t`}
+      \cgalParamDefault{`std::numeric_limits<std::size_t>::max()`}
+    \cgalParamNEnd
+
     \cgalParamNBegin{density_control_factor}
       \cgalParamDescription{factor to control density of the output mesh,
                             where larger values cause denser refinements, as in `refine()`}
@@ -514,6 +700,12 @@ namespace Polygon_mesh_processing {
                       the parameter `use_2d_constrained_delaunay_triangulation`.}
     \cgalParamNEnd
 
+    \cgalParamNBegin{large_hole_threshold}
+      \cgalParamDescription{the number of vertices above which a hole is filled with the faster method for large holes, as in `triangulate_hole()`}
+      \cgalParamType{`std::size_t`}
+      \cgalParamDefault{`std::numeric_limits<std::size_t>::max()`}
+    \cgalParamNEnd
+
     \cgalParamNBegin{density_control_factor}
       \cgalParamDescription{factor to control density of the output mesh,
                             where larger values cause denser refinements, as in `refine()`}
@@ -0,0 +1,305 @@
+// This file is part of CGAL (www.cgal.org).
+//
+// $URL$
+// $Id$
+// SPDX-License-Identifier: GPL-3.0-or-later OR LicenseRef-Commercial
+//
+
+#ifndef CGAL_POLYGON_MESH_PROCESSING_UNION_OF_TRIANGLE_MESHES_H
+#define CGAL_POLYGON_MESH_PROCESSING_UNION_OF_TRIANGLE_MESHES_H
+
+#include <CGAL/license/Polygon_mesh_processing/corefinement.h>
+
+#include <CGAL/Polygon_mesh_processing/autorefinement.h>
+#include <CGAL/Polygon_mesh_processing/orient_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/orientation.h>
+#include <CGAL/Polygon_mesh_processing/polygon_mesh_to_polygon_soup.h>
+#include <CGAL/Polygon_mesh_processing/polygon_soup_to_polygon_mesh.h>
+#include <CGAL/Polygon_mesh_processing/repair_polygon_soup.h>
+#include <CGAL/Side_of_triangle_mesh.h>
+#include <CGAL/boost/graph/helpers.h>
+#include <CGAL/boost/graph/named_params_helper.h>
+#include <CGAL/Named_function_parameters.h>
+#include <CGAL/for_each.h>
+#include <CGAL/iterator.h>
+#include <CGAL/tags.h>
+
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <array>
+#include <memory>
+#include <unordered_map>
+#include <utility>
+#include <vector>
+
+namespace CGAL {
+namespace Polygon_mesh_processing {
+
+#ifndef DOXYGEN_RUNNING
+namespace internal {
+
+// records, for each triangle of the refined soup, the input triangle it comes from
+struct Triangle_origin_visitor
+{
+  std::vector<std::size_t>* input_triangle_ids;
+
+  Triangle_origin_visitor(std::vector<std::size_t>& ids)
+    : input_triangle_ids(&ids)
+  {}
+
+  void number_of_output_triangles(std::size_t nbt) { input_triangle_ids->resize(nbt); }
+  void verbatim_triangle_copy(std::size_t tgt_id, std::size_t src_id) { (*input_triangle_ids)[tgt_id] = src_id; }
+  void new_subtriangle(std::size_t tgt_id, std::size_t src_id) { (*input_triangle_ids)[tgt_id] = src_id; }
+};
+
+inline bool same_orientation(const std::array<std::size_t, 3>& t1,
+                             const std::array<std::size_t, 3>& t2)
+{
+  for (int i=0; i<3; ++i)
+    if (t1[0]==t2[i])
+      return t1[1]==t2[(i+1)%3];
+  return false;
+}
+
+} // end of internal namespace
+#endif
+
+/**
+ * \ingroup PMP_corefinement_grp
+ *
+ * computes the union of the volumes bounded by the triangle meshes in `meshes` and puts its boundary in `tm_out`.
+ *
+ * Contrary to successive calls to `corefine_and_compute_union()`, that would each corefine the current
+ * result with one more mesh, all the meshes are refined at once using `autorefine_triangle_soup()`.
+ * The refined triangles are then grouped into patches, which are bounded by the intersection curves
+ * between the meshes. A patch is part of the output if its winding number with respect to the other
+ * input meshes, that is the number of other input volumes containing it, is zero. As this number is
+ * constant over a patch, it is computed once per patch. Triangles shared by several meshes (coplanar
+ * overlaps) are kept once if the meshes are on the same side of the triangle, and discarded otherwise.
+ *
+ * Note that if a kernel with exact predicates but inexact constructions is used, the rounding of the intersection
+ * points may result in an incorrect classification of the triangles of the refinement close to
+ * the intersection curves. For robustness, a kernel with exact constructions should be used.
+ *
+ * @tparam TriangleMeshRange a model of `ConstRange` whose value type is `TriangleMesh`
+ * @tparam TriangleMesh a model of `HalfedgeListGraph`, `FaceListGraph`, and `MutableFaceGraph`
+ * @tparam NamedParameters a sequence of \ref bgl_namedparameters "Named Parameters"
+ *
+ * @param meshes the input triangle meshes. The points of each mesh are accessed through its internal
+ *               property map for `CGAL::vertex_point_t`.
+ * @param tm_out output surface mesh
+ * @param np an optional sequence of \ref bgl_namedparameters "Named Parameters" among the ones listed below
+ *
+ * \cgalNamedParamsBegin
+ *   \cgalParamNBegin{concurrency_tag}
+ *     \cgalParamDescription{a tag indicating if the task should be done using one or several threads.}
+ *     \cgalParamType{Either `CGAL::Sequential_tag`, or `CGAL::Parallel_tag`, or `CGAL::Parallel_if_available_tag`}
+ *     \cgalParamDefault{`CGAL::Sequential_tag`}
+ *   \cgalParamNEnd
+ *   \cgalParamNBegin{geom_traits}
+ *     \cgalParamDescription{an instance of a geometric traits class}
+ *     \cgalParamType{a class model of `Kernel`}
+ *     \cgalParamDefault{a \cgal Kernel deduced from the point type, using `CGAL::Kernel_traits`}
+ *     \cgalParamExtra{The geometric traits class must be compatible with the vertex point type.}
+ *   \cgalParamNEnd
+ * \cgalNamedParamsEnd
+ *
+ * \pre each mesh in `meshes` is a closed triangle mesh bounding a volume (see `does_bound_a_volume()`)
+ *
+ * @warning `clear(tm_out)` will be called before filling `tm_out` with the result.
+ *
+ * @return `true` if the output surface could be stored in `tm_out`. Non-manifold edges and vertices
+ *         of the output surface are duplicated.
+ *
+ * \sa `corefine_and_compute_union()`
+ */
+template <class TriangleMeshRange,
+          class TriangleMesh,
+          class NamedParameters = parameters::Default_named_parameters>
+bool
+union_of_triangle_meshes(const TriangleMeshRange& meshes,
+                         TriangleMesh& tm_out,
+                         const NamedParameters& np = parameters::default_values())
+{
+  using parameters::choose_parameter;
+  using parameters::get_parameter;
+
+  typedef typename GetGeomTraits<TriangleMesh, NamedParameters>::type GT;
+  GT gt = choose_parameter<GT>(get_parameter(np, internal_np::geom_traits));
+  typedef typename GT::Point_3 Point_3;
+
+  typedef typename internal_np::Lookup_named_param_def <
+    internal_np::concurrency_tag_t,
+    NamedParameters,
+    Sequential_tag
+  > ::type Concurrency_tag;
+
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!std::is_convertible<Concurrency_tag, Parallel_tag>::value,
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+  typedef Side_of_triangle_mesh<TriangleMesh, GT> Side_of_tm;
+  typedef std::array<std::size_t, 3> Triangle;
+
+  // put all the meshes in the same soup, keeping track of the mesh of each triangle
+  std::vector<Point_3> soup_points;
+  std::vector<Triangle> soup_triangles;
+  std::vector<std::size_t> mesh_triangle_offsets;
+  std::vector<const TriangleMesh*> mesh_ptrs;
+  for (const TriangleMesh& tm : meshes)
+  {
+    CGAL_precondition(is_triangle_mesh(tm) && is_closed(tm));
+    CGAL_precondition(does_bound_a_volume(tm));
+    mesh_triangle_offsets.push_back(soup_triangles.size());
+    mesh_ptrs.push_back(&tm);
+    polygon_mesh_to_polygon_soup(tm, soup_points, soup_triangles);
+  }
+  const std::size_t nb_meshes = mesh_ptrs.size();
+
+  clear(tm_out);
+  if (nb_meshes == 0)
+    return true;
+
+  // refine all the meshes at once
+  std::vector<std::size_t> input_triangle_ids;
+  autorefine_triangle_soup(soup_points, soup_triangles,
+                           parameters::concurrency_tag(Concurrency_tag())
+                                      .geom_traits(gt)
+                                      .visitor(internal::Triangle_origin_visitor(input_triangle_ids)));
+
+  auto mesh_id = [&](std::size_t ti)
+  {
+    return std::size_t(std::upper_bound(mesh_triangle_offsets.begin(), mesh_triangle_offsets.end(),
+                                        input_triangle_ids[ti]) - mesh_triangle_offsets.begin()) - 1;
+  };
+
+  // group identical triangles, coming from coplanar overlaps between meshes
+  std::vector<std::vector<std::size_t> > groups;
+  {
+    std::unordered_map<Triangle, std::size_t, boost::hash<Triangle> > triangle_to_group;
+    for (std::size_t ti=0; ti<soup_triangles.size(); ++ti)
+    {
+      Triangle key = soup_triangles[ti];
+      std::sort(key.begin(), key.end());
+      auto insert_res = triangle_to_group.emplace(key, groups.size());
+      if (insert_res.second)
+        groups.emplace_back();
+      groups[insert_res.first->second].push_back(ti);
+    }
+  }
+
+  // Gather the groups into patches. After the refinement, the intersection curves between the
+  // meshes are made of edges incident to more than two groups. Two groups sharing an edge that has
+  // no other incident group come from the same meshes and are on the same side of all the other
+  // meshes, so the classification is constant over a patch.
+  typedef std::pair<std::size_t, std::size_t> Edge;
+  std::unordered_map<Edge, std::vector<std::size_t>, boost::hash<Edge> > edge_to_groups;
+  auto make_edge = [](std::size_t i, std::size_t j)
+  {
+    return i < j ? Edge(i, j) : Edge(j, i);
+  };
+  for (std::size_t gi=0; gi<groups.size(); ++gi)
+  {
+    const Triangle& t = soup_triangles[groups[gi].front()];
+    for (int i=0; i<3; ++i)
+      edge_to_groups[make_edge(t[i], t[(i+1)%3])].push_back(gi);
+  }
+
+  const std::size_t no_patch = std::size_t(-1);
+  std::vector<std::size_t> patch_ids(groups.size(), no_patch);
+  std::vector<std::size_t> patch_representatives;
+  std::vector<std::size_t> stack;
+  for (std::size_t gi=0; gi<groups.size(); ++gi)
+  {
+    if (patch_ids[gi] != no_patch)
+      continue;
+    const std::size_t patch_id = patch_representatives.size();
+    patch_representatives.push_back(gi);
+    patch_ids[gi] = patch_id;
+    stack.push_back(gi);
+    while (!stack.empty())
+    {
+      const std::size_t cgi = stack.back();
+      stack.pop_back();
+      const Triangle& t = soup_triangles[groups[cgi].front()];
+      for (int i=0; i<3; ++i)
+      {
+        const std::vector<std::size_t>& incident_groups = edge_to_groups[make_edge(t[i], t[(i+1)%3])];
+        if (incident_groups.size() != 2)
+          continue;
+        const std::size_t ngi = incident_groups[0] == cgi ? incident_groups[1] : incident_groups[0];
+        if (patch_ids[ngi] == no_patch)
+        {
+          patch_ids[ngi] = patch_id;
+          stack.push_back(ngi);
+        }
+      }
+    }
+  }
+  edge_to_groups.clear();
+
+  // classify each patch using the winding number of the centroid of one of its triangles with
+  // respect to the meshes the patch does not come from
+  std::vector<std::unique_ptr<Side_of_tm> > side_of_meshes;
+  side_of_meshes.reserve(nb_meshes);
+  for (const TriangleMesh* tm_ptr : mesh_ptrs)
+    side_of_meshes.emplace_back(new Side_of_tm(*tm_ptr, gt));
+
+  typename GT::Construct_centroid_3 centroid = gt.construct_centroid_3_object();
+  std::vector<char> keep_patch(patch_representatives.size(), 0);
+  CGAL::for_each<Concurrency_tag>(
+    CGAL::make_counting_range<std::size_t>(0, patch_representatives.size()),
+    [&](const std::size_t pi) -> bool
+    {
+      const std::vector<std::size_t>& group = groups[patch_representatives[pi]];
+      const Triangle& t = soup_triangles[group.front()];
+
+      std::vector<std::size_t> group_meshes;
+      for (std::size_t ti : group)
+        group_meshes.push_back(mesh_id(ti));
+
+      const Point_3 c = centroid(soup_points[t[0]], soup_points[t[1]], soup_points[t[2]]);
+      for (std::size_t mi=0; mi<nb_meshes; ++mi)
+      {
+        if (std::find(group_meshes.begin(), group_meshes.end(), mi) != group_meshes.end())
+          continue;
+        if ((*side_of_meshes[mi])(c) == ON_BOUNDED_SIDE)
+          return true;
+      }
+      keep_patch[pi] = 1;
+      return true;
+    });
+
+  // a triangle shared by two volumes with opposite orientations is inside the union
+  auto keep_group = [&](std::size_t gi)
+  {
+    if (!keep_patch[patch_ids[gi]])
+      return false;
+    const std::vector<std::size_t>& group = groups[gi];
+    const Triangle& t = soup_triangles[group.front()];
+    for (std::size_t ti : group)
+      if (!internal::same_orientation(t, soup_triangles[ti]))
+        return false;
+    return true;
+  };
+
+  std::vector<Triangle> union_triangles;
+  for (std::size_t gi=0; gi<groups.size(); ++gi)
+    if (keep_group(gi))
+      union_triangles.push_back(soup_triangles[groups[gi].front()]);
+
+  remove_isolated_points_in_polygon_soup(soup_points, union_triangles);
+  // the triangles are already consistently oriented, this only duplicates non-manifold simplices
+  orient_polygon_soup(soup_points, union_triangles);
+  if (!is_polygon_soup_a_polygon_mesh(union_triangles))
+    return false;
+  polygon_soup_to_polygon_mesh(soup_points, union_triangles, tm_out);
+
+  return true;
+}
+
+} } // end of CGAL::Polygon_mesh_processing
+
+#endif // CGAL_POLYGON_MESH_PROCESSING_UNION_OF_TRIANGLE_MESHES_H
@@ -19,8 +19,14 @@
 #include <CGAL/AABB_tree.h>
 #include <CGAL/AABB_traits_3.h>
 #include <CGAL/AABB_halfedge_graph_segment_primitive.h>
+#include <CGAL/for_each.h>
+#include <CGAL/Interval_nt.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
 #include <CGAL/tuple.h>
 
+#include <algorithm>
+#include <numeric>
 #include <vector>
 #include <set>
 #include <type_traits>
@@ -387,6 +393,122 @@ class Polygon_mesh_slicer
     return std::pair<int,FT>(-1, 0);
   }
 
+  /// assembles the polylines of the intersection of `plane` with the mesh, given the edges
+  /// and the vertices of the mesh intersected by `plane`
+  template <class OutputIterator>
+  OutputIterator polylines_from_intersected_edges(const Plane_3& plane,
+                                                  const std::pair<int, FT>& app_info,
+                                                  std::set<edge_descriptor>& all_coplanar_edges,
+                                                  std::vector<edge_descriptor>& iedges,
+                                                  Vertices_map& vertices,
+                                                  OutputIterator out) const
+  {
+    // init output graph
+    AL_graph al_graph;
+
+    // add nodes for each vertex in the plane
+    for(Vertex_pair& vdp : vertices)
+    {
+      vdp.second=add_vertex(al_graph);
+      al_graph[vdp.second]=vdp.first;
+    }
+
+    Compare_face less_face(m_tmesh);
+    AL_edge_map al_edge_map( less_face );
+
+    // Filter coplanar edges: we consider only coplanar edges incident to one non-coplanar facet
+    //   for each such edge, add the corresponding nodes in the adjacency-list graph as well as
+    //   the edge
+    for(const edge_descriptor ed : all_coplanar_edges)
+    {
+      if (  face(halfedge(ed, m_tmesh), m_tmesh)==graph_traits::null_face() ||
+            opposite_face(ed)==graph_traits::null_face()  ||
+            !all_coplanar_edges.count( next_edge(ed) ) ||
+            !all_coplanar_edges.count( next_of_opposite_edge(ed) ) )
+      {
+        typename Vertices_map::iterator it_insert1, it_insert2;
+        bool is_new;
+
+        // Each coplanar edge is connecting two nodes
+        //  handle source
+        std::tie(it_insert1, is_new) =
+          vertices.insert(
+              Vertex_pair(
+                source(ed,m_tmesh), AL_graph::null_vertex()
+              )
+          );
+        if (is_new)
+        {
+          it_insert1->second=add_vertex(al_graph);
+          al_graph[it_insert1->second]=it_insert1->first;
+        }
+        //  handle target
+        std::tie(it_insert2, is_new) =
+          vertices.insert(
+              Vertex_pair(
+                target(ed,m_tmesh), AL_graph::null_vertex()
+              )
+          );
+        if (is_new)
+        {
+          it_insert2->second=add_vertex(al_graph);
+          al_graph[it_insert2->second]=it_insert2->first;
+        }
+        // add the edge into the adjacency-list graph
+        CGAL_assertion( it_insert1->second!=AL_graph::null_vertex() );
+        CGAL_assertion( it_insert2->second!=AL_graph::null_vertex() );
+        add_edge(it_insert1->second, it_insert2->second, al_graph);
+      }
+    }
+
+    // for each edge intersected in its interior, creates a node in
+    // an adjacency-list graph and put an edge between two such nodes
+    // when the corresponding edges shares a common face
+    for(edge_descriptor ed : iedges)
+    {
+      AL_vertex_descriptor vd=add_vertex(al_graph);
+      al_graph[vd]=ed;
+      update_al_graph_connectivity(ed, vd, al_edge_map, al_graph);
+    }
+
+    // If one of the node above is not connected in its two incident faces
+    // then it must be connected to a vertex (including those in the set
+    // of coplanar edges)
+    typedef std::pair<halfedge_descriptor, AL_vertex_pair> Halfedge_and_vertices;
+    for(Halfedge_and_vertices hnv :al_edge_map)
+    {
+      if (hnv.second.second==AL_graph::null_vertex())
+      {
+        //get the edge and test opposite vertices (if the edge is not on the boundary)
+        vertex_descriptor vd = target( next(hnv.first, m_tmesh), m_tmesh);
+        typename Vertices_map::iterator itv=vertices.find(vd);
+        CGAL_assertion( itv!=vertices.end() );
+        add_edge(itv->second, hnv.second.first, al_graph);
+      }
+    }
+
+    CGAL_assertion(num_vertices(al_graph)==iedges.size()+vertices.size());
+
+    // now assemble the edges of al_graph to define polylines,
+    // putting them in the output iterator
+    if (!UseParallelPlaneOptimization || app_info.first==-1)
+    {
+      Polyline_visitor<OutputIterator, Traits> visitor(m_tmesh, al_graph, plane, m_vpmap, m_traits, out);
+      split_graph_into_polylines(al_graph, visitor);
+      return visitor.out;
+    }
+    else
+    {
+      typedef Polygon_mesh_slicer_::Axis_parallel_plane_traits<Traits> App_traits;
+      App_traits app_traits(app_info.first, app_info.second, m_traits);
+
+      Polyline_visitor<OutputIterator, App_traits> visitor
+        (m_tmesh, al_graph, plane, m_vpmap, app_traits, out);
+      split_graph_into_polylines(al_graph, visitor);
+      return visitor.out;
+    }
+  }
+
 public:
 
   /// the AABB-tree type used internally
@@ -538,110 +660,156 @@ public:
       m_tree_ptr->traversal(plane, ttraits);
     }
 
-    // init output graph
-    AL_graph al_graph;
+    return polylines_from_intersected_edges(plane, app_info, all_coplanar_edges, iedges, vertices, out);
+  }
 
-    // add nodes for each vertex in the plane
-    for(Vertex_pair& vdp : vertices)
+  /**
+   * Constructs the intersecting polylines of each plane of `planes` with the input triangulated surface mesh.
+   * The polylines of each plane are the same as the ones constructed by `operator()`, up to their order
+   * and to the starting point of closed polylines.
+   *
+   * The planes must be parallel and have the same coefficients `a`, `b`, and `c`, as for example planes
+   * defined with the same orthogonal vector. Instead of one traversal of the AABB-tree per plane,
+   * the edges of the mesh are distributed once among the planes, according to the interval of heights
+   * they span along the orthogonal vector of the planes. This is much faster when slicing a mesh
+   * with many planes, for example when slicing a mesh into layers for additive manufacturing.
+   *
+   * @tparam ConcurrencyTag enables sequential versus parallel computation of the polylines of the different planes.
+   *         Possible values are `Sequential_tag` (the default), `Parallel_if_available_tag`, and `Parallel_tag`.
+   * @tparam PlaneRange a model of `ConstRange` with `Traits::Plane_3` as value type
+   * @tparam OutputIterator an output iterator accepting the polylines of a plane as a
+   *         `std::vector<std::vector<Traits::Point_3> >`.
+   *
+   * @param planes the planes to intersect the triangulated surface mesh with, in any order
+   * @param out output iterator, in which the polylines of each plane are put, following the order of `planes`.
+   *            The polylines of a plane not intersecting the mesh form an empty range.
+   */
+  template <class ConcurrencyTag = Sequential_tag, class PlaneRange, class OutputIterator>
+  OutputIterator slice(const PlaneRange& planes,
+                       OutputIterator out) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    typedef std::vector<Point_3>                                   Polyline;
+    typedef Interval_nt<false>                                     Interval;
+
+    const std::vector<Plane_3> plane_vector(std::begin(planes), std::end(planes));
+    const std::size_t nb_planes = plane_vector.size();
+    if (nb_planes == 0)
+      return out;
+
+    typename Traits::Compute_a_3 compute_a = m_traits.compute_a_3_object();
+    typename Traits::Compute_b_3 compute_b = m_traits.compute_b_3_object();
+    typename Traits::Compute_c_3 compute_c = m_traits.compute_c_3_object();
+    typename Traits::Compute_d_3 compute_d = m_traits.compute_d_3_object();
+
+    const FT a = compute_a(plane_vector[0]), b = compute_b(plane_vector[0]), c = compute_c(plane_vector[0]);
+    for (const Plane_3& plane : plane_vector)
     {
-      vdp.second=add_vertex(al_graph);
-      al_graph[vdp.second]=vdp.first;
+      CGAL_precondition(!plane.is_degenerate());
+      CGAL_precondition(compute_a(plane) == a && compute_b(plane) == b && compute_c(plane) == c);
     }
 
-    Compare_face less_face(m_tmesh);
-    AL_edge_map al_edge_map( less_face );
-
-    // Filter coplanar edges: we consider only coplanar edges incident to one non-coplanar facet
-    //   for each such edge, add the corresponding nodes in the adjacency-list graph as well as
-    //   the edge
-    for(const edge_descriptor ed : all_coplanar_edges)
+    // The height of a point `p` is `a*p.x() + b*p.y() + c*p.z()`, and the height of the plane `i` is `-d_i`.
+    // The planes are sorted by increasing heights, and the heights are approximated with intervals, so that
+    // an edge is given to all the planes that it might intersect.
+    std::vector<std::size_t> sorted_planes(nb_planes);
+    std::iota(sorted_planes.begin(), sorted_planes.end(), std::size_t(0));
+    std::sort(sorted_planes.begin(), sorted_planes.end(),
+              [&](std::size_t i, std::size_t j)
+              {
+                return compute_d(plane_vector[j]) < compute_d(plane_vector[i]);
+              });
+
+    std::vector<double> plane_height_inf(nb_planes), plane_height_sup(nb_planes);
+    std::vector<edge_descriptor> mesh_edges(edges(m_tmesh).first, edges(m_tmesh).second);
+    std::vector<std::pair<std::size_t, std::size_t> > edge_plane_ranges(mesh_edges.size());
+    std::vector<std::size_t> edge_offsets(nb_planes + 1, 0);
     {
-      if (  face(halfedge(ed, m_tmesh), m_tmesh)==graph_traits::null_face() ||
-            opposite_face(ed)==graph_traits::null_face()  ||
-            !all_coplanar_edges.count( next_edge(ed) ) ||
-            !all_coplanar_edges.count( next_of_opposite_edge(ed) ) )
+      Protect_FPU_rounding<true> protection;
+      for (std::size_t i=0; i<nb_planes; ++i)
       {
-        typename Vertices_map::iterator it_insert1, it_insert2;
-        bool is_new;
+        const Interval h = - Interval(to_interval(compute_d(plane_vector[sorted_planes[i]])));
+        plane_height_inf[i] = h.inf();
+        plane_height_sup[i] = h.sup();
+      }
 
-        // Each coplanar edge is connecting two nodes
-        //  handle source
-        std::tie(it_insert1, is_new) =
-          vertices.insert(
-              Vertex_pair(
-                source(ed,m_tmesh), AL_graph::null_vertex()
-              )
-          );
-        if (is_new)
-        {
-          it_insert1->second=add_vertex(al_graph);
-          al_graph[it_insert1->second]=it_insert1->first;
-        }
-        //  handle target
-        std::tie(it_insert2, is_new) =
-          vertices.insert(
-              Vertex_pair(
-                target(ed,m_tmesh), AL_graph::null_vertex()
-              )
-          );
-        if (is_new)
-        {
-          it_insert2->second=add_vertex(al_graph);
-          al_graph[it_insert2->second]=it_insert2->first;
-        }
-        // add the edge into the adjacency-list graph
-        CGAL_assertion( it_insert1->second!=AL_graph::null_vertex() );
-        CGAL_assertion( it_insert2->second!=AL_graph::null_vertex() );
-        add_edge(it_insert1->second, it_insert2->second, al_graph);
+      const Interval ia(to_interval(a)), ib(to_interval(b)), ic(to_interval(c));
+      auto height = [&](vertex_descriptor v)
+      {
+        const Point_3& p = get(m_vpmap, v);
+        return ia * Interval(to_interval(p.x())) + ib * Interval(to_interval(p.y())) + ic * Interval(to_interval(p.z()));
+      };
+
+      // For each edge, the range of the (sorted) planes it might intersect
+      for (std::size_t ei=0; ei<mesh_edges.size(); ++ei)
+      {
+        const Interval hs = height(source(mesh_edges[ei], m_tmesh)),
+                       ht = height(target(mesh_edges[ei], m_tmesh));
+        const double hmin = (std::min)(hs.inf(), ht.inf()),
+                     hmax = (std::max)(hs.sup(), ht.sup());
+
+        const std::size_t first = std::lower_bound(plane_height_sup.begin(), plane_height_sup.end(), hmin) - plane_height_sup.begin();
+        const std::size_t last = std::upper_bound(plane_height_inf.begin(), plane_height_inf.end(), hmax) - plane_height_inf.begin();
+        edge_plane_ranges[ei] = std::make_pair(first, last);
+        for (std::size_t i=first; i<last; ++i)
+          ++edge_offsets[i+1];
       }
-    }
+    } // end of the rounding mode protection
 
-    // for each edge intersected in its interior, creates a node in
-    // an adjacency-list graph and put an edge between two such nodes
-    // when the corresponding edges shares a common face
-    for(edge_descriptor ed : iedges)
+    // Distribute the edges among the planes: the edges of the plane `i` are
+    // `plane_edges[edge_offsets[i]]`, ..., `plane_edges[edge_offsets[i+1]-1]`
+    std::partial_sum(edge_offsets.begin(), edge_offsets.end(), edge_offsets.begin());
+    std::vector<edge_descriptor> plane_edges(edge_offsets.back());
     {
-      AL_vertex_descriptor vd=add_vertex(al_graph);
-      al_graph[vd]=ed;
-      update_al_graph_connectivity(ed, vd, al_edge_map, al_graph);
+      std::vector<std::size_t> positions(edge_offsets.begin(), edge_offsets.end() - 1);
+      for (std::size_t ei=0; ei<mesh_edges.size(); ++ei)
+        for (std::size_t i=edge_plane_ranges[ei].first; i<edge_plane_ranges[ei].second; ++i)
+          plane_edges[positions[i]++] = mesh_edges[ei];
     }
 
-    // If one of the node above is not connected in its two incident faces
-    // then it must be connected to a vertex (including those in the set
-    // of coplanar edges)
-    typedef std::pair<halfedge_descriptor, AL_vertex_pair> Halfedge_and_vertices;
-    for(Halfedge_and_vertices hnv :al_edge_map)
-    {
-      if (hnv.second.second==AL_graph::null_vertex())
+    // Compute the polylines of each plane
+    std::vector<std::vector<Polyline> > polylines(nb_planes);
+    CGAL::for_each<ConcurrencyTag>(
+      CGAL::make_counting_range<std::size_t>(0, nb_planes),
+      [&](const std::size_t i) -> bool
       {
-        //get the edge and test opposite vertices (if the edge is not on the boundary)
-        vertex_descriptor vd = target( next(hnv.first, m_tmesh), m_tmesh);
-        typename Vertices_map::iterator itv=vertices.find(vd);
-        CGAL_assertion( itv!=vertices.end() );
-        add_edge(itv->second, hnv.second.first, al_graph);
-      }
-    }
+        const Plane_3& plane = plane_vector[sorted_planes[i]];
 
-    CGAL_assertion(num_vertices(al_graph)==iedges.size()+vertices.size());
+        std::set<edge_descriptor> all_coplanar_edges;
+        std::vector<edge_descriptor> iedges;
+        Vertices_map vertices;
 
-    // now assemble the edges of al_graph to define polylines,
-    // putting them in the output iterator
-    if (!UseParallelPlaneOptimization || app_info.first==-1)
-    {
-      Polyline_visitor<OutputIterator, Traits> visitor(m_tmesh, al_graph, plane, m_vpmap, m_traits, out);
-      split_graph_into_polylines(al_graph, visitor);
-      return visitor.out;
-    }
-    else
-    {
-      typedef Polygon_mesh_slicer_::Axis_parallel_plane_traits<Traits> App_traits;
-      App_traits app_traits(app_info.first, app_info.second, m_traits);
+        std::pair<int, FT> app_info = axis_parallel_plane_info(plane);
+        if (!UseParallelPlaneOptimization || app_info.first==-1)
+        {
+          General_traversal_traits ttraits(all_coplanar_edges, iedges, vertices,
+                                           m_tmesh, m_vpmap, m_tree_ptr->traits(), m_traits);
+          for (std::size_t k=edge_offsets[i]; k<edge_offsets[i+1]; ++k)
+            ttraits.intersection(plane, plane_edges[k]);
+        }
+        else
+        {
+          Polygon_mesh_slicer_::Axis_parallel_plane_traits<Traits>
+            traits(app_info.first, app_info.second, m_traits);
+          Axis_parallel_traversal_traits ttraits(all_coplanar_edges, iedges, vertices,
+                                                 m_tmesh, m_vpmap, m_tree_ptr->traits(), traits);
+          for (std::size_t k=edge_offsets[i]; k<edge_offsets[i+1]; ++k)
+            ttraits.intersection(plane, plane_edges[k]);
+        }
 
-      Polyline_visitor<OutputIterator, App_traits> visitor
-        (m_tmesh, al_graph, plane, m_vpmap, app_traits, out);
-      split_graph_into_polylines(al_graph, visitor);
-      return visitor.out;
-    }
+        polylines_from_intersected_edges(plane, app_info, all_coplanar_edges, iedges, vertices,
+                                         std::back_inserter(polylines[sorted_planes[i]]));
+        return true;
+      });
+
+    for (std::vector<Polyline>& plane_polylines : polylines)
+      *out++ = std::move(plane_polylines);
+
+    return out;
   }
 
   ~Polygon_mesh_slicer()
@@ -25,6 +25,13 @@
 #include <CGAL/AABB_tree.h>
 #include <CGAL/AABB_traits_3.h>
 #include <CGAL/boost/graph/helpers.h>
+#include <CGAL/for_each.h>
+#include <CGAL/property_map.h>
+#include <CGAL/tags.h>
+
+#include <algorithm>
+#include <type_traits>
+#include <vector>
 
 namespace CGAL {
 
@@ -244,34 +251,47 @@ public:
     }
     else
     {
-#ifdef CGAL_HAS_THREADS
-      AABB_tree_* tree_ptr =
-        const_cast<AABB_tree_*>(atomic_tree_ptr.load(std::memory_order_acquire));
-#endif
-      // Lazily build the tree only when needed
-      if (tree_ptr==nullptr)
-      {
-#ifdef CGAL_HAS_THREADS
-        CGAL_SCOPED_LOCK(tree_mutex);
-        tree_ptr = const_cast<AABB_tree_*>(atomic_tree_ptr.load(std::memory_order_relaxed));
-#endif
-        CGAL_assertion(tm_ptr != nullptr && opt_vpm!=std::nullopt);
-        if (tree_ptr==nullptr)
-        {
-          tree_ptr = new AABB_tree(faces(*tm_ptr).first,
-                                   faces(*tm_ptr).second,
-                                   *tm_ptr, *opt_vpm);
-          const_cast<AABB_tree_*>(tree_ptr)->build();
-#ifdef CGAL_HAS_THREADS
-        atomic_tree_ptr.store(tree_ptr, std::memory_order_release);
-#endif
-        }
-      }
       return internal::Point_inside_vertical_ray_cast<GeomTraits, AABB_tree>()(
-            point, *tree_ptr, ray_functor, vector_functor);
+            point, tree(), ray_functor, vector_functor);
     }
   }
 
+  /**
+   * computes the location of each point of `points`, and puts it in `out`.
+   * This is equivalent to calling `operator()` for each point, but the points can be
+   * located concurrently.
+   *
+   * @tparam ConcurrencyTag enables sequential versus parallel location of the points.
+   *         Possible values are `Sequential_tag` (the default), `Parallel_if_available_tag`, and `Parallel_tag`.
+   * @tparam PointRange a model of `ConstRange` with `GeomTraits::Point_3` as value type
+   * @tparam OutputIterator a model of `OutputIterator` accepting values of type `CGAL::Bounded_side`
+   *
+   * @param points the query points
+   * @param out the output iterator, in which the locations of the points are put, following the order of `points`
+   *
+   * @return the output iterator
+   */
+  template <class ConcurrencyTag = Sequential_tag, class PointRange, class OutputIterator>
+  OutputIterator classify(const PointRange& points, OutputIterator out) const
+  {
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
+    const std::vector<Point> query_points(std::begin(points), std::end(points));
+    std::vector<Bounded_side> locations(query_points.size());
+    CGAL::for_each<ConcurrencyTag>(
+      CGAL::make_counting_range<std::size_t>(0, query_points.size()),
+      [&](const std::size_t i) -> bool
+      {
+        locations[i] = (*this)(query_points[i]);
+        return true;
+      });
+
+    return std::copy(locations.begin(), locations.end(), out);
+  }
+
 #ifndef DOXYGEN_RUNNING
   template <class K2>
   Bounded_side operator()(const typename K2::Point_3& point, const K2& k2) const
@@ -286,29 +306,7 @@ public:
       return CGAL::ON_UNBOUNDED_SIDE;
     }
 
-#ifdef CGAL_HAS_THREADS
-    AABB_tree_* tree_ptr =
-      const_cast<AABB_tree_*>(atomic_tree_ptr.load(std::memory_order_acquire));
-#endif
-    // Lazily build the tree only when needed
-    if (tree_ptr==nullptr)
-    {
-#ifdef CGAL_HAS_THREADS
-      CGAL_SCOPED_LOCK(tree_mutex);
-      tree_ptr = const_cast<AABB_tree_*>(atomic_tree_ptr.load(std::memory_order_relaxed));
-#endif
-      CGAL_assertion(tm_ptr != nullptr && opt_vpm!=std::nullopt);
-      if (tree_ptr==nullptr)
-      {
-        tree_ptr = new AABB_tree(faces(*tm_ptr).first,
-                                 faces(*tm_ptr).second,
-                                 *tm_ptr, *opt_vpm);
-        const_cast<AABB_tree_*>(tree_ptr)->build();
-#ifdef CGAL_HAS_THREADS
-      atomic_tree_ptr.store(tree_ptr, std::memory_order_release);
-#endif
-      }
-    }
+    const AABB_tree& tree = this->tree();
 
     typedef typename Kernel_traits<Point>::Kernel K1;
     typedef typename AABB_tree::AABB_traits AABB_traits;
@@ -329,9 +327,9 @@ public:
           status( boost::logic::tribool(boost::logic::indeterminate), 0);
 
       internal::K2_Ray_3_K1_Triangle_3_traversal_traits<AABB_traits, K1, K2, Helper>
-        traversal_traits(status, tree_ptr->traits(), helper);
+        traversal_traits(status, tree.traits(), helper);
 
-      tree_ptr->traversal(query, traversal_traits);
+      tree.traversal(query, traversal_traits);
 
       if ( !boost::logic::indeterminate(status.first) )
       {
@@ -346,6 +344,34 @@ public:
 
 #endif
 
+private:
+  // lazily builds the tree, only when needed
+  const AABB_tree& tree() const
+  {
+#ifdef CGAL_HAS_THREADS
+    AABB_tree_* tree_ptr =
+      const_cast<AABB_tree_*>(atomic_tree_ptr.load(std::memory_order_acquire));
+#endif
+    if (tree_ptr==nullptr)
+    {
+#ifdef CGAL_HAS_THREADS
+      CGAL_SCOPED_LOCK(tree_mutex);
+      tree_ptr = const_cast<AABB_tree_*>(atomic_tree_ptr.load(std::memory_order_relaxed));
+#endif
+      CGAL_assertion(tm_ptr != nullptr && opt_vpm!=std::nullopt);
+      if (tree_ptr==nullptr)
+      {
+        tree_ptr = new AABB_tree(faces(*tm_ptr).first,
+                                 faces(*tm_ptr).second,
+                                 *tm_ptr, *opt_vpm);
+        const_cast<AABB_tree_*>(tree_ptr)->build();
+#ifdef CGAL_HAS_THREADS
+        atomic_tree_ptr.store(tree_ptr, std::memory_order_release);
+#endif
+      }
+    }
+    return *tree_ptr;
+  }
 };
 
 } // namespace CGAL
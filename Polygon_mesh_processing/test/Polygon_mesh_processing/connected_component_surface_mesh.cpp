@@ -7,9 +7,11 @@
 
 #include <boost/property_map/function_property_map.hpp>
 
+#include <algorithm>
 #include <iostream>
 #include <fstream>
 #include <cstring>
+#include <vector>
 
 namespace PMP = CGAL::Polygon_mesh_processing;
 
@@ -217,6 +219,70 @@ void test_CC_with_area_size_map(Mesh sm,
   }
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+void test_parallel_CC(const Mesh& sm,
+                      const Kernel& k)
+{
+  std::cout << " -- test with Parallel_tag -- " << std::endl;
+
+  typedef boost::graph_traits<Mesh>::face_descriptor                      face_descriptor;
+
+  const Kernel::FT bound = std::cos(0.7 * CGAL_PI);
+
+  // many small components, interleaved with the input mesh
+  Mesh m = sm;
+  for(int i=0; i<500; ++i)
+  {
+    Point p(3*i,0,0), q(3*i+1,0,0), r(3*i,1,0), s(3*i,0,1);
+    CGAL::make_tetrahedron(p,q,r,s,m);
+    if(i % 7 == 0)
+      CGAL::make_triangle(p,q,s,m);
+  }
+
+  // same component ids as the sequential version
+  Mesh::Property_map<face_descriptor,std::size_t> seq_ccmap, par_ccmap;
+  seq_ccmap = m.add_property_map<face_descriptor, std::size_t>("f:CC_seq").first;
+  par_ccmap = m.add_property_map<face_descriptor, std::size_t>("f:CC_par").first;
+
+  std::size_t num_seq = PMP::connected_components(m, seq_ccmap);
+  std::size_t num_par = PMP::connected_components(m, par_ccmap,
+                                                  CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()));
+  assert(num_seq == num_par);
+  assert(num_seq == 3 + 500 + 72);
+  for(face_descriptor f : faces(m))
+    assert(seq_ccmap[f] == par_ccmap[f]);
+
+  num_seq = PMP::connected_components(m, seq_ccmap,
+                                      CGAL::parameters::edge_is_constrained_map(Constraint<Mesh, Kernel>(m, k, bound)));
+  num_par = PMP::connected_components(m, par_ccmap,
+                                      CGAL::parameters::edge_is_constrained_map(Constraint<Mesh, Kernel>(m, k, bound))
+                                                       .concurrency_tag(CGAL::Parallel_tag()));
+  assert(num_seq == num_par);
+  for(face_descriptor f : faces(m))
+    assert(seq_ccmap[f] == par_ccmap[f]);
+
+  // splitting
+  std::vector<Mesh> seq_meshes, par_meshes;
+  PMP::split_connected_components(m, seq_meshes);
+  PMP::split_connected_components(m, par_meshes, CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()));
+  assert(seq_meshes.size() == par_meshes.size());
+  for(std::size_t i=0; i<seq_meshes.size(); ++i)
+  {
+    assert(num_vertices(seq_meshes[i]) == num_vertices(par_meshes[i]));
+    assert(num_faces(seq_meshes[i]) == num_faces(par_meshes[i]));
+    assert(std::equal(seq_meshes[i].points().begin(), seq_meshes[i].points().end(),
+                      par_meshes[i].points().begin(), par_meshes[i].points().end()));
+  }
+
+  // removing components
+  Mesh copy = m;
+  PMP::keep_largest_connected_components(m, 10);
+  PMP::keep_largest_connected_components(copy, 10, CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()));
+  assert(num_vertices(m) == num_vertices(copy));
+  assert(num_faces(m) == num_faces(copy));
+}
+#endif
+
 int main(int /*argc*/, char** /*argv*/)
 {
   const std::string filename = CGAL::data_file_path("meshes/blobby_3cc.off");
@@ -231,6 +297,9 @@ int main(int /*argc*/, char** /*argv*/)
 
   test_CC_with_default_size_map(sm, k);
   test_CC_with_area_size_map(sm, k);
+#ifdef CGAL_LINKED_WITH_TBB
+  test_parallel_CC(sm, k);
+#endif
 
   return EXIT_SUCCESS;
 }
@@ -10,6 +10,7 @@
 #include <iostream>
 #include <fstream>
 #include <iterator>
+#include <set>
 
 typedef CGAL::Exact_predicates_exact_constructions_kernel Epec;
 typedef CGAL::Exact_predicates_inexact_constructions_kernel Epic;
@@ -61,12 +62,72 @@ void test_polyhedron(const std::string filename, const K&, const bool save_outpu
   faired_off.close();
 }
 
+// fairs a region with a Fairing_system, then moves the fixed vertices and fairs the region again
+template <typename ConcurrencyTag>
+void test_fairing_system(const std::string filename)
+{
+  typedef CGAL::Surface_mesh<Epic::Point_3> Mesh;
+  typedef Mesh::Vertex_index Vertex_index;
+
+  Mesh mesh;
+  std::ifstream input(filename);
+  if (!input || !(input >> mesh))
+  {
+    std::cerr << "Error: cannot read mesh : " << filename << "\n";
+    assert(false);
+    return;
+  }
+
+  // the vertices at distance at most 2 from a vertex
+  std::set<Vertex_index> region;
+  region.insert(Vertex_index(142));
+  for (int i=0; i<2; ++i)
+  {
+    std::set<Vertex_index> ring = region;
+    for (Vertex_index v : ring)
+      for (Vertex_index nv : vertices_around_target(v, mesh))
+        region.insert(nv);
+  }
+
+  Mesh reference = mesh;
+  bool ok = CGAL::Polygon_mesh_processing::fair(reference, region);
+  assert(ok);
+
+  CGAL::Polygon_mesh_processing::Fairing_system<Mesh> fairing(mesh, region,
+    CGAL::parameters::concurrency_tag(ConcurrencyTag()));
+  assert(fairing.is_factorized());
+  ok = fairing.fair();
+  assert(ok);
+  for (Vertex_index v : vertices(mesh))
+    assert(CGAL::squared_distance(mesh.point(v), reference.point(v)) < 1e-20);
+
+  // the system is invariant by translation
+  const Epic::Vector_3 t(0.5, -0.25, 1.);
+  for (Vertex_index v : vertices(mesh))
+    if (region.count(v) == 0)
+      mesh.point(v) = mesh.point(v) + t;
+
+  CGAL::Timer timer;
+  timer.start();
+  ok = fairing.fair();
+  timer.stop();
+  assert(ok);
+  std::cout << "Fairing again with a factorized system: " << timer.time() << " sec." << std::endl;
+  for (Vertex_index v : region)
+    assert(CGAL::squared_distance(mesh.point(v), reference.point(v) + t) < 1e-10);
+}
+
 int main()
 {
   const std::string filename = CGAL::data_file_path("meshes/elephant.off");
     test_polyhedron(filename, Epic(), false);
     test_polyhedron(filename, Epec(), false);
 
+  test_fairing_system<CGAL::Sequential_tag>(filename);
+#ifdef CGAL_LINKED_WITH_TBB
+  test_fairing_system<CGAL::Parallel_tag>(filename);
+#endif
+
   std::cerr << "All done." << std::endl;
 
   return 0;
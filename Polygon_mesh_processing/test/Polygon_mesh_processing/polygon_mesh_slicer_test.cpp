@@ -18,6 +18,7 @@
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 #include <CGAL/Exact_predicates_exact_constructions_kernel.h>
 
+#include <algorithm>
 #include <fstream>
 #include <cassert>
 
@@ -170,10 +171,91 @@ int test_slicer()
 }
 
 
+// checks that slicing with several planes at once gives the same polylines as slicing plane by plane
+template <class K, class Tag, class Slicer>
+void test_batched_slice(const Slicer& slicer,
+                        const std::vector<typename K::Plane_3>& planes)
+{
+  typedef std::vector<typename K::Point_3> Polyline_type;
+  typedef std::vector< Polyline_type > Polylines;
+
+  std::vector<Polylines> layers;
+  slicer.template slice<Tag>(planes, std::back_inserter(layers));
+  assert(layers.size() == planes.size());
+
+  for(std::size_t i=0; i<planes.size(); ++i)
+  {
+    Polylines expected;
+    slicer(planes[i], std::back_inserter(expected));
+    assert(layers[i].size() == expected.size());
+
+    // polylines might be reported in a different order, and closed polylines from a different starting point
+    auto collect_points = [](const Polylines& polylines)
+    {
+      std::vector<typename K::Point_3> pts;
+      for(const Polyline_type& polyline : polylines)
+      {
+        const bool closed = polyline.size() > 1 && polyline.front() == polyline.back();
+        pts.insert(pts.end(), polyline.begin(), closed ? polyline.end() - 1 : polyline.end());
+      }
+      return pts;
+    };
+    std::vector<typename K::Point_3> pts = collect_points(layers[i]),
+                                     expected_pts = collect_points(expected);
+    std::sort(pts.begin(), pts.end());
+    std::sort(expected_pts.begin(), expected_pts.end());
+    assert(pts == expected_pts);
+  }
+}
+
+template <typename K, typename Tag>
+void test_batched_slicer()
+{
+#ifdef USE_SURFACE_MESH
+  typedef CGAL::Surface_mesh<typename K::Point_3> Mesh;
+#else
+  typedef CGAL::Polyhedron_3<K> Mesh;
+#endif
+  typedef typename K::Plane_3 Plane_3;
+
+  std::ifstream input("data_slicer/open_cube_meshed.off");
+  Mesh m;
+  assert(input && (input >> m));
+
+  CGAL::Polygon_mesh_slicer<Mesh, K> slicer(m);
+
+  // axis-parallel planes, unsorted, with coplanar edges, isolated vertices, and empty layers
+  std::vector<Plane_3> planes;
+  for(int i=-12; i<=12; ++i)
+    planes.push_back(Plane_3(0,1,0, 0.125 * ((i * 7) % 13)));
+  planes.push_back(Plane_3(0,1,0,0));
+  planes.push_back(Plane_3(0,1,0,333));
+  test_batched_slice<K, Tag>(slicer, planes);
+
+  planes.clear();
+  for(int i=-10; i<=10; ++i)
+    planes.push_back(Plane_3(0,0,-1, 0.1 * i));
+  test_batched_slice<K, Tag>(slicer, planes);
+
+  // generic planes
+  planes.clear();
+  for(int i=0; i<50; ++i)
+    planes.push_back(Plane_3(1,2,3, 0.1 * (i - 25)));
+  test_batched_slice<K, Tag>(slicer, planes);
+
+  // no plane
+  test_batched_slice<K, Tag>(slicer, std::vector<Plane_3>());
+}
+
 int main()
 {
   assert(test_slicer<Epic>() == 0);
   assert(test_slicer<Epec>() == 0);
 
+  test_batched_slicer<Epic, CGAL::Sequential_tag>();
+#ifdef CGAL_LINKED_WITH_TBB
+  test_batched_slicer<Epic, CGAL::Parallel_tag>();
+#endif
+
   return 0;
 }
@@ -12,6 +12,7 @@
 #include <CGAL/Polygon_mesh_processing/connected_components.h>
 #include <CGAL/Polygon_mesh_processing/self_intersections.h>
 #include <CGAL/Polygon_mesh_processing/detect_features.h>
+#include <CGAL/Polygon_mesh_processing/measure.h>
 
 #include <CGAL/Surface_mesh.h>
 
@@ -20,6 +21,8 @@
 #include <CGAL/Timer.h>
 
 #include <fstream>
+#include <limits>
+#include <tuple>
 #include <vector>
 #include <cstdlib>
 #include <cstring>
@@ -298,6 +301,59 @@ Main(int argc, const char* argv[])
     std::cout << "done." << std::endl;
   }
 
+#ifdef CGAL_LINKED_WITH_TBB
+  {
+    std::cout << "Start parallel remeshing of " << filename << std::endl;
+    std::ifstream input_par(filename);
+    Mesh m_seq, m_par;
+    input_par >> m_seq;
+    m_par = m_seq;
+
+    PMP::isotropic_remeshing(faces(m_seq), target_edge_length, m_seq,
+      CGAL::parameters::number_of_iterations(nb_iter));
+
+    t.reset();
+    t.start();
+    PMP::isotropic_remeshing(faces(m_par), target_edge_length, m_par,
+      CGAL::parameters::number_of_iterations(nb_iter)
+      .concurrency_tag(CGAL::Parallel_tag()));
+    t.stop();
+    std::cout << "Parallel remeshing took " << t.time() << std::endl;
+
+    assert(CGAL::is_valid_polygon_mesh(m_par));
+    assert(CGAL::is_triangle_mesh(m_par));
+    assert(!PMP::does_self_intersect(m_par));
+    // flips are not done in the same order, but the sizes should be close
+    assert(num_faces(m_par) > 0.9 * num_faces(m_seq));
+    assert(num_faces(m_par) < 1.1 * num_faces(m_seq));
+
+    // the edge lengths are in the same range as with the sequential version
+    auto edge_length_range = [](const Mesh& mesh)
+    {
+      double min_l = (std::numeric_limits<double>::max)(), max_l = 0., sum_l = 0.;
+      std::size_t nb_edges = 0;
+      for(edge_descriptor e : edges(mesh))
+      {
+        const double l = CGAL::to_double(PMP::edge_length(e, mesh));
+        min_l = (std::min)(min_l, l);
+        max_l = (std::max)(max_l, l);
+        sum_l += l;
+        ++nb_edges;
+      }
+      return std::make_tuple(min_l, max_l, sum_l / nb_edges);
+    };
+    double min_seq, max_seq, mean_seq, min_par, max_par, mean_par;
+    std::tie(min_seq, max_seq, mean_seq) = edge_length_range(m_seq);
+    std::tie(min_par, max_par, mean_par) = edge_length_range(m_par);
+    std::cout << "Edge lengths (min/max/mean) for a target of " << target_edge_length << ": sequential " << min_seq << " / " << max_seq << " / " << mean_seq
+              << ", parallel " << min_par << " / " << max_par << " / " << mean_par << std::endl;
+    assert(mean_par > 0.8 * target_edge_length && mean_par < 4./3. * target_edge_length);
+    assert(mean_par > 0.95 * mean_seq && mean_par < 1.05 * mean_seq);
+    assert(min_par > 0.5 * min_seq);
+    assert(max_par < 2. * max_seq);
+  }
+#endif
+
   if (save_file != nullptr)
   {
     std::ofstream out("remeshed.off");
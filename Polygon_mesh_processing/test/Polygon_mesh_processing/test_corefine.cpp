@@ -1,4 +1,5 @@
 #include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/orientation.h>
 
 #include <CGAL/Surface_mesh.h>
 #include <CGAL/Polyhedron_3.h>
@@ -145,6 +146,57 @@ void test_no_modifications(const char* f1, const char* f2)
   assert(Q.is_valid());
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+void test_parallel(const char* f1, const char* f2)
+{
+  std::cout << "Corefining " << f1
+            << " and " << f2 << " in parallel\n";
+
+  Surface_mesh sm1, sm2;
+  std::ifstream input(f1);
+  assert(input);
+  input >> sm1;
+  input.close();
+  input.open(f2);
+  assert(input);
+  input >> sm2;
+  input.close();
+
+  Surface_mesh sm1_par = sm1, sm2_par = sm2;
+  My_visitor<Surface_mesh> seq_v, par_v;
+  CGAL::Polygon_mesh_processing::corefine(sm1, sm2,
+    CGAL::parameters::visitor(seq_v));
+  CGAL::Polygon_mesh_processing::corefine(sm1_par, sm2_par,
+    CGAL::parameters::visitor(par_v).concurrency_tag(CGAL::Parallel_tag()));
+
+  assert(sm1_par.is_valid());
+  assert(sm2_par.is_valid());
+  assert(*(seq_v.i) == *(par_v.i));
+  assert(num_vertices(sm1) == num_vertices(sm1_par));
+  assert(num_vertices(sm2) == num_vertices(sm2_par));
+  assert(num_faces(sm1) == num_faces(sm1_par));
+  assert(num_faces(sm2) == num_faces(sm2_par));
+
+  // Boolean operations (on the already corefined meshes)
+  if (!CGAL::is_closed(sm1) || !CGAL::is_closed(sm2) ||
+      !CGAL::Polygon_mesh_processing::does_bound_a_volume(sm1) ||
+      !CGAL::Polygon_mesh_processing::does_bound_a_volume(sm2))
+    return;
+
+  Surface_mesh seq_out, par_out;
+  bool seq_ok = CGAL::Polygon_mesh_processing::corefine_and_compute_union(sm1, sm2, seq_out);
+  bool par_ok = CGAL::Polygon_mesh_processing::corefine_and_compute_union(sm1_par, sm2_par, par_out,
+                  CGAL::parameters::concurrency_tag(CGAL::Parallel_tag()));
+  assert(seq_ok == par_ok);
+  if (seq_ok)
+  {
+    assert(par_out.is_valid());
+    assert(num_vertices(seq_out) == num_vertices(par_out));
+    assert(num_faces(seq_out) == num_faces(par_out));
+  }
+}
+#endif
+
 int main(int argc, char** argv)
 {
   for(int i=0; i< (argc-1)/2;++i)
@@ -152,5 +204,8 @@ int main(int argc, char** argv)
     test(argv[2*i+1], argv[2*(i+1)]);
     test(argv[2*(i+1)], argv[2*i+1]);
     test_no_modifications(argv[2*(i+1)], argv[2*i+1]);
+#ifdef CGAL_LINKED_WITH_TBB
+    test_parallel(argv[2*i+1], argv[2*(i+1)]);
+#endif
   }
 }
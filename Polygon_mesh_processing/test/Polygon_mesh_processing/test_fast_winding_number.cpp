@@ -0,0 +1,123 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/Fast_winding_number.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/Side_of_triangle_mesh.h>
+#include <CGAL/Random.h>
+
+#include <cmath>
+#include <iostream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel     K;
+typedef K::Point_3                                              Point_3;
+typedef CGAL::Surface_mesh<Point_3>                             Mesh;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+std::vector<Point_3> random_points(const Mesh& mesh, std::size_t n, CGAL::Random& rnd)
+{
+  const CGAL::Bbox_3 bb = PMP::bbox(mesh);
+  std::vector<Point_3> points;
+  for(std::size_t i=0; i<n; ++i)
+    points.push_back(Point_3(rnd.uniform_real<double>(bb.xmin(), bb.xmax()),
+                             rnd.uniform_real<double>(bb.ymin(), bb.ymax()),
+                             rnd.uniform_real<double>(bb.zmin(), bb.zmax())));
+  return points;
+}
+
+template <class Tag>
+void test_closed_mesh(const Mesh& mesh, const std::vector<Point_3>& points)
+{
+  std::cout << "  closed mesh" << std::endl;
+
+  CGAL::Side_of_triangle_mesh<Mesh, K> side_of(mesh);
+  std::vector<CGAL::Bounded_side> expected;
+  side_of.classify<Tag>(points, std::back_inserter(expected));
+  assert(expected.size() == points.size());
+  for(std::size_t i=0; i<points.size(); ++i)
+    assert(expected[i] == side_of(points[i]));
+
+  PMP::Fast_winding_number<Mesh> fwn(mesh);
+  std::vector<double> approximated;
+  fwn.winding_numbers<Tag>(points, std::back_inserter(approximated));
+
+  // nothing is approximated with a large enough accuracy
+  PMP::Fast_winding_number<Mesh> exact_wn(mesh);
+  exact_wn.set_accuracy(1e10);
+  std::vector<double> exact;
+  exact_wn.winding_numbers<Tag>(points, std::back_inserter(exact));
+
+  std::vector<CGAL::Bounded_side> sides;
+  fwn.classify<Tag>(points, std::back_inserter(sides));
+
+  double max_error = 0.;
+  std::size_t nb_mismatches = 0;
+  for(std::size_t i=0; i<points.size(); ++i)
+  {
+    // the exact winding number is an integer for a closed mesh
+    const double expected_wn = (expected[i] == CGAL::ON_BOUNDED_SIDE) ? 1. : 0.;
+    assert(std::abs(exact[i] - expected_wn) < 1e-6);
+
+    max_error = (std::max)(max_error, std::abs(approximated[i] - exact[i]));
+    assert(sides[i] == fwn(points[i]));
+    if(sides[i] != expected[i])
+      ++nb_mismatches;
+  }
+  std::cout << "  maximum error " << max_error << ", " << nb_mismatches << " mismatches" << std::endl;
+  assert(max_error < 0.1);
+  assert(nb_mismatches == 0);
+}
+
+void test_open_mesh(const Mesh& closed_mesh, const Mesh& open_mesh, const std::vector<Point_3>& points)
+{
+  std::cout << "  mesh with holes" << std::endl;
+
+  CGAL::Side_of_triangle_mesh<Mesh, K> side_of(closed_mesh);
+  PMP::Fast_winding_number<Mesh> fwn(open_mesh);
+
+  std::size_t nb_agreements = 0;
+  for(const Point_3& p : points)
+    if(fwn(p) == side_of(p))
+      ++nb_agreements;
+
+  std::cout << "  " << nb_agreements << " / " << points.size() << " points classified as with the closed mesh" << std::endl;
+  assert(nb_agreements > 0.98 * points.size());
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+  const std::string open_filename = (argc > 2) ? argv[2] : CGAL::data_file_path("meshes/elephant-with-holes.off");
+
+  Mesh mesh, open_mesh;
+  if(!PMP::IO::read_polygon_mesh(filename, mesh) || !CGAL::is_triangle_mesh(mesh) ||
+     !PMP::IO::read_polygon_mesh(open_filename, open_mesh) || !CGAL::is_triangle_mesh(open_mesh))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  CGAL::Random rnd(0);
+  const std::vector<Point_3> points = random_points(mesh, 5000, rnd);
+
+  std::cout << "Sequential" << std::endl;
+  test_closed_mesh<CGAL::Sequential_tag>(mesh, points);
+  test_open_mesh(mesh, open_mesh, points);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel" << std::endl;
+  test_closed_mesh<CGAL::Parallel_tag>(mesh, points);
+#endif
+
+  // empty mesh
+  PMP::Fast_winding_number<Mesh> empty_fwn((Mesh()));
+  assert(empty_fwn.winding_number(CGAL::ORIGIN) == 0.);
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -1117,6 +1117,92 @@ void test_early_quit(const std::string& filepath,
   std::cout << "* timed 0.5 > 0.4; time: " << timed << std::endl;
 }
 
+void test_progressive_bounds(const std::string& filepath,
+                             const double error_bound)
+{
+  std::cout << std::endl << "-- test progressive bounds:" << std::endl << std::endl;
+
+  Surface_mesh mesh1, mesh2;
+  get_meshes(filepath, filepath, mesh1, mesh2);
+
+  PMP::random_perturbation(mesh2, 0.01, CGAL::parameters::random_seed(0));
+
+  std::vector<std::pair<double, double> > full_bounds;
+  const double full_dist = PMP::bounded_error_Hausdorff_distance<TAG>(
+    mesh1, mesh2, error_bound,
+    CGAL::parameters::match_faces(false)
+                     .callback([&](double lower, double upper)
+                               {
+                                 full_bounds.emplace_back(lower, upper);
+                                 return true;
+                               }),
+    CGAL::parameters::match_faces(false));
+
+  assert(!full_bounds.empty());
+  for(std::size_t i=0; i<full_bounds.size(); ++i)
+  {
+    assert(full_bounds[i].first <= full_bounds[i].second);
+    assert(full_bounds[i].first <= full_dist);
+    if(i > 0)
+      assert(full_bounds[i-1].first <= full_bounds[i].first);
+  }
+
+  // Stop as soon as the bounds are within a coarser tolerance.
+  const double tolerance = 100 * error_bound;
+  std::vector<std::pair<double, double> > coarse_bounds;
+  const double coarse_dist = PMP::bounded_error_Hausdorff_distance<TAG>(
+    mesh1, mesh2, error_bound,
+    CGAL::parameters::match_faces(false)
+                     .callback([&](double lower, double upper)
+                               {
+                                 coarse_bounds.emplace_back(lower, upper);
+                                 return (upper - lower > tolerance);
+                               }),
+    CGAL::parameters::match_faces(false));
+
+  std::cout << "* full distance = " << full_dist << " (" << full_bounds.size() << " steps)" << std::endl;
+  std::cout << "* coarse distance = " << coarse_dist << " (" << coarse_bounds.size() << " steps)" << std::endl;
+
+  assert(coarse_bounds.size() <= full_bounds.size());
+  assert(coarse_dist <= full_dist + error_bound);
+  assert(full_dist - coarse_dist <= tolerance + error_bound);
+}
+
+#ifdef CGAL_LINKED_WITH_TBB
+void test_parallel_subdivision(const std::string& filepath,
+                               const double error_bound)
+{
+  std::cout << std::endl << "-- test parallel subdivision:" << std::endl << std::endl;
+
+  Surface_mesh mesh1, mesh2;
+  get_meshes(filepath, filepath, mesh1, mesh2);
+
+  PMP::random_perturbation(mesh2, 0.01, CGAL::parameters::random_seed(0));
+
+  // Without METIS, Parallel_tag refines the candidate triangles concurrently.
+  const double dista = PMP::bounded_error_Hausdorff_distance<CGAL::Sequential_tag>(
+    mesh1, mesh2, error_bound,
+    CGAL::parameters::match_faces(false),
+    CGAL::parameters::match_faces(false));
+  const double distb = PMP::bounded_error_Hausdorff_distance<CGAL::Parallel_tag>(
+    mesh1, mesh2, error_bound,
+    CGAL::parameters::match_faces(false),
+    CGAL::parameters::match_faces(false));
+  const double distc = PMP::bounded_error_symmetric_Hausdorff_distance<CGAL::Parallel_tag>(
+    mesh1, mesh2, error_bound);
+
+  std::cout << "* dist seq = " << dista << std::endl;
+  std::cout << "* dist par = " << distb << std::endl;
+  std::cout << "* symmetric dist par = " << distc << std::endl;
+
+  assert(CGAL::abs(dista - distb) <= error_bound);
+  assert(distc >= distb - error_bound);
+
+  assert(!PMP::is_Hausdorff_distance_larger<CGAL::Parallel_tag>(mesh1, mesh2, 2 * dista, error_bound));
+  assert(PMP::is_Hausdorff_distance_larger<CGAL::Parallel_tag>(mesh1, mesh2, 0.5 * dista, error_bound));
+}
+#endif // CGAL_LINKED_WITH_TBB
+
 void run_examples(const double error_bound,
                   const std::string& filepath)
 {
@@ -1178,6 +1264,14 @@ int main(int argc, char** argv)
   // --- Test early quit.
   test_early_quit(filepath);
 
+  // --- Test progressive bounds.
+  test_progressive_bounds(filepath, error_bound);
+
+#ifdef CGAL_LINKED_WITH_TBB
+  // --- Test parallel subdivision.
+  test_parallel_subdivision(filepath, error_bound);
+#endif // CGAL_LINKED_WITH_TBB
+
   std::cout << "Done!" << std::endl;
 
   return EXIT_SUCCESS;
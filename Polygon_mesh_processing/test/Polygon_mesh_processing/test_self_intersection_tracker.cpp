@@ -0,0 +1,206 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/Self_intersection_tracker.h>
+#include <CGAL/Polygon_mesh_processing/self_intersections.h>
+#include <CGAL/Polygon_mesh_processing/bbox.h>
+#include <CGAL/Polygon_mesh_processing/compute_normal.h>
+#include <CGAL/Polygon_mesh_processing/IO/polygon_mesh_io.h>
+#include <CGAL/boost/graph/copy_face_graph.h>
+#include <CGAL/boost/graph/Euler_operations.h>
+#include <CGAL/Random.h>
+
+#include <algorithm>
+#include <iostream>
+#include <iterator>
+#include <set>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel     K;
+typedef K::Point_3                                              Point_3;
+typedef K::Vector_3                                             Vector_3;
+typedef CGAL::Surface_mesh<Point_3>                             Mesh;
+typedef boost::graph_traits<Mesh>::vertex_descriptor            vertex_descriptor;
+typedef boost::graph_traits<Mesh>::halfedge_descriptor          halfedge_descriptor;
+typedef boost::graph_traits<Mesh>::face_descriptor              face_descriptor;
+typedef std::pair<face_descriptor, face_descriptor>             Face_pair;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+template <class FacePairRange>
+std::set<Face_pair> normalize(const FacePairRange& pairs)
+{
+  std::set<Face_pair> res;
+  for(const Face_pair& fp : pairs)
+    res.insert(fp.first < fp.second ? fp : std::make_pair(fp.second, fp.first));
+  return res;
+}
+
+void check(const Mesh& mesh,
+           const PMP::Self_intersection_tracker<Mesh>& tracker)
+{
+  std::vector<Face_pair> expected, tracked;
+  PMP::self_intersections(mesh, std::back_inserter(expected));
+  tracker.self_intersections(std::back_inserter(tracked));
+
+  assert(tracked.size() == tracker.number_of_intersecting_pairs());
+  assert(normalize(expected) == normalize(tracked));
+  assert(tracker.does_self_intersect() == !expected.empty());
+}
+
+void test_vertex_moves(Mesh& mesh, CGAL::Random& rnd)
+{
+  std::cout << "  moving vertices one by one" << std::endl;
+  PMP::Self_intersection_tracker<Mesh> tracker(mesh);
+  check(mesh, tracker);
+
+  const CGAL::Bbox_3 bb = PMP::bbox(mesh);
+  const double step = 0.1 * (bb.xmax() - bb.xmin());
+
+  bool has_intersected = false;
+  for(int i=0; i<100; ++i)
+  {
+    const vertex_descriptor v(rnd.uniform_int<int>(0, int(num_vertices(mesh)) - 1));
+    mesh.point(v) += Vector_3(rnd.uniform_real<double>(-step, step),
+                              rnd.uniform_real<double>(-step, step),
+                              rnd.uniform_real<double>(-step, step));
+    tracker.update_around_vertices(std::vector<vertex_descriptor>(1, v));
+    check(mesh, tracker);
+    has_intersected = has_intersected || tracker.does_self_intersect();
+  }
+  assert(has_intersected);
+}
+
+void test_large_edits(Mesh& mesh, CGAL::Random& rnd)
+{
+  std::cout << "  moving many vertices at once" << std::endl;
+  PMP::Self_intersection_tracker<Mesh> tracker(mesh);
+
+  const CGAL::Bbox_3 bb = PMP::bbox(mesh);
+  const double step = 0.02 * (bb.xmax() - bb.xmin());
+
+  // enough modified faces to trigger the rebuild of the tree
+  for(int i=0; i<3; ++i)
+  {
+    std::vector<vertex_descriptor> moved;
+    for(vertex_descriptor v : vertices(mesh))
+    {
+      if(rnd.uniform_int<int>(0, 2) != 0)
+        continue;
+      mesh.point(v) += Vector_3(rnd.uniform_real<double>(-step, step),
+                                rnd.uniform_real<double>(-step, step),
+                                rnd.uniform_real<double>(-step, step));
+      moved.push_back(v);
+    }
+    tracker.update_around_vertices(moved);
+    check(mesh, tracker);
+  }
+}
+
+void test_overlapping_copy(Mesh& mesh)
+{
+  std::cout << "  modifying all the faces of two overlapping components" << std::endl;
+
+  // add a translated copy of the mesh, intersecting the original one
+  const CGAL::Bbox_3 bb = PMP::bbox(mesh);
+  Mesh translated = mesh;
+  const Vector_3 t(0.1 * (bb.xmax() - bb.xmin()), 0., 0.);
+  for(vertex_descriptor v : vertices(translated))
+    translated.point(v) += t;
+  CGAL::copy_face_graph(translated, mesh);
+
+  PMP::Self_intersection_tracker<Mesh> tracker(mesh);
+  check(mesh, tracker);
+  assert(tracker.does_self_intersect());
+  const std::size_t nb_pairs = tracker.number_of_intersecting_pairs();
+
+  // more than 1024 modified faces, including intersecting pairs of modified faces,
+  // trigger the rebuild of the tree during the update
+  std::vector<face_descriptor> all_faces(faces(mesh).begin(), faces(mesh).end());
+  assert(all_faces.size() > 1024);
+  tracker.update(all_faces);
+  check(mesh, tracker);
+  assert(tracker.number_of_intersecting_pairs() == nb_pairs);
+
+  // the same after the rebuild, with the faces of one component only
+  std::vector<face_descriptor> half_faces(all_faces.begin(), all_faces.begin() + all_faces.size() / 2);
+  tracker.update(half_faces);
+  check(mesh, tracker);
+  assert(tracker.number_of_intersecting_pairs() == nb_pairs);
+}
+
+void test_topological_edits(Mesh& mesh, CGAL::Random& rnd)
+{
+  std::cout << "  adding vertices and faces" << std::endl;
+  PMP::Self_intersection_tracker<Mesh> tracker(mesh);
+
+  const CGAL::Bbox_3 bb = PMP::bbox(mesh);
+  const double step = 0.1 * (bb.xmax() - bb.xmin());
+
+  halfedge_descriptor hc;
+  for(int i=0; i<20; ++i)
+  {
+    const face_descriptor f(rnd.uniform_int<int>(0, int(num_faces(mesh)) - 1));
+    const halfedge_descriptor h = halfedge(f, mesh);
+    const Point_3 c = CGAL::centroid(mesh.point(source(h, mesh)),
+                                     mesh.point(target(h, mesh)),
+                                     mesh.point(target(next(h, mesh), mesh)));
+
+    const Vector_3 n = PMP::compute_face_normal(f, mesh);
+
+    // split the face and pull its center, making new faces
+    hc = CGAL::Euler::add_center_vertex(h, mesh);
+    mesh.point(target(hc, mesh)) = c + n * rnd.uniform_real<double>(-step, step);
+
+    std::vector<face_descriptor> modified(faces_around_target(hc, mesh).begin(),
+                                          faces_around_target(hc, mesh).end());
+    tracker.update(modified);
+    check(mesh, tracker);
+  }
+
+  // a degenerate face is reported
+  const face_descriptor f = *faces(mesh).begin();
+  const halfedge_descriptor h = halfedge(f, mesh);
+  const vertex_descriptor v = target(next(h, mesh), mesh);
+  mesh.point(v) = mesh.point(source(h, mesh));
+  tracker.update_around_vertices(std::vector<vertex_descriptor>(1, v));
+  check(mesh, tracker);
+  assert(tracker.does_self_intersect());
+
+  // faces are removed: the tracker must be reset
+  CGAL::Euler::remove_center_vertex(hc, mesh);
+  mesh.collect_garbage();
+  tracker.reset();
+  check(mesh, tracker);
+}
+
+int main(int argc, char** argv)
+{
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("meshes/elephant.off");
+
+  Mesh mesh;
+  if(!PMP::IO::read_polygon_mesh(filename, mesh) || !CGAL::is_triangle_mesh(mesh))
+  {
+    std::cerr << "Invalid input." << std::endl;
+    return EXIT_FAILURE;
+  }
+  std::cout << "Tracking self-intersections of " << filename << std::endl;
+
+  CGAL::Random rnd(0);
+
+  Mesh mesh_copy = mesh;
+  test_vertex_moves(mesh_copy, rnd);
+
+  mesh_copy = mesh;
+  test_large_edits(mesh_copy, rnd);
+
+  mesh_copy = mesh;
+  test_overlapping_copy(mesh_copy);
+
+  mesh_copy = mesh;
+  test_topological_edits(mesh_copy, rnd);
+
+  std::cout << "Done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -185,6 +185,28 @@ void test_curvature_flow(Mesh mesh)
 #endif
 }
 
+#ifdef CGAL_LINKED_WITH_TBB
+template <typename Mesh>
+void test_parallel_curvature_flow(const Mesh& mesh)
+{
+#ifdef CGAL_PMP_SMOOTHING_DEBUG
+  std::cout << "-- test_parallel_curvature_flow --" << std::endl;
+#endif
+
+  Mesh mesh_seq = mesh, mesh_par = mesh;
+  PMP::smooth_shape(mesh_seq, 0.0001, CGAL::parameters::number_of_iterations(3));
+  PMP::smooth_shape(mesh_par, 0.0001, CGAL::parameters::number_of_iterations(3)
+                                                       .concurrency_tag(CGAL::Parallel_tag()));
+
+  auto vit_seq = vertices(mesh_seq).begin();
+  for(auto v : vertices(mesh_par))
+  {
+    assert(get(CGAL::vertex_point, mesh_par, v) == get(CGAL::vertex_point, mesh_seq, *vit_seq));
+    ++vit_seq;
+  }
+}
+#endif
+
 int main(int, char**)
 {
   const std::string filename_devil = CGAL::data_file_path("meshes/mannequin-devil.off");
@@ -213,6 +235,9 @@ int main(int, char**)
   test_implicit_constrained_elephant<SurfaceMesh>(mesh_elephant);
   test_implicit_constrained_devil<SurfaceMesh>(mesh_devil);
   test_implicit_unscaled_elephant<SurfaceMesh>(mesh_elephant);
+#ifdef CGAL_LINKED_WITH_TBB
+  test_parallel_curvature_flow<SurfaceMesh>(mesh_elephant);
+#endif
 
   input1.open(filename_devil);
   Mesh_with_id pl_mesh_devil;
@@ -0,0 +1,85 @@
+#include <CGAL/Exact_predicates_exact_constructions_kernel.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Polygon_mesh_processing/union_of_triangle_meshes.h>
+#include <CGAL/Polygon_mesh_processing/corefinement.h>
+#include <CGAL/Polygon_mesh_processing/measure.h>
+
+#include <array>
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_exact_constructions_kernel K;
+typedef CGAL::Surface_mesh<K::Point_3>                    Mesh;
+
+namespace PMP = CGAL::Polygon_mesh_processing;
+
+Mesh box(double xmin, double ymin, double zmin,
+         double xmax, double ymax, double zmax)
+{
+  Mesh m;
+  std::array<Mesh::Vertex_index, 8> v;
+  for (int i=0; i<8; ++i)
+    v[i] = m.add_vertex(K::Point_3((i&1) ? xmax : xmin,
+                                   (i&2) ? ymax : ymin,
+                                   (i&4) ? zmax : zmin));
+  const int quads[6][4] = { {0,2,3,1}, {4,5,7,6}, {0,1,5,4}, {2,6,7,3}, {0,4,6,2}, {1,3,7,5} };
+  for (const auto& q : quads)
+  {
+    m.add_face(v[q[0]], v[q[1]], v[q[2]]);
+    m.add_face(v[q[0]], v[q[2]], v[q[3]]);
+  }
+  return m;
+}
+
+template <class Tag>
+void test_union(const std::vector<Mesh>& meshes, double expected_volume)
+{
+  Mesh out;
+  bool ok = PMP::union_of_triangle_meshes(meshes, out, CGAL::parameters::concurrency_tag(Tag()));
+  assert(ok);
+  assert(out.is_valid());
+  assert(CGAL::is_closed(out));
+  double volume = CGAL::to_double(PMP::volume(out));
+  std::cout << "  " << num_faces(out) << " faces, volume " << volume << std::endl;
+  assert(std::abs(volume - expected_volume) < 1e-9);
+}
+
+template <class Tag>
+void test_all()
+{
+  std::cout << "Overlapping boxes" << std::endl;
+  test_union<Tag>({ box(0,0,0, 2,2,2), box(1,0,0, 3,2,2), box(0.5,0.5,1, 1.5,1.5,4) }, 14);
+
+  std::cout << "Boxes sharing a face" << std::endl;
+  test_union<Tag>({ box(0,0,0, 1,1,1), box(1,0,0, 2,1,1) }, 2);
+
+  std::cout << "Nested boxes" << std::endl;
+  test_union<Tag>({ box(0,0,0, 4,4,4), box(1,1,1, 2,2,2) }, 64);
+
+  std::cout << "Disjoint boxes" << std::endl;
+  test_union<Tag>({ box(0,0,0, 1,1,1), box(2,2,2, 3,3,3), box(4,0,0, 5,1,1) }, 3);
+
+  std::cout << "Staggered boxes, compared to pairwise unions" << std::endl;
+  std::vector<Mesh> boxes;
+  for (int i=0; i<5; ++i)
+    boxes.push_back(box(0.5*i, 0.25*i, 0.125*i, 0.5*i+1, 0.25*i+1.5, 0.125*i+2));
+
+  Mesh pairwise = boxes[0];
+  for (std::size_t i=1; i<boxes.size(); ++i)
+  {
+    Mesh tmp = boxes[i];
+    PMP::corefine_and_compute_union(pairwise, tmp, pairwise);
+  }
+  test_union<Tag>(boxes, CGAL::to_double(PMP::volume(pairwise)));
+}
+
+int main()
+{
+  test_all<CGAL::Sequential_tag>();
+#ifdef CGAL_LINKED_WITH_TBB
+  test_all<CGAL::Parallel_tag>();
+#endif
+
+  return EXIT_SUCCESS;
+}
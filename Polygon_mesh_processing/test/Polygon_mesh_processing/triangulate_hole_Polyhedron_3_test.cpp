@@ -17,6 +17,7 @@
 #include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
 
 #include <cassert>
+#include <cmath>
 #include <vector>
 #include <set>
 #include <fstream>
@@ -369,6 +370,94 @@ void test_triangulate_refine_and_fair_hole_compile() {
        vertex_output_iterator(back_inserter(patch_vertices)));
 }
 
+template <class ConcurrencyTag>
+void test_triangulate_holes(const std::string file_name, bool use_cdt) {
+  std::cout << "test_triangulate_holes:" << std::endl;
+  std::cout << "  File: "<< file_name  << std::endl;
+  Polyhedron poly;
+  std::vector<Halfedge_handle> border_reps;
+  read_poly_with_borders(file_name, poly, border_reps);
+
+  std::vector<Facet_handle> patch;
+  std::size_t nb_filled =
+    CGAL::Polygon_mesh_processing::triangulate_holes(poly, border_reps,
+                                                     CGAL::parameters::
+                                                       face_output_iterator(std::back_inserter(patch)).
+                                                       use_2d_constrained_delaunay_triangulation(use_cdt).
+                                                       concurrency_tag(ConcurrencyTag()));
+  assert(nb_filled == border_reps.size());
+  assert(!patch.empty());
+
+  if(!poly.is_valid() || ! is_closed(poly)) {
+    std::cerr << "  Error: patched polyhedron is not valid or closed." << std::endl;
+    assert(false);
+  }
+
+  std::cout << "  Done!" << std::endl;
+}
+
+// an open tube with wavy borders, made of `nb_rings` rings of `n` vertices
+void generate_tube(Polyhedron& poly, int n, int nb_rings) {
+  poly.clear();
+  Point_property_map vpm = get(CGAL::vertex_point, poly);
+  std::vector<Vertex_handle> vertices;
+  for(int r=0; r<nb_rings; ++r)
+    for(int i=0; i<n; ++i) {
+      const double theta = 2 * CGAL_PI * i / n;
+      Vertex_handle v = add_vertex(poly);
+      put(vpm, v, Kernel::Point_3(std::cos(theta), std::sin(theta), r + 0.2 * std::sin(5 * theta)));
+      vertices.push_back(v);
+    }
+  for(int r=0; r+1<nb_rings; ++r)
+    for(int i=0; i<n; ++i) {
+      const int j = (i+1) % n;
+      CGAL::Euler::add_face(CGAL::make_array(vertices[r*n+i], vertices[r*n+j], vertices[(r+1)*n+j]), poly);
+      CGAL::Euler::add_face(CGAL::make_array(vertices[r*n+i], vertices[(r+1)*n+j], vertices[(r+1)*n+i]), poly);
+    }
+}
+
+void test_triangulate_large_holes() {
+  std::cout << "test_triangulate_large_holes:" << std::endl;
+  const int n = 500;
+  Polyhedron poly;
+  std::vector<Halfedge_handle> border_reps;
+  generate_tube(poly, n, 4);
+  detect_borders(poly, border_reps);
+  assert(border_reps.size() == 2);
+
+  const std::size_t nb_faces = num_faces(poly);
+  std::size_t nb_filled =
+    CGAL::Polygon_mesh_processing::triangulate_holes(poly, border_reps,
+                                                     CGAL::parameters::large_hole_threshold(50));
+  assert(nb_filled == 2);
+  assert(num_faces(poly) == nb_faces + 2 * (n - 2));
+  assert(poly.is_valid() && is_closed(poly));
+
+  // splitting a hole into sub-holes
+  generate_tube(poly, n, 4);
+  detect_borders(poly, border_reps);
+  for(Halfedge_handle h : border_reps) {
+    std::vector<Kernel::Point_3> P, Q;
+    std::vector<Halfedge_handle> P_edges;
+    std::vector<std::pair<int, int> > existing_edges;
+    bool ok = CGAL::Polygon_mesh_processing::internal::collect_hole_boundary(
+      poly, h, get(CGAL::vertex_point, poly), P, Q, P_edges, existing_edges);
+    assert(ok);
+
+    std::vector<Facet_handle> patch;
+    CGAL::Polygon_mesh_processing::internal::Tracer_polyhedron<Polyhedron, std::back_insert_iterator<std::vector<Facet_handle> > >
+      tracer(std::back_inserter(patch), poly, P_edges);
+    CGAL::Polygon_mesh_processing::Hole_filling::Default_visitor visitor;
+    ok = CGAL::internal::triangulate_hole_polyline_by_splitting(P, Q, existing_edges, tracer, visitor,
+                                                                true, false, 20, Kernel());
+    assert(ok);
+    assert(patch.size() == std::size_t(n - 2));
+  }
+  assert(poly.is_valid() && is_closed(poly));
+
+  std::cout << "  Done!" << std::endl;
+}
+
 void generate_elephant_with_hole()
 {
   Polyhedron poly;
@@ -413,6 +502,12 @@ int main()
     test_ouput_iterators_triangulate_hole(it->c_str(), false);
     test_triangulate_hole_weight(it->c_str(), true, 0);
     test_triangulate_hole_weight(it->c_str(), false, 0);
+    test_triangulate_holes<CGAL::Sequential_tag>(it->c_str(), true);
+    test_triangulate_holes<CGAL::Sequential_tag>(it->c_str(), false);
+#ifdef CGAL_LINKED_WITH_TBB
+    test_triangulate_holes<CGAL::Parallel_tag>(it->c_str(), true);
+    test_triangulate_holes<CGAL::Parallel_tag>(it->c_str(), false);
+#endif
     std::cout << "------------------------------------------------" << std::endl;
   }
   test_triangulate_hole_should_be_no_output("data/non_manifold_vertex.off", true);
@@ -420,6 +515,8 @@ int main()
   test_triangulate_hole_should_be_no_output("data/two_tris_collinear.off", true);
   test_triangulate_hole_should_be_no_output("data/two_tris_collinear.off", false);
 
+  test_triangulate_large_holes();
+
   test_triangulate_refine_and_fair_hole_compile();
   std::cout << "All Done!" << std::endl;
 }
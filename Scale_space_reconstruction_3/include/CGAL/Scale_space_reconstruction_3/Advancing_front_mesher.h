@@ -16,8 +16,23 @@
 
 #include <CGAL/Advancing_front_surface_reconstruction.h>
 
+#include <CGAL/Bbox_3.h>
+#include <CGAL/for_each.h>
+#include <CGAL/iterator.h>
+#include <CGAL/tags.h>
 #include <CGAL/Union_find.h>
 
+#include <boost/functional/hash.hpp>
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <type_traits>
+#include <unordered_map>
+#include <unordered_set>
+#include <utility>
+#include <vector>
+
 namespace CGAL
 {
 
@@ -33,16 +48,49 @@ namespace Scale_space_reconstruction_3
  *  with the possibility of using an upper bound on the length of the
  *  produced facets.
  *
+ *  The reconstruction can optionally be split into slabs that are
+ *  reconstructed independently, and concurrently if `ConcurrencyTag`
+ *  is `Parallel_tag`: the bounding box of the points is cut into
+ *  slabs of width `tile_size` orthogonal to its largest dimension,
+ *  and each slab is reconstructed with the points of a margin of half
+ *  a slab on both sides. The slabs are first flipped to agree with
+ *  their neighbors on the orientation of the facets that cross the
+ *  seams. The surface around each point is then taken from the
+ *  reconstruction of a single slab, initially the slab that contains
+ *  the point: a facet is kept if the slabs of its vertices all
+ *  reconstructed it with the same orientation, which avoids
+ *  overlapping and inconsistently oriented facets along the seams.
+ *  The points close to a seam are given to the neighboring slab where
+ *  this makes the reconstructions agree on more facets, and the holes
+ *  left where they still disagree are triangulated.
+ *
+ *  Because each slab only sees its own points, the facets of a slab
+ *  should be much smaller than the slab: `maximum_facet_length` should
+ *  be set to a value smaller than a quarter of `tile_size`. The
+ *  result may slightly differ from the reconstruction of the whole
+ *  point set at once, close to the seams.
+ *
  *  \cgalModels{CGAL::Scale_space_reconstruction_3::Mesher}
  *
  *  \tparam Geom_traits geometric traits class. It must be a
  *  model of `DelaunayTriangulationTraits_3`. It must have a
  *  `RealEmbeddable` field number type. Generally,
  *  `Exact_predicates_inexact_constructions_kernel` is preferred.
+ *  \tparam ConcurrencyTag indicates whether the slabs are
+ *  reconstructed concurrently when `tile_size` is not 0. It can be
+ *  omitted: if \ref thirdpartyTBB is available and
+ *  `CGAL_LINKED_WITH_TBB` is defined then `Parallel_tag` is
+ *  used. Otherwise, `Sequential_tag` is used.
  */
-template <typename Geom_traits>
+template <typename Geom_traits,
+          typename ConcurrencyTag = CGAL::Parallel_if_available_tag>
 class Advancing_front_mesher
 {
+#ifndef CGAL_LINKED_WITH_TBB
+  static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                 "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
   typedef typename Geom_traits::FT FT;
   typedef typename Geom_traits::Point_3                        Point;          ///< defines the point type.
 
@@ -80,9 +128,15 @@ private:
     }
   };
 
+  typedef std::array<std::size_t, 3> Slab_triangle;
+  typedef boost::hash<Slab_triangle> Slab_triangle_hash;
+  typedef std::pair<std::size_t, std::size_t> Slab_edge;
+  typedef boost::hash<Slab_edge> Slab_edge_hash;
+
   Priority m_priority;
   FT m_radius_ratio_bound;
   FT m_beta;
+  FT m_tile_size;
 
 public:
 
@@ -98,11 +152,15 @@ public:
    * \param beta half the angle of the wedge in which only the radius
          of triangles counts for the plausibility of candidates.
          Described in Section \ref AFSR_Selection
+   * \param tile_size width of the slabs reconstructed independently.
+         If 0, the whole point set is reconstructed at once.
    */
   Advancing_front_mesher (FT maximum_facet_length = 0.,
                           FT radius_ratio_bound = 5,
-                          FT beta = 0.52)
+                          FT beta = 0.52,
+                          FT tile_size = 0.)
     : m_priority (maximum_facet_length), m_radius_ratio_bound (radius_ratio_bound), m_beta (beta)
+    , m_tile_size (tile_size)
   {
 
   }
@@ -111,13 +169,409 @@ public:
   template <typename InputIterator, typename OutputIterator>
   void operator() (InputIterator begin, InputIterator end, OutputIterator output)
   {
-    CGAL::advancing_front_surface_reconstruction (begin, end, output,
-                                                  m_priority,
-                                                  m_radius_ratio_bound,
-                                                  m_beta);
+    if (m_tile_size == FT(0))
+      CGAL::advancing_front_surface_reconstruction (begin, end, output,
+                                                    m_priority,
+                                                    m_radius_ratio_bound,
+                                                    m_beta);
+    else
+      reconstruct_by_slabs (begin, end, output);
   }
   /// \endcond
 
+private:
+
+  template <typename InputIterator, typename OutputIterator>
+  void reconstruct_by_slabs (InputIterator begin, InputIterator end, OutputIterator output)
+  {
+    const std::vector<Point> points (begin, end);
+    if (points.empty())
+      return;
+
+    // Slabs are orthogonal to the largest dimension of the bounding box
+    const Bbox_3 bbox = bbox_3 (points.begin(), points.end());
+    int axis = 0;
+    for (int i = 1; i < 3; ++ i)
+      if ((bbox.max)(i) - (bbox.min)(i) > (bbox.max)(axis) - (bbox.min)(axis))
+        axis = i;
+
+    const double origin = (bbox.min)(axis);
+    const double size = CGAL::to_double (m_tile_size);
+    const std::size_t nb_slabs = (std::max) (std::size_t (1),
+      std::size_t (std::ceil (((bbox.max)(axis) - origin) / size)));
+    const double margin = size / 2.;
+
+    std::vector<std::size_t> sorted (points.size());
+    for (std::size_t i = 0; i < sorted.size(); ++ i)
+      sorted[i] = i;
+    std::sort (sorted.begin(), sorted.end(),
+               [&](std::size_t a, std::size_t b)
+               { return CGAL::to_double (points[a][axis]) < CGAL::to_double (points[b][axis]); });
+
+    std::vector<double> coordinates (points.size());
+    for (std::size_t i = 0; i < sorted.size(); ++ i)
+      coordinates[i] = CGAL::to_double (points[sorted[i]][axis]);
+
+    // Each point belongs to the slab that covers it
+    std::vector<std::size_t> point_slabs (points.size());
+    for (std::size_t i = 0; i < sorted.size(); ++ i)
+      point_slabs[sorted[i]] = (std::min) (nb_slabs - 1,
+        std::size_t ((std::max) (0., std::floor ((coordinates[i] - origin) / size))));
+
+    // Slab s covers [origin + s size, origin + (s+1) size) and is
+    // reconstructed with the points of a margin on both sides. Only the
+    // facets whose centroid is at least half a margin away from the
+    // border of the reconstructed points are considered, and the
+    // facets whose vertices belong to several slabs are also stored in
+    // a hash map, to compare the orientations of neighboring slabs.
+    typedef std::unordered_map<Slab_triangle, Slab_triangle, Slab_triangle_hash> Crossing_facets;
+    std::vector<std::vector<Slab_triangle> > slab_facets (nb_slabs);
+    std::vector<Crossing_facets> crossing_facets (nb_slabs);
+    CGAL::for_each<ConcurrencyTag>
+      (CGAL::make_counting_range<std::size_t> (0, nb_slabs),
+       [&](const std::size_t s) -> bool
+       {
+         const double lo = origin + double(s) * size - margin;
+         const double hi = origin + double(s + 1) * size + margin;
+
+         const std::size_t first = std::size_t (std::lower_bound (coordinates.begin(), coordinates.end(), lo)
+                                                - coordinates.begin());
+         const std::size_t last = (s + 1 == nb_slabs) ? coordinates.size()
+           : std::size_t (std::lower_bound (coordinates.begin(), coordinates.end(), hi)
+                          - coordinates.begin());
+         if (last - first < 3)
+           return true;
+
+         std::vector<Point> slab_points;
+         slab_points.reserve (last - first);
+         for (std::size_t i = first; i < last; ++ i)
+           slab_points.push_back (points[sorted[i]]);
+
+         std::vector<Slab_triangle> facets;
+         CGAL::advancing_front_surface_reconstruction (slab_points.begin(), slab_points.end(),
+                                                       std::back_inserter (facets),
+                                                       m_priority,
+                                                       m_radius_ratio_bound,
+                                                       m_beta);
+
+         for (const Slab_triangle& f : facets)
+         {
+           const double centroid = (coordinates[first + f[0]]
+                                    + coordinates[first + f[1]]
+                                    + coordinates[first + f[2]]) / 3.;
+           if ((s != 0 && centroid < lo + margin / 2.) ||
+               (s + 1 != nb_slabs && centroid >= hi - margin / 2.))
+             continue;
+
+           const Slab_triangle facet = {{ sorted[first + f[0]], sorted[first + f[1]], sorted[first + f[2]] }};
+           slab_facets[s].push_back (facet);
+           if (point_slabs[facet[0]] != point_slabs[facet[1]] ||
+               point_slabs[facet[0]] != point_slabs[facet[2]])
+             crossing_facets[s].emplace (sorted_triangle (facet), facet);
+         }
+         return true;
+       });
+
+    // The orientation of a reconstruction is arbitrary: a slab is
+    // flipped if it disagrees with the previous one on most of the
+    // facets that cross their seam
+    for (std::size_t s = 1; s < nb_slabs; ++ s)
+    {
+      std::size_t nb_same = 0, nb_opposite = 0;
+      for (const typename Crossing_facets::value_type& f : crossing_facets[s])
+      {
+        typename Crossing_facets::const_iterator other = crossing_facets[s - 1].find (f.first);
+        if (other == crossing_facets[s - 1].end())
+          continue;
+        if (same_orientation (f.second, other->second))
+          ++ nb_same;
+        else
+          ++ nb_opposite;
+      }
+
+      if (nb_opposite > nb_same)
+      {
+        for (Slab_triangle& f : slab_facets[s])
+          std::swap (f[1], f[2]);
+        for (typename Crossing_facets::value_type& f : crossing_facets[s])
+          std::swap (f.second[1], f.second[2]);
+      }
+    }
+
+    // All the reconstructions of each facet, with their orientation
+    typedef std::vector<std::pair<std::size_t, Slab_triangle> > Facet_versions;
+    typedef std::unordered_map<Slab_triangle, Facet_versions, Slab_triangle_hash> Facet_map;
+    typedef typename Facet_map::value_type Facet_entry;
+    Facet_map facet_versions;
+    std::vector<std::vector<const Facet_entry*> > vertex_facets (points.size());
+    for (std::size_t s = 0; s < nb_slabs; ++ s)
+    {
+      for (const Slab_triangle& f : slab_facets[s])
+      {
+        auto inserted = facet_versions.emplace (sorted_triangle (f), Facet_versions());
+        if (inserted.second)
+          for (std::size_t v : inserted.first->first)
+            vertex_facets[v].push_back (&*inserted.first);
+        inserted.first->second.emplace_back (s, f);
+      }
+      std::vector<Slab_triangle>().swap (slab_facets[s]);
+    }
+
+    // The star of each vertex is taken from the reconstruction of the
+    // slab that owns it: a facet is kept if the slabs owning its
+    // vertices all reconstructed it, with the same orientation. Around
+    // each edge, the facets then come from a single reconstruction, so
+    // that the edges are manifold and consistently oriented. A facet
+    // that the slab of one of its vertices reconstructed and that is
+    // not kept is rejected, and leaves a hole.
+    std::vector<std::size_t> owners (point_slabs);
+    auto kept_version = [&](const Facet_entry& entry) -> const Slab_triangle*
+    {
+      const Slab_triangle* kept = nullptr;
+      for (std::size_t v : entry.first)
+      {
+        const Slab_triangle* version = nullptr;
+        for (const std::pair<std::size_t, Slab_triangle>& sv : entry.second)
+          if (sv.first == owners[v])
+            version = &sv.second;
+        if (version == nullptr || (kept != nullptr && !same_orientation (*kept, *version)))
+          return nullptr;
+        kept = version;
+      }
+      return kept;
+    };
+    auto is_claimed = [&](const Facet_entry& entry) -> bool
+    {
+      for (std::size_t v : entry.first)
+        for (const std::pair<std::size_t, Slab_triangle>& sv : entry.second)
+          if (sv.first == owners[v])
+            return true;
+      return false;
+    };
+    auto nb_rejected = [&](std::size_t v) -> std::size_t
+    {
+      std::size_t nb = 0;
+      for (const Facet_entry* entry : vertex_facets[v])
+        if (is_claimed (*entry) && kept_version (*entry) == nullptr)
+          ++ nb;
+      return nb;
+    };
+
+    // The seams are moved to where the reconstructions agree: a vertex
+    // of a rejected facet is given to another slab if this rejects
+    // fewer facets around it. Each change reduces the number of
+    // rejected facets, which ensures termination.
+    std::vector<std::size_t> queue;
+    std::vector<char> is_queued (points.size(), 0);
+    for (const Facet_entry& entry : facet_versions)
+      if (is_claimed (entry) && kept_version (entry) == nullptr)
+        for (std::size_t v : entry.first)
+          if (!is_queued[v])
+          {
+            is_queued[v] = 1;
+            queue.push_back (v);
+          }
+
+    while (!queue.empty())
+    {
+      const std::size_t v = queue.back();
+      queue.pop_back();
+      is_queued[v] = 0;
+
+      const std::size_t owner = owners[v];
+      std::size_t best_owner = owner;
+      std::size_t best = nb_rejected (v);
+      for (const Facet_entry* entry : vertex_facets[v])
+        for (const std::pair<std::size_t, Slab_triangle>& sv : entry->second)
+        {
+          if (best == 0 || sv.first == owner || sv.first == best_owner)
+            continue;
+          owners[v] = sv.first;
+          const std::size_t nb = nb_rejected (v);
+          if (nb < best)
+          {
+            best = nb;
+            best_owner = sv.first;
+          }
+        }
+      owners[v] = best_owner;
+      if (best_owner == owner)
+        continue;
+
+      for (const Facet_entry* entry : vertex_facets[v])
+        for (std::size_t w : entry->first)
+          if (!is_queued[w])
+          {
+            is_queued[w] = 1;
+            queue.push_back (w);
+          }
+    }
+
+    // The edges of the rejected facets are recorded to fill the holes
+    std::vector<Slab_triangle> triangles;
+    std::unordered_set<Slab_edge, Slab_edge_hash> seam_edges;
+    for (const Facet_entry& entry : facet_versions)
+    {
+      if (!is_claimed (entry))
+        continue;
+
+      const Slab_triangle* kept = kept_version (entry);
+      if (kept != nullptr)
+        triangles.push_back (*kept);
+      else
+        for (int i = 0; i < 3; ++ i)
+          seam_edges.insert (make_edge (entry.first[i], entry.first[(i+1)%3]));
+    }
+    Facet_map().swap (facet_versions);
+
+    fill_seams (points, seam_edges, triangles);
+
+    for (const Slab_triangle& f : triangles)
+      *(output ++) = f;
+  }
+
+  static Slab_triangle sorted_triangle (Slab_triangle f)
+  {
+    std::sort (f.begin(), f.end());
+    return f;
+  }
+
+  static bool same_orientation (const Slab_triangle& a, const Slab_triangle& b)
+  {
+    for (int i = 0; i < 3; ++ i)
+      if (a[0] == b[i])
+        return a[1] == b[(i+1)%3];
+    return false;
+  }
+
+  static Slab_edge make_edge (std::size_t a, std::size_t b)
+  {
+    return (a < b) ? Slab_edge (a, b) : Slab_edge (b, a);
+  }
+
+  // Fills the holes left along the seams. The border edges of the
+  // holes that contain an edge of a facet that was not kept are
+  // walked in the opposite direction of their facet, and split into
+  // simple cycles where several holes meet at a vertex. A cycle is
+  // filled if most of its edges are edges of facets that were not
+  // kept, so that the holes of the reconstructions are not filled. It is
+  // triangulated by cutting ears, with the shortest diagonal first,
+  // and without creating an edge that already exists.
+  static void fill_seams (const std::vector<Point>& points,
+                          const std::unordered_set<Slab_edge, Slab_edge_hash>& seam_edges,
+                          std::vector<Slab_triangle>& triangles)
+  {
+    std::unordered_map<Slab_edge, std::size_t, Slab_edge_hash> edge_degrees;
+    for (const Slab_triangle& f : triangles)
+      for (int i = 0; i < 3; ++ i)
+        ++ edge_degrees[make_edge (f[i], f[(i+1)%3])];
+
+    std::unordered_map<std::size_t, std::vector<std::size_t> > hole_next;
+    for (const Slab_triangle& f : triangles)
+      for (int i = 0; i < 3; ++ i)
+        if (edge_degrees[make_edge (f[i], f[(i+1)%3])] == 1)
+          hole_next[f[(i+1)%3]].push_back (f[i]);
+
+    std::vector<std::size_t> path;
+    std::unordered_map<std::size_t, std::size_t> path_positions;
+    for (const Slab_edge& e : seam_edges)
+    {
+      typename std::unordered_map<Slab_edge, std::size_t, Slab_edge_hash>::const_iterator
+        degree = edge_degrees.find (e);
+      if (degree == edge_degrees.end() || degree->second != 1)
+        continue;
+
+      std::size_t start = e.first;
+      typename std::unordered_map<std::size_t, std::vector<std::size_t> >::iterator
+        next = hole_next.find (start);
+      if (next == hole_next.end()
+          || std::find (next->second.begin(), next->second.end(), e.second) == next->second.end())
+        start = e.second;
+
+      // Walk along the hole, removing each cycle as soon as it closes
+      path.assign (1, start);
+      path_positions.clear();
+      path_positions[start] = 0;
+      while (!path.empty())
+      {
+        next = hole_next.find (path.back());
+        if (next == hole_next.end() || next->second.empty())
+          break;
+
+        const std::size_t v = next->second.back();
+        next->second.pop_back();
+
+        typename std::unordered_map<std::size_t, std::size_t>::const_iterator
+          position = path_positions.find (v);
+        if (position == path_positions.end())
+        {
+          path_positions[v] = path.size();
+          path.push_back (v);
+          continue;
+        }
+
+        std::vector<std::size_t> polygon (path.begin() + std::ptrdiff_t (position->second), path.end());
+        for (std::size_t i = 1; i < polygon.size(); ++ i)
+          path_positions.erase (polygon[i]);
+        path.resize (position->second + 1);
+
+        std::size_t nb_seam_edges = 0;
+        for (std::size_t i = 0; i < polygon.size(); ++ i)
+          if (seam_edges.count (make_edge (polygon[i], polygon[(i+1)%polygon.size()])) != 0)
+            ++ nb_seam_edges;
+        if (2 * nb_seam_edges > polygon.size())
+          fill_hole (points, polygon, edge_degrees, triangles);
+        if (path.size() == 1)
+          break;
+      }
+    }
+  }
+
+  static void fill_hole (const std::vector<Point>& points,
+                         std::vector<std::size_t>& polygon,
+                         std::unordered_map<Slab_edge, std::size_t, Slab_edge_hash>& edge_degrees,
+                         std::vector<Slab_triangle>& triangles)
+  {
+    const std::size_t none = std::size_t(-1);
+    while (polygon.size() > 3)
+    {
+      std::size_t best = none;
+      double best_length = 0.;
+      for (std::size_t i = 0; i < polygon.size(); ++ i)
+      {
+        const std::size_t prev = polygon[(i + polygon.size() - 1) % polygon.size()];
+        const std::size_t next = polygon[(i + 1) % polygon.size()];
+        if (edge_degrees.count (make_edge (prev, next)) != 0)
+          continue;
+        const double length = CGAL::to_double (squared_distance (points[prev], points[next]));
+        if (best == none || length < best_length)
+        {
+          best = i;
+          best_length = length;
+        }
+      }
+      if (best == none)
+        return;
+
+      const std::size_t prev = polygon[(best + polygon.size() - 1) % polygon.size()];
+      const std::size_t next = polygon[(best + 1) % polygon.size()];
+      triangles.push_back ({{ prev, polygon[best], next }});
+      ++ edge_degrees[make_edge (prev, polygon[best])];
+      ++ edge_degrees[make_edge (polygon[best], next)];
+      ++ edge_degrees[make_edge (prev, next)];
+      polygon.erase (polygon.begin() + std::ptrdiff_t (best));
+    }
+
+    if (polygon.size() < 3)
+      return;
+    for (int i = 0; i < 3; ++ i)
+      if (edge_degrees[make_edge (polygon[i], polygon[(i+1)%3])] != 1)
+        return;
+    triangles.push_back ({{ polygon[0], polygon[1], polygon[2] }});
+    for (int i = 0; i < 3; ++ i)
+      ++ edge_degrees[make_edge (polygon[i], polygon[(i+1)%3])];
+  }
+
 };
 
 
@@ -0,0 +1,124 @@
+// Tests that the reconstruction by slabs of Advancing_front_mesher gives a
+// valid and consistently oriented surface, close to the reconstruction of
+// the whole point set at once.
+
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/Scale_space_reconstruction_3/Advancing_front_mesher.h>
+#include <CGAL/IO/read_points.h>
+#include <CGAL/tags.h>
+
+#include <array>
+#include <cassert>
+#include <cstdlib>
+#include <iostream>
+#include <iterator>
+#include <map>
+#include <utility>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel Kernel;
+typedef Kernel::Point_3 Point;
+typedef std::array<std::size_t, 3> Facet;
+
+#ifdef CGAL_LINKED_WITH_TBB
+typedef CGAL::Parallel_tag Concurrency_tag;
+#else
+typedef CGAL::Sequential_tag Concurrency_tag;
+#endif
+
+struct Surface_info
+{
+  std::size_t nb_facets = 0;
+  std::size_t nb_border_edges = 0;
+  std::size_t nb_non_manifold_edges = 0;
+  std::size_t nb_same_direction_halfedges = 0;
+};
+
+Surface_info check(const std::vector<Facet>& facets)
+{
+  Surface_info info;
+  info.nb_facets = facets.size();
+
+  // number of facets traversing each halfedge
+  std::map<std::pair<std::size_t, std::size_t>, std::size_t> halfedges;
+  for(const Facet& f : facets)
+    for(int i = 0; i < 3; ++i)
+      ++halfedges[std::make_pair(f[i], f[(i+1)%3])];
+
+  for(const auto& h : halfedges)
+  {
+    if(h.second > 1)
+      info.nb_same_direction_halfedges += h.second - 1;
+
+    auto opposite = halfedges.find(std::make_pair(h.first.second, h.first.first));
+    const std::size_t nb_opposite = (opposite == halfedges.end()) ? 0 : opposite->second;
+    if(h.first.first < h.first.second || nb_opposite == 0)
+    {
+      const std::size_t degree = h.second + nb_opposite;
+      if(degree == 1)
+        ++info.nb_border_edges;
+      else if(degree > 2)
+        ++info.nb_non_manifold_edges;
+    }
+  }
+
+  std::cout << "  " << info.nb_facets << " facets, "
+            << info.nb_border_edges << " border edges, "
+            << info.nb_non_manifold_edges << " non-manifold edges, "
+            << info.nb_same_direction_halfedges << " halfedges with the same direction" << std::endl;
+  return info;
+}
+
+template <typename ConcurrencyTag>
+std::vector<Facet> reconstruct(const std::vector<Point>& points, double tile_size)
+{
+  CGAL::Scale_space_reconstruction_3::Advancing_front_mesher<Kernel, ConcurrencyTag>
+    mesher(0.1, 5, 0.52, tile_size);
+  std::vector<Facet> facets;
+  mesher(points.begin(), points.end(), std::back_inserter(facets));
+  return facets;
+}
+
+void check_slabs(const Surface_info& expected, const Surface_info& info)
+{
+  // The seams leave neither overlaps nor orientation flips
+  assert(info.nb_non_manifold_edges == 0);
+  assert(info.nb_same_direction_halfedges == 0);
+
+  // The seams do not leave holes either: up to the small differences between the
+  // reconstructions of the slabs and of the whole point set, the surfaces are alike.
+  // The advancing front breaks ties by addresses, so that two reconstructions of
+  // the same points already differ by a few percent of their border edges.
+  assert(info.nb_border_edges < 1.03 * expected.nb_border_edges);
+  assert(info.nb_facets > 0.98 * expected.nb_facets);
+  assert(info.nb_facets < 1.02 * expected.nb_facets);
+
+  CGAL_USE(expected);
+  CGAL_USE(info);
+}
+
+int main()
+{
+  std::vector<Point> points;
+  if(!CGAL::IO::read_points(CGAL::data_file_path("points_3/sphere_20k.xyz"), std::back_inserter(points)))
+  {
+    std::cerr << "Error: cannot read file" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  std::cout << "Whole point set" << std::endl;
+  const Surface_info expected = check(reconstruct<CGAL::Sequential_tag>(points, 0.));
+  assert(expected.nb_non_manifold_edges == 0);
+  assert(expected.nb_same_direction_halfedges == 0);
+
+  for(double tile_size : { 1., 0.5 })
+  {
+    std::cout << "Slabs of size " << tile_size << std::endl;
+    check_slabs(expected, check(reconstruct<CGAL::Sequential_tag>(points, tile_size)));
+
+    std::cout << "Concurrent slabs of size " << tile_size << std::endl;
+    check_slabs(expected, check(reconstruct<Concurrency_tag>(points, tile_size)));
+  }
+
+  return EXIT_SUCCESS;
+}
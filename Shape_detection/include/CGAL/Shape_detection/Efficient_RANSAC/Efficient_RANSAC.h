@@ -17,6 +17,7 @@
 #include <CGAL/license/Shape_detection.h>
 
 #include <CGAL/Random.h>
+#include <CGAL/tags.h>
 
 #include <CGAL/Shape_detection/Efficient_RANSAC/Octree.h>
 #include <CGAL/Shape_detection/Efficient_RANSAC/Shape_base.h>
@@ -34,6 +35,9 @@
 #include <fstream>
 #include <sstream>
 #include <functional>
+#include <set>
+#include <stack>
+#include <type_traits>
 
 // boost --------------
 #include <CGAL/boost/iterator/counting_iterator.hpp>
@@ -41,6 +45,11 @@
 #include <boost/make_shared.hpp>
 //---------------------
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/parallel_for.h>
+#endif
+
 namespace CGAL {
 namespace Shape_detection {
 
@@ -451,6 +460,16 @@ public:
     Performs the shape detection. Shape types considered during the detection
     are those registered using `add_shape_factory()`.
 
+    \tparam ConcurrencyTag enables sequential versus parallel
+    algorithm. Possible values are `Sequential_tag` (default value),
+    `Parallel_tag`, and `Parallel_if_available_tag`. With `Parallel_tag`,
+    the candidate shapes are generated and scored concurrently, and the
+    shape types must support concurrent calls to the methods of distinct
+    shapes. Each batch of candidates is drawn from random generators
+    seeded by `CGAL::get_default_random()`, so that the detected shapes
+    do not depend on the number of threads, but differ from the
+    sequential version.
+
     \param options parameters for shape detection
 
     \param callback can be omitted if the algorithm should be run
@@ -459,15 +478,22 @@ public:
     passed as parameter. If it returns `true`, then the algorithm
     continues its execution normally; if it returns `false`, the
     algorithm is stopped. Note that this interruption may leave the
-    class in an invalid state.
+    class in an invalid state. The callback is always called from
+    the thread calling `detect()`.
 
     \return `true` if shape types have been registered and
             input data has been set. Otherwise, `false` is returned.
   */
+  template <typename ConcurrencyTag = Sequential_tag>
   bool detect(const Parameters &options = Parameters(),
               const std::function<bool(double)> &callback
               = std::function<bool(double)>()) {
 
+#ifndef CGAL_LINKED_WITH_TBB
+    static_assert (!(std::is_convertible<ConcurrencyTag, Parallel_tag>::value),
+                   "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
     m_options = options;
 
     // No shape types for detection or no points provided, exit
@@ -562,6 +588,20 @@ public:
               = (std::min)(std::size_t(200),
                            (std::max)(std::size_t((m_num_available_points - num_invalid) / double(m_options.min_points)),
                                       std::size_t(1)));
+#ifdef CGAL_LINKED_WITH_TBB
+            if constexpr (!std::is_same<ConcurrencyTag, Sequential_tag>::value) {
+              generate_candidates_in_parallel(search_number,
+                                              m_num_available_points - num_invalid,
+                                              candidates, best_expected, failed_candidates);
+              generated_candidates += search_number;
+
+              if (callback && !callback(num_invalid / double(m_num_total_points))) {
+                clear(num_invalid, candidates);
+                return false;
+              }
+            }
+            else
+#endif
             for (std::size_t nb = 0; nb < search_number; ++ nb)
             {
               // Generate candidates
@@ -577,10 +617,11 @@ public:
                 done = drawSamplesFromCellContainingPoint(
                   m_global_octree,
                   get(*m_point_pmap, *(m_input_iterator_first + first_sample)),
-                  select_random_octree_level(),
+                  select_random_octree_level(get_default_random()),
                   indices,
                   m_shape_index,
-                  m_required_samples
+                  m_required_samples,
+                  get_default_random()
                 );
 
                 if (callback && !callback(num_invalid / double(m_num_total_points))) {
@@ -664,7 +705,7 @@ public:
       //  the best candidate is always the last element of the vector
 
       Shape *best_candidate =
-              get_best_candidate(candidates, m_num_available_points - num_invalid);
+              get_best_candidate<ConcurrencyTag>(candidates, m_num_available_points - num_invalid);
 
       if (callback && !callback(num_invalid / double(m_num_total_points))) {
         clear(num_invalid, candidates);
@@ -681,7 +722,7 @@ public:
       best_candidate->m_indices.clear();
 
       best_candidate->m_score =
-              score(m_global_octree,
+              score<ConcurrencyTag>(m_global_octree,
                     best_candidate,
                     m_shape_index,
                     FT(3) * m_options.epsilon,
@@ -807,9 +848,7 @@ public:
 
 
         //3. Remove points from candidates common with extracted primitive
-        //#pragma omp parallel for
-        best_expected = 0;
-        for (std::size_t i = 0; i < candidates.size() - 1; i++) {
+        auto update_candidate = [&](const std::size_t i) {
           if (candidates[i]) {
             candidates[i]->update_points(m_shape_index);
             candidates[i]->compute_bound(
@@ -819,11 +858,31 @@ public:
             if (candidates[i]->max_bound() < m_options.min_points) {
               delete candidates[i];
               candidates[i] = nullptr;
-            } else {
-              best_expected = (candidates[i]->expected_value() > best_expected) ?
-                              candidates[i]->expected_value() : best_expected;
             }
           }
+        };
+
+#ifdef CGAL_LINKED_WITH_TBB
+        if constexpr (!std::is_same<ConcurrencyTag, Sequential_tag>::value) {
+          tbb::parallel_for(tbb::blocked_range<std::size_t>(0, candidates.size() - 1),
+                            [&](const tbb::blocked_range<std::size_t> &r) {
+                              for (std::size_t i = r.begin(); i != r.end(); ++i)
+                                update_candidate(i);
+                            });
+        }
+        else
+#endif
+        {
+          for (std::size_t i = 0; i < candidates.size() - 1; i++)
+            update_candidate(i);
+        }
+
+        best_expected = 0;
+        for (std::size_t i = 0; i < candidates.size() - 1; i++) {
+          if (candidates[i]) {
+            best_expected = (candidates[i]->expected_value() > best_expected) ?
+                            candidates[i]->expected_value() : best_expected;
+          }
         }
 
         if (callback && !callback(num_invalid / double(m_num_total_points))) {
@@ -947,11 +1006,102 @@ private:
     m_num_available_points -= num_invalid;
   }
 
-  int select_random_octree_level() {
+  int select_random_octree_level(Random &random) {
     auto upper_bound = static_cast<unsigned int>(m_global_octree->maxLevel() + 1);
-    return (int) get_default_random()(upper_bound);
+    return (int) random(upper_bound);
   }
 
+#ifdef CGAL_LINKED_WITH_TBB
+  // Generates and evaluates `search_number` candidates concurrently.
+  // Each candidate is drawn with its own random generator, whose seed is
+  // taken sequentially from the default random generator: the candidates
+  // thus do not depend on the scheduling of the threads.
+  void generate_candidates_in_parallel(const std::size_t search_number,
+                                       const std::size_t num_available_points,
+                                       std::vector<Shape *> &candidates,
+                                       FT &best_expected,
+                                       std::size_t &failed_candidates) {
+    const std::size_t num_factories = m_shape_factories.size();
+
+    std::vector<unsigned int> seeds(search_number);
+    for (std::size_t nb = 0; nb < search_number; ++ nb)
+      seeds[nb] = static_cast<unsigned int>(
+        get_default_random().get_int(0, (std::numeric_limits<int>::max)()));
+
+    std::vector<Shape *> new_candidates(search_number * num_factories, nullptr);
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, search_number),
+                      [&](const tbb::blocked_range<std::size_t> &r) {
+      for (std::size_t nb = r.begin(); nb != r.end(); ++ nb) {
+        Random random(seeds[nb]);
+
+        //1. pick a point p1 randomly among available points
+        std::set<std::size_t> indices;
+        std::size_t first_sample;
+        bool done = false;
+        do {
+          do
+            first_sample = random(static_cast<unsigned int>(m_num_available_points));
+          while (m_shape_index[first_sample] != -1);
+
+          done = drawSamplesFromCellContainingPoint(
+            m_global_octree,
+            get(*m_point_pmap, *(m_input_iterator_first + first_sample)),
+            select_random_octree_level(random),
+            indices,
+            m_shape_index,
+            m_required_samples,
+            random
+          );
+        } while (!done);
+
+        //add candidate for each type of primitives
+        for (std::size_t f = 0; f < num_factories; ++ f) {
+          Shape *p = (Shape *) m_shape_factories[f]();
+          p->compute(indices,
+                     m_input_iterator_first,
+                     m_traits,
+                     *m_point_pmap,
+                     *m_normal_pmap,
+                     m_options.epsilon,
+                     m_options.normal_threshold);
+
+          if (p->is_valid()) {
+            improve_bound(p, num_available_points, 1, 500);
+
+            if (p->max_bound() >= m_options.min_points && p->score() > 0) {
+              new_candidates[nb * num_factories + f] = p;
+              continue;
+            }
+          }
+
+          delete p;
+        }
+      }
+    });
+
+    // Gather the candidates in the order in which they were drawn
+    for (std::size_t nb = 0; nb < search_number; ++ nb) {
+      bool candidate_success = false;
+      for (std::size_t f = 0; f < num_factories; ++ f) {
+        Shape *p = new_candidates[nb * num_factories + f];
+        if (!p)
+          continue;
+
+        if (best_expected < p->expected_value())
+          best_expected = p->expected_value();
+
+        candidates.push_back(p);
+        candidate_success = true;
+      }
+
+      if (!candidate_success)
+        ++ failed_candidates;
+    }
+  }
+#endif
+
+  template <typename ConcurrencyTag>
   Shape *get_best_candidate(std::vector<Shape *> &candidates,
                             const std::size_t num_available_points) {
 
@@ -971,7 +1121,7 @@ private:
                 comp);
 
       //refine the best one
-      improve_bound(candidates.back(),
+      improve_bound<ConcurrencyTag>(candidates.back(),
                     num_available_points, m_num_subsets,
                     m_options.min_points);
 
@@ -992,7 +1142,7 @@ private:
         //if we reach this point, there is an overlap
         //  between best one and position_stop
         //so request refining bound on position_stop
-        improved |= improve_bound(candidates.at(position_stop),
+        improved |= improve_bound<ConcurrencyTag>(candidates.at(position_stop),
                                   num_available_points,
                                   m_num_subsets,
                                   m_options.min_points);
@@ -1009,6 +1159,7 @@ private:
     return candidates.back();
   }
 
+  template <typename ConcurrencyTag = Sequential_tag>
   bool improve_bound(Shape *candidate,
                      std::size_t num_available_points,
                      std::size_t max_subset,
@@ -1038,7 +1189,7 @@ private:
 
     do {
       new_score =
-              score(m_direct_octrees[candidate->m_nb_subset_used],
+              score<ConcurrencyTag>(m_direct_octrees[candidate->m_nb_subset_used],
                     candidate,
                     m_shape_index,
                     m_options.epsilon,
@@ -1070,13 +1221,18 @@ private:
                                        int(num_candidates)), FT(1));
   }
 
-  template<class Octree>
+  template<class ConcurrencyTag, class Octree>
   std::size_t score(const Octree *octree,
                     Shape *candidate,
                     std::vector<int> &shapeIndex,
                     FT epsilon,
                     FT normal_threshold) {
 
+#ifdef CGAL_LINKED_WITH_TBB
+    if constexpr (!std::is_same<ConcurrencyTag, Sequential_tag>::value)
+      return parallel_score(octree, candidate, shapeIndex, epsilon, normal_threshold);
+#endif
+
     typedef typename Octree::Node Cell;
 
     std::stack<Cell> stack;
@@ -1124,6 +1280,76 @@ private:
     return candidate->m_indices.size();
   }
 
+#ifdef CGAL_LINKED_WITH_TBB
+  // Same as `score()`, but the inliers of the leaves are computed concurrently.
+  // The leaves are visited in the same order, so the inliers are identical.
+  template<class Octree>
+  std::size_t parallel_score(const Octree *octree,
+                             Shape *candidate,
+                             const std::vector<int> &shapeIndex,
+                             FT epsilon,
+                             FT normal_threshold) {
+
+    typedef typename Octree::Node Cell;
+
+    std::vector<Cell> leaves;
+
+    std::stack<Cell> stack;
+    stack.push(octree->root());
+
+    while (!stack.empty()) {
+      Cell cell = stack.top();
+      stack.pop();
+
+      FT width = octree->width() / (1 << (octree->depth(cell)));
+
+      FT diag = CGAL::sqrt(FT(3) * width * width) + epsilon;
+
+      FT dist = candidate->squared_distance(octree->barycenter(cell));
+
+      if (dist > (diag * diag))
+        continue;
+
+      if (octree->is_leaf(cell)) {
+        leaves.push_back(cell);
+      } else {
+        for (std::size_t i = 0; i < 8; i++) {
+          if (octree->points(octree->child(cell, i)).size() != 0)
+            stack.push(octree->child(cell, i));
+        }
+      }
+    }
+
+    std::vector<std::vector<std::size_t> > leaf_inliers(leaves.size());
+
+    tbb::parallel_for(tbb::blocked_range<std::size_t>(0, leaves.size()),
+                      [&](const tbb::blocked_range<std::size_t> &r) {
+      std::vector<std::size_t> indices;
+      for (std::size_t l = r.begin(); l != r.end(); ++ l) {
+        const Cell &cell = leaves[l];
+
+        indices.clear();
+        for (std::size_t i = 0; i < octree->points(cell).size(); i++) {
+          if (shapeIndex[octree->index(cell, i)] == -1) {
+            indices.push_back(octree->index(cell, i));
+          }
+        }
+
+        candidate->inliers(epsilon, normal_threshold, indices, leaf_inliers[l]);
+      }
+    });
+
+    std::size_t num_inliers = candidate->m_indices.size();
+    for (const std::vector<std::size_t> &li : leaf_inliers)
+      num_inliers += li.size();
+
+    candidate->m_indices.reserve(num_inliers);
+    for (const std::vector<std::size_t> &li : leaf_inliers)
+      candidate->m_indices.insert(candidate->m_indices.end(), li.begin(), li.end());
+
+    return candidate->m_indices.size();
+  }
+#endif
 
   template<class Octree>
   const typename Octree::Node node_containing_point(const Octree *octree, const Point &p, std::size_t level) {
@@ -1142,7 +1368,8 @@ private:
                                           std::size_t level,
                                           std::set<std::size_t> &indices,
                                           const std::vector<int> &shapeIndex,
-                                          std::size_t requiredSamples) {
+                                          std::size_t requiredSamples,
+                                          Random &random) {
 
     typedef typename Octree::Node Cell;
 
@@ -1162,7 +1389,7 @@ private:
       return false;
 
     do {
-      std::size_t p = CGAL::get_default_random().
+      std::size_t p = random.
               uniform_int<std::size_t>(0, octree->points(cur).size() - 1);
       std::size_t j = octree->index(cur, p);
 
@@ -578,21 +578,30 @@ namespace CGAL {
     std::size_t cost_function(FT epsilon,
                          FT normal_threshold,
                          const std::vector<std::size_t> &indices) {
+      std::size_t score_before = m_indices.size();
+
+      inliers(epsilon, normal_threshold, indices, m_indices);
+
+      return m_indices.size() - score_before;
+    }
+
+    // Appends to `output` the elements of `indices` that are compatible with the shape.
+    // Does not modify the shape, and can thus be called concurrently.
+    void inliers(FT epsilon,
+                 FT normal_threshold,
+                 const std::vector<std::size_t> &indices,
+                 std::vector<std::size_t> &output) const {
       std::vector<FT> dists, angles;
       dists.resize(indices.size());
       squared_distance(indices, dists);
       angles.resize(indices.size());
       cos_to_normal(indices, angles);
 
-      std::size_t score_before = m_indices.size();
-
       FT eps = epsilon * epsilon;
       for (std::size_t i = 0;i<indices.size();i++) {
           if (dists[i] <= eps && angles[i] > normal_threshold)
-            m_indices.push_back(indices[i]);
+            output.push_back(indices[i]);
         }
-
-      return m_indices.size() - score_before;
     }
 
     template<typename T> bool is_finite(T arg) {
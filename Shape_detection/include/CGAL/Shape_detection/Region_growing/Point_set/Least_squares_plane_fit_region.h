@@ -19,6 +19,7 @@
 // Internal includes.
 #include <CGAL/Shape_detection/Region_growing/internal/utils.h>
 
+#include <memory>
 #include <unordered_map>
 
 namespace CGAL {
@@ -191,7 +192,7 @@ namespace Point_set {
       This function creates an empty property map that maps iterators on the input range `Item` to std::size_t.
     */
     Region_index_map region_index_map() {
-      return Region_index_map(m_region_map);
+      return Region_index_map(*m_region_map);
     }
 
     /*!
@@ -347,7 +348,7 @@ namespace Point_set {
     const Point_map m_point_map;
     const Normal_map m_normal_map;
     const GeomTraits m_traits;
-    Region_unordered_map m_region_map;
+    std::shared_ptr<Region_unordered_map> m_region_map = std::make_shared<Region_unordered_map>();
 
     FT m_distance_threshold;
     FT m_cos_value_threshold;
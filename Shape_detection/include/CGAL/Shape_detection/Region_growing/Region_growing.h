@@ -17,18 +17,28 @@
 #include <CGAL/license/Shape_detection.h>
 
 // STL includes.
+#include <optional>
 #include <queue>
+#include <type_traits>
 #include <vector>
 #include <unordered_set>
 
 // CGAL includes.
 #include <CGAL/assertions.h>
+#include <CGAL/tags.h>
 #include <CGAL/type_traits/is_iterator.h>
 #include <CGAL/property_map.h>
 #include <CGAL/boost/graph/properties.h>
 #include <CGAL/Shape_detection/Region_growing/internal/utils.h>
 #include <CGAL/Shape_detection/Region_growing/internal/property_map.h>
 
+#ifdef CGAL_LINKED_WITH_TBB
+#include <tbb/blocked_range.h>
+#include <tbb/concurrent_unordered_map.h>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#endif
+
 namespace CGAL {
 namespace Shape_detection {
 
@@ -348,6 +358,13 @@ namespace internal {
       \brief runs the region growing algorithm and fills an output iterator
       with the fitted primitive and their region.
 
+      \tparam ConcurrencyTag
+      enables sequential versus parallel algorithm. Possible values are `Sequential_tag`
+      (default value), `Parallel_tag`, and `Parallel_if_available_tag`. With `Parallel_tag`,
+      regions are grown concurrently from several seeds, using a copy of the region type
+      for each seed; the neighbor query and the copies of the region type must thus support
+      concurrent calls. The detected regions are the same as with `Sequential_tag`.
+
       \tparam PrimitiveAndRegionOutputIterator
       a model of `OutputIterator` whose value type is `Primitive_and_region`
 
@@ -356,32 +373,33 @@ namespace internal {
 
       \return past-the-end position in the output sequence
     */
-    template<typename PrimitiveAndRegionOutputIterator = Emptyset_iterator>
+    template<typename ConcurrencyTag = Sequential_tag,
+             typename PrimitiveAndRegionOutputIterator = Emptyset_iterator>
     PrimitiveAndRegionOutputIterator detect(PrimitiveAndRegionOutputIterator region_out = PrimitiveAndRegionOutputIterator()) {
+#ifndef CGAL_LINKED_WITH_TBB
+      static_assert (!std::is_convertible<ConcurrencyTag, Parallel_tag>::value,
+                     "Parallel_tag is enabled but TBB is unavailable.");
+#endif
+
       //      clear(); TODO: this is not valid to comment this clear()
       m_visited_map.clear(); // tmp replacement for the line above
 
-      Region region;
       m_nb_regions = 0;
 
+#ifdef CGAL_LINKED_WITH_TBB
+      if constexpr (!std::is_same<ConcurrencyTag, Sequential_tag>::value)
+        return detect_in_parallel(region_out);
+#endif
+
+      Region region;
+
       // Grow regions.
       for (auto it = m_seed_range.begin(); it != m_seed_range.end(); it++) {
         const Item seed = *it;
 
         // Try to grow a new region from the index of the seed item.
-        if (!get(m_visited, seed)) {
-          const bool is_success = propagate(seed, region);
-
-          // Check global conditions.
-          if (!is_success || !m_region_type.is_valid_region(region)) {
-            revert(region);
-          }
-          else {
-            fill_region_map(m_nb_regions++, region);
-            if (!std::is_same<PrimitiveAndRegionOutputIterator, Emptyset_iterator>::value)
-              *region_out++ = std::make_pair(m_region_type.primitive(), std::move(region));
-          }
-        }
+        if (!get(m_visited, seed))
+          grow_region(seed, region, region_out);
       }
 
       return region_out;
@@ -479,6 +497,141 @@ namespace internal {
     VisitedMap m_visited_map;
     Boolean_property_map<VisitedMap> m_visited;
 
+    struct Always_claim {
+      bool operator()(const Item&) const { return true; }
+    };
+
+#ifdef CGAL_LINKED_WITH_TBB
+    using Claim_map = tbb::concurrent_unordered_map<Item, std::size_t, internal::hash_item<Item> >;
+
+    // Visited map of a region grown speculatively: the items of the regions detected
+    // before the current batch of seeds are shared and read-only, the other ones are local.
+    struct Speculative_visited_map {
+      using key_type = Item;
+      using value_type = bool;
+      using reference = bool;
+      using category = boost::read_write_property_map_tag;
+
+      const VisitedMap* detected;
+      VisitedMap* local;
+
+      friend bool get(const Speculative_visited_map& map, const Item& item) {
+        return (map.detected->count(item) != 0 || map.local->count(item) != 0);
+      }
+
+      friend void put(const Speculative_visited_map& map, const Item& item, bool value) {
+        if (value)
+          map.local->insert(item);
+        else
+          map.local->erase(item);
+      }
+    };
+
+    struct Speculative_region {
+      Region region;
+      std::optional<typename Region_type::Primitive> primitive;
+      bool is_conflicting = false;
+    };
+
+    // Regions are grown concurrently from batches of seeds, each seed having its own copy of
+    // the region type, and ignoring the regions grown from the other seeds of the batch.
+    // The regions are then validated in the order of the seeds: a region is kept if
+    // it does not contain an item of a previously accepted region, and is otherwise grown again.
+    // The result is thus the same as with the sequential algorithm.
+    //
+    // To avoid growing the same region from several seeds of a batch, items are claimed
+    // by the first region that reaches them; a region stops growing as soon as it reaches
+    // an item claimed by a region with a smaller seed, and is grown again if needed during validation.
+    template<typename PrimitiveAndRegionOutputIterator>
+    PrimitiveAndRegionOutputIterator detect_in_parallel(PrimitiveAndRegionOutputIterator region_out) {
+      const std::size_t batch_size = 4 * std::size_t((std::max)(1, tbb::this_task_arena::max_concurrency()));
+
+      std::vector<Item> seeds;
+      std::vector<Speculative_region> speculative_regions;
+      Claim_map claims;
+      Region region;
+
+      auto it = m_seed_range.begin();
+      while (it != m_seed_range.end()) {
+        seeds.clear();
+        for (; it != m_seed_range.end() && seeds.size() < batch_size; ++it)
+          if (!get(m_visited, *it))
+            seeds.push_back(*it);
+
+        claims.clear();
+        speculative_regions.clear();
+        speculative_regions.resize(seeds.size());
+
+        tbb::parallel_for(tbb::blocked_range<std::size_t>(0, seeds.size(), 1),
+                          [&](const tbb::blocked_range<std::size_t>& r) {
+          for (std::size_t rank = r.begin(); rank != r.end(); ++rank) {
+            Speculative_region& sr = speculative_regions[rank];
+
+            VisitedMap local_visited;
+            Speculative_visited_map visited { &m_visited_map, &local_visited };
+            auto claim = [&](const Item& item) -> bool {
+              auto res = claims.insert(std::make_pair(item, rank));
+              if (!res.second && res.first->second < rank) {
+                sr.is_conflicting = true;
+                return false;
+              }
+              return true;
+            };
+
+            Region_type region_type(m_region_type);
+            const bool is_success = propagate(seeds[rank], sr.region, region_type, visited, claim);
+            if (is_success && region_type.is_valid_region(sr.region))
+              sr.primitive = region_type.primitive();
+          }
+        });
+
+        // Validate the regions in the order of their seeds
+        for (std::size_t rank = 0; rank < seeds.size(); ++rank) {
+          const Item& seed = seeds[rank];
+          if (get(m_visited, seed))
+            continue;
+
+          Speculative_region& sr = speculative_regions[rank];
+          bool is_independent = !sr.is_conflicting;
+          for (std::size_t i = 0; is_independent && i < sr.region.size(); ++i)
+            is_independent = !get(m_visited, sr.region[i]);
+
+          if (!is_independent) {
+            grow_region(seed, region, region_out);
+            continue;
+          }
+
+          if (!sr.primitive) // the sequential algorithm would have discarded this region too
+            continue;
+
+          for (const Item& item : sr.region)
+            put(m_visited, item, true);
+
+          fill_region_map(m_nb_regions++, sr.region);
+          if (!std::is_same<PrimitiveAndRegionOutputIterator, Emptyset_iterator>::value)
+            *region_out++ = std::make_pair(*sr.primitive, std::move(sr.region));
+        }
+      }
+
+      return region_out;
+    }
+#endif
+
+    template<typename PrimitiveAndRegionOutputIterator>
+    void grow_region(const Item& seed, Region& region, PrimitiveAndRegionOutputIterator& region_out) {
+      const bool is_success = propagate(seed, region, m_region_type, m_visited);
+
+      // Check global conditions.
+      if (!is_success || !m_region_type.is_valid_region(region)) {
+        revert(region);
+      }
+      else {
+        fill_region_map(m_nb_regions++, region);
+        if (!std::is_same<PrimitiveAndRegionOutputIterator, Emptyset_iterator>::value)
+          *region_out++ = std::make_pair(m_region_type.primitive(), std::move(region));
+      }
+    }
+
     void fill_region_map(std::size_t idx, const Region& region) {
       typedef typename boost::property_traits<Region_map>::value_type Id;
       for (auto item : region) {
@@ -486,7 +639,12 @@ namespace internal {
       }
     }
 
-    bool propagate(const Item &seed, Region& region) {
+    // `claim` is called for each item added to the region; if it returns `false`,
+    // the growing stops and the function returns `false`.
+    template<typename VisitedPMap, typename Claim = Always_claim>
+    bool propagate(const Item &seed, Region& region,
+                   Region_type& region_type, VisitedPMap& visited,
+                   const Claim& claim = Claim()) {
       region.clear();
 
       // Use two queues, while running on this queue, push to the other queue;
@@ -496,12 +654,13 @@ namespace internal {
       bool depth_index = 0;
 
       // Once the index of an item is pushed to the queue, it is pushed to the region too.
-      put(m_visited, seed, true);
+      put(visited, seed, true);
       running_queue[depth_index].push(seed);
       region.push_back(seed);
+      if (!claim(seed)) return false;
 
       // Update internal properties of the region.
-      const bool is_well_created = m_region_type.update(region);
+      const bool is_well_created = region_type.update(region);
       if (!is_well_created) return false;
 
       bool grown = true;
@@ -527,18 +686,19 @@ namespace internal {
             // Visit all found neighbors.
             for (Item neighbor : neighbors) {
 
-              if (!get(m_visited, neighbor)) {
-                if (m_region_type.is_part_of_region(neighbor, region)) {
+              if (!get(visited, neighbor)) {
+                if (region_type.is_part_of_region(neighbor, region)) {
 
                   // Add this neighbor to the other queue so that we can visit it later.
-                  put(m_visited, neighbor, true);
+                  put(visited, neighbor, true);
                   running_queue[!depth_index].push(neighbor);
                   region.push_back(neighbor);
                   grown = true;
+                  if (!claim(neighbor)) return false;
                 }
                 else {
                   // Add this neighbor to the rejected queue so I won't be checked again before refitting the primitive.
-                  put(m_visited, neighbor, true);
+                  put(visited, neighbor, true);
                   rejected.push_back(std::pair<const Item, const Item>(item, neighbor));
                 }
               }
@@ -551,12 +711,12 @@ namespace internal {
         // The region expanded with the current primitive to its largest extent.
         // After refitting the growing may continue, but it is only continued if the refitted primitive still fits all elements of the region.
         if (grown) {
-          m_region_type.update(region);
+          region_type.update(region);
 
           // Verify that associated elements are still within the tolerance.
           bool fits = true;
           for (Item item : region) {
-            if (!m_region_type.is_part_of_region(item, region)) {
+            if (!region_type.is_part_of_region(item, region)) {
               fits = false;
               break;
             }
@@ -566,18 +726,19 @@ namespace internal {
           if (!fits) {
             // Reset visited flags for items that were rejected
             for (const std::pair<const Item, const Item>& p : rejected)
-              put(m_visited, p.second, false);
+              put(visited, p.second, false);
             return true;
           }
 
           // Try to continue growing the region by considering formerly rejected elements.
           for (const std::pair<const Item, const Item>& p : rejected) {
-            if (m_region_type.is_part_of_region(p.second, region)) {
+            if (region_type.is_part_of_region(p.second, region)) {
 
               // Add this neighbor to the other queue so that we can visit it later.
-              put(m_visited, p.second, true);
+              put(visited, p.second, true);
               running_queue[depth_index].push(p.second);
               region.push_back(p.second);
+              if (!claim(p.second)) return false;
             }
             else rejected_swap.push_back(p);
           }
@@ -588,7 +749,7 @@ namespace internal {
 
       // Reset visited flags for items that were rejected
       for (const std::pair<const Item, const Item>& p : rejected)
-        put(m_visited, p.second, false);
+        put(visited, p.second, false);
 
       return true;
     }
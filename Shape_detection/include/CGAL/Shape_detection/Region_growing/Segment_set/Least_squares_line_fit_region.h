@@ -22,6 +22,9 @@
 // Internal includes.
 #include <CGAL/Shape_detection/Region_growing/internal/region_growing_traits.h>
 
+// STL includes.
+#include <memory>
+
 namespace CGAL {
 namespace Shape_detection {
 namespace Segment_set {
@@ -196,7 +199,7 @@ namespace Segment_set {
       This function creates an empty property map that maps iterators on the input range `Item` to std::size_t.
     */
     Region_index_map region_index_map() {
-      return Region_index_map(m_region_map);
+      return Region_index_map(*m_region_map);
     }
 
     /*!
@@ -330,7 +333,7 @@ namespace Segment_set {
     const Segment_map m_segment_map;
     const GeomTraits m_traits;
     const Segment_set_traits m_segment_set_traits;
-    Region_unordered_map m_region_map;
+    std::shared_ptr<Region_unordered_map> m_region_map = std::make_shared<Region_unordered_map>();
 
     FT m_distance_threshold;
     FT m_cos_value_threshold;
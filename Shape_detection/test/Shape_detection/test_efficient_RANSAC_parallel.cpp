@@ -0,0 +1,116 @@
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+#include <CGAL/IO/read_points.h>
+
+#include <CGAL/Shape_detection/Efficient_RANSAC.h>
+#include <CGAL/Point_with_normal_3.h>
+#include <CGAL/property_map.h>
+
+#include <iostream>
+#include <vector>
+
+typedef CGAL::Exact_predicates_inexact_constructions_kernel K;
+typedef K::FT                                               FT;
+typedef CGAL::Point_with_normal_3<K>                        Pwn;
+typedef std::vector<Pwn>                                    Pwn_vector;
+typedef CGAL::Identity_property_map<Pwn>                    Point_map;
+typedef CGAL::Normal_of_point_with_normal_map<K>            Normal_map;
+
+typedef CGAL::Shape_detection::Efficient_RANSAC_traits<K, Pwn_vector, Point_map, Normal_map> Traits;
+typedef CGAL::Shape_detection::Efficient_RANSAC<Traits> Efficient_ransac;
+
+typedef CGAL::Shape_detection::Plane<Traits>                Plane;
+typedef CGAL::Shape_detection::Cylinder<Traits>             Cylinder;
+
+// Runs the detection and returns, for each input point, the index of its shape
+template <typename ConcurrencyTag>
+bool detect(Pwn_vector& points, std::vector<int>& shape_index) {
+
+  // Reseeds the generator, as the input is shuffled by the preprocessing
+  CGAL::get_default_random() = CGAL::Random(0);
+
+  Efficient_ransac ransac;
+  ransac.add_shape_factory<Plane>();
+  ransac.add_shape_factory<Cylinder>();
+  ransac.set_input(points);
+
+  Efficient_ransac::Parameters parameters;
+  parameters.probability = 0.05;
+  parameters.min_points = 100;
+  parameters.epsilon = 0.002;
+  parameters.cluster_epsilon = 0.01;
+  parameters.normal_threshold = 0.9;
+
+  if (!ransac.template detect<ConcurrencyTag>(parameters))
+    return false;
+
+  FT average_distance = 0;
+  shape_index.assign(points.size(), -1);
+  int index = 0;
+  for (const auto& shape : ransac.shapes()) {
+    FT sum_distances = 0;
+    for (std::size_t i : shape->indices_of_assigned_points()) {
+      sum_distances += CGAL::sqrt(shape->squared_distance(points[i]));
+      shape_index[i] = index;
+    }
+
+    average_distance += sum_distances / shape->indices_of_assigned_points().size();
+    ++ index;
+  }
+
+  double coverage = double(points.size() - ransac.number_of_unassigned_points()) / double(points.size());
+  average_distance /= ransac.shapes().size();
+  std::cout << ransac.shapes().size() << " shapes, coverage = " << coverage
+            << ", average distance = " << average_distance << std::endl;
+
+  return (coverage >= 0.75 && average_distance <= 0.02);
+}
+
+int main(int argc, char** argv) {
+
+  const std::string filename = (argc > 1) ? argv[1] : CGAL::data_file_path("points_3/cube.pwn");
+
+  Pwn_vector points;
+  if (!CGAL::IO::read_points(filename, std::back_inserter(points),
+                             CGAL::parameters::point_map(Point_map())
+                                              .normal_map(Normal_map()))) {
+    std::cerr << "Error: cannot read file " << filename << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  const Pwn_vector input = points;
+  std::vector<int> shape_index;
+
+  std::cout << "Sequential: ";
+  if (!detect<CGAL::Sequential_tag>(points, shape_index)) {
+    std::cout << "failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+#ifdef CGAL_LINKED_WITH_TBB
+  std::cout << "Parallel: ";
+  points = input;
+  std::vector<int> parallel_shape_index;
+  if (!detect<CGAL::Parallel_tag>(points, parallel_shape_index)) {
+    std::cout << "failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+  const Pwn_vector parallel_points = points;
+
+  // The same seed must give the same shapes
+  std::cout << "Parallel, again: ";
+  points = input;
+  std::vector<int> other_shape_index;
+  if (!detect<CGAL::Parallel_tag>(points, other_shape_index)) {
+    std::cout << "failed" << std::endl;
+    return EXIT_FAILURE;
+  }
+
+  if (points != parallel_points || other_shape_index != parallel_shape_index) {
+    std::cout << "failed: the parallel detection is not reproducible" << std::endl;
+    return EXIT_FAILURE;
+  }
+#endif
+
+  std::cout << "done" << std::endl;
+  return EXIT_SUCCESS;
+}
@@ -0,0 +1,147 @@
+// STL includes.
+#include <vector>
+#include <string>
+#include <cstdlib>
+#include <fstream>
+#include <iostream>
+#include <iterator>
+#include <cassert>
+
+// CGAL includes.
+#include <CGAL/assertions.h>
+#include <CGAL/property_map.h>
+#include <CGAL/Exact_predicates_inexact_constructions_kernel.h>
+
+#include <CGAL/Point_set_3.h>
+#include <CGAL/Point_set_3/IO.h>
+#include <CGAL/Surface_mesh.h>
+
+#include <CGAL/Shape_detection/Region_growing/Region_growing.h>
+#include <CGAL/Shape_detection/Region_growing/Point_set.h>
+#include <CGAL/Shape_detection/Region_growing/Polygon_mesh.h>
+
+namespace SD = CGAL::Shape_detection;
+using Kernel = CGAL::Exact_predicates_inexact_constructions_kernel;
+
+using FT      = typename Kernel::FT;
+using Point_3 = typename Kernel::Point_3;
+
+// Runs the region growing sequentially and in parallel, and checks that the regions are identical
+template<typename Region_growing, typename Input_range, typename Seed_range,
+         typename Neighbor_query, typename Lambda_region>
+bool test(const std::string& name,
+          const Input_range& input_range,
+          const Seed_range& seeds,
+          Neighbor_query& neighbor_query,
+          const Lambda_region& lambda_region) {
+
+  using Regions = std::vector<typename Region_growing::Primitive_and_region>;
+
+  auto region_type = lambda_region();
+  Region_growing region_growing(input_range, seeds, neighbor_query, region_type);
+  Regions regions;
+  region_growing.detect(std::back_inserter(regions));
+
+  std::vector<std::size_t> indices;
+  for (auto it = input_range.begin(); it != input_range.end(); ++it)
+    indices.push_back(get(region_growing.region_map(), *it));
+
+  bool result = !regions.empty();
+
+#ifdef CGAL_LINKED_WITH_TBB
+  auto parallel_region_type = lambda_region();
+  Region_growing parallel_region_growing(input_range, seeds, neighbor_query, parallel_region_type);
+  Regions parallel_regions;
+  parallel_region_growing.template detect<CGAL::Parallel_tag>(std::back_inserter(parallel_regions));
+
+  std::vector<std::size_t> parallel_indices;
+  for (auto it = input_range.begin(); it != input_range.end(); ++it)
+    parallel_indices.push_back(get(parallel_region_growing.region_map(), *it));
+
+  result = result && (regions.size() == parallel_regions.size());
+  for (std::size_t i = 0; result && i < regions.size(); ++i)
+    result = (regions[i].second == parallel_regions[i].second);
+  result = result && (indices == parallel_indices);
+  assert(result);
+
+  std::cout << "rg_" << name << "_parallel: " << parallel_regions.size() << " regions" << std::endl;
+#endif
+
+  std::cout << "rg_" << name << "_parallel, epick_test_success: " << result << std::endl;
+  return result;
+}
+
+bool test_point_set(int argc, char** argv) {
+
+  using Input_range = CGAL::Point_set_3<Point_3>;
+  using Point_map   = typename Input_range::Point_map;
+  using Normal_map  = typename Input_range::Vector_map;
+  using Neighbor_query = SD::Point_set::K_neighbor_query<Kernel, Input_range::Index, Point_map>;
+  using Region_type = SD::Point_set::Least_squares_plane_fit_region<Kernel, Input_range::Index, Point_map, Normal_map>;
+  using Sorting = SD::Point_set::Least_squares_plane_fit_sorting<Kernel, Input_range::Index, Neighbor_query, Point_map>;
+  using Region_growing = SD::Region_growing<Neighbor_query, Region_type>;
+
+  std::ifstream in(argc > 1 ? argv[1] : CGAL::data_file_path("points_3/building.xyz"));
+  CGAL::IO::set_ascii_mode(in);
+  assert(in);
+
+  const bool with_normal_map = true;
+  Input_range input_range(with_normal_map);
+  in >> input_range;
+  in.close();
+
+  Neighbor_query neighbor_query(
+    input_range, CGAL::parameters::k_neighbors(12).point_map(input_range.point_map()));
+
+  Sorting sorting(
+    input_range, neighbor_query, CGAL::parameters::point_map(input_range.point_map()));
+  sorting.sort();
+
+  return test<Region_growing>("points3", input_range, sorting.ordered(), neighbor_query,
+    [&]() {
+      return Region_type(CGAL::parameters::
+        maximum_distance(FT(1) / FT(100)).
+        maximum_angle(FT(10)).
+        minimum_region_size(20).
+        point_map(input_range.point_map()).
+        normal_map(input_range.normal_map()));
+    });
+}
+
+bool test_polygon_mesh(int argc, char** argv) {
+
+  using Polygon_mesh = CGAL::Surface_mesh<Point_3>;
+  using Neighbor_query = SD::Polygon_mesh::One_ring_neighbor_query<Polygon_mesh>;
+  using Region_type    = SD::Polygon_mesh::Least_squares_plane_fit_region<Kernel, Polygon_mesh>;
+  using Sorting        = SD::Polygon_mesh::Least_squares_plane_fit_sorting<Kernel, Polygon_mesh, Neighbor_query>;
+  using Region_growing = SD::Region_growing<Neighbor_query, Region_type>;
+
+  std::ifstream in(argc > 2 ? argv[2] : CGAL::data_file_path("meshes/building.off"));
+  CGAL::IO::set_ascii_mode(in);
+  assert(in);
+
+  Polygon_mesh polygon_mesh;
+  in >> polygon_mesh;
+  in.close();
+
+  Neighbor_query neighbor_query(polygon_mesh);
+
+  Sorting sorting(polygon_mesh, neighbor_query);
+  sorting.sort();
+
+  return test<Region_growing>("faces3", faces(polygon_mesh), sorting.ordered(), neighbor_query,
+    [&]() {
+      return Region_type(polygon_mesh, CGAL::parameters::
+        maximum_distance(FT(1)).
+        maximum_angle(FT(45)).
+        minimum_region_size(5));
+    });
+}
+
+int main(int argc, char *argv[]) {
+
+  bool success = test_point_set(argc, argv);
+  success = test_polygon_mesh(argc, argv) && success;
+
+  return (success) ? EXIT_SUCCESS : EXIT_FAILURE;
+}